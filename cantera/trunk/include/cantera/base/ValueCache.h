@@ -31,7 +31,9 @@ struct CachedValue {
         state1(std::numeric_limits<double>::quiet_NaN()),
         state2(std::numeric_limits<double>::quiet_NaN()),
         stateNum(std::numeric_limits<int>::min()),
-        value(T())
+        value(T()),
+        hits(0),
+        misses(0)
     {
     }
 
@@ -40,8 +42,10 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New) {
       if(state1 == state1New) {
+        hits++;
         return true;
       } else {
+        misses++;
         state1 = state1New;
       }
       return false;
@@ -52,8 +56,10 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, double state2New) {
       if(state1 == state1New && state2 == state2New) {
+        hits++;
         return true;
       } else {
+        misses++;
         state1 = state1New;
         state2 = state2New;
       }
@@ -65,8 +71,10 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, int stateNumNew) {
       if(state1 == state1New && stateNum == stateNumNew) {
+        hits++;
         return true;
       } else {
+        misses++;
         state1 = state1New;
         stateNum = stateNumNew;
       }
@@ -78,8 +86,10 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(int stateNumNew) {
       if(stateNum == stateNumNew) {
+        hits++;
         return true;
       } else {
+        misses++;
         stateNum = stateNumNew;
       }
       return false;
@@ -90,8 +100,10 @@ struct CachedValue {
     //! state to the new state in addition to returning false.
     bool validate(double state1New, double state2New, int stateNumNew) {
       if(state1 == state1New && state2 == state2New && stateNum == stateNumNew) {
+        hits++;
         return true;
       } else {
+        misses++;
         state1 = state1New;
         state2 = state2New;
         stateNum = stateNumNew;
@@ -113,6 +125,13 @@ struct CachedValue {
 
     //! The value of the cached property
     T value;
+
+    //! Number of calls to validate() which found the cached value to be valid
+    size_t hits;
+
+    //! Number of calls to validate() which found the cached value to be
+    //! invalid
+    size_t misses;
 };
 
 typedef CachedValue<double>& CachedScalar;
@@ -175,6 +194,14 @@ public:
     //! thermodynamics as a function of temperature.
     void clear();
 
+    //! Total number of cache hits, counted by CachedValue::validate(), for
+    //! all values stored since the last call to clear().
+    size_t hits() const;
+
+    //! Total number of cache misses, counted by CachedValue::validate(), for
+    //! all values stored since the last call to clear().
+    size_t misses() const;
+
 protected:
     //! Cached scalar values
     std::map<int, CachedValue<double> > m_scalarCache;
@@ -73,6 +73,11 @@ public:
         return m_np;
     }
     virtual double sensitivity(size_t k, size_t p);
+    virtual doublereal time() const {
+        return m_time;
+    }
+    virtual bool getRootInfo(int* info);
+    virtual void getDky(double t, int k, double* dky);
 
     //! Returns a string listing the weighted error estimates associated
     //! with each solution component.
@@ -117,6 +122,9 @@ private:
     //! for at the current integrator time.
     bool m_sens_ok;
 
+    size_t m_nroots; //!< Number of root functions
+    bool m_rootFound; //!< True if the last step stopped at a root
+
 };
 
 }    // namespace
@@ -104,6 +104,14 @@ public:
         warn("setJacobian");
     }
 
+    /**
+     * Set the form of the Jacobian: 0 for a numerical Jacobian computed by
+     * the solver, 1 for a Jacobian given by ResidJacEval::evalJacobianDP().
+     */
+    virtual void setJacobianType(int formJac) {
+        warn("setJacobianType");
+    }
+
     virtual void setLinearSolverType(int solverType) {
         warn("setLinearSolverType");
     }
@@ -8,6 +8,7 @@
 #define CT_FUNCEVAL_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -48,6 +49,52 @@ public:
     virtual size_t nparams() {
         return 0;
     }
+
+    //! Number of root functions. The integrator locates the times at which
+    //! any of these functions crosses zero.
+    virtual size_t nRootFunctions() {
+        return 0;
+    }
+
+    /**
+     * Evaluate the root functions. Called by the integrator.
+     * @param[in] t time.
+     * @param[in] y solution vector, length neq()
+     * @param[out] gout values of the root functions, length nRootFunctions()
+     */
+    virtual void evalRootFunctions(double t, double* y, double* gout) {
+        throw NotImplementedError("FuncEval::evalRootFunctions");
+    }
+
+    //! Prepare the preconditioner used by iterative linear solvers.
+    /*!
+     *  Called by the integrator when the problem type is `GMRES + JAC`.
+     *  Implementations should compute and factor an approximation \f$ P \f$
+     *  of the Newton matrix \f$ M = I - \gamma J \f$, where \f$ J \f$ is
+     *  the Jacobian of the right-hand-side function.
+     *
+     *  @param[in] t time.
+     *  @param[in] y solution vector, length neq()
+     *  @param[in] ydot right-hand-side function evaluated at `y`
+     *  @param[in] reuseJacobian If true, the Jacobian saved from the previous
+     *      call may be used with the new value of `gamma`.
+     *  @param[in] gamma scalar appearing in the Newton matrix.
+     *  @returns true if the Jacobian was re-evaluated.
+     */
+    virtual bool preconditionerSetup(double t, double* y, double* ydot,
+                                     bool reuseJacobian, double gamma) {
+        throw NotImplementedError("FuncEval::preconditionerSetup");
+    }
+
+    //! Solve the system \f$ P x = r \f$ using the preconditioner computed by
+    //! the last call to preconditionerSetup().
+    /*!
+     *  @param[in] rhs right hand side `r`, length neq()
+     *  @param[out] output solution `x`, length neq()
+     */
+    virtual void preconditionerSolve(const double* rhs, double* output) {
+        throw NotImplementedError("FuncEval::preconditionerSolve");
+    }
 };
 
 }
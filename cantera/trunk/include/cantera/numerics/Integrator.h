@@ -17,12 +17,19 @@
 namespace Cantera
 {
 
+//! @name Problem types
+//! Bit flags describing how the linear systems within the Newton iteration are
+//! solved, used as arguments to Integrator::setProblemType. `GMRES + JAC`
+//! selects the iterative solver, preconditioned using
+//! FuncEval::preconditionerSetup and FuncEval::preconditionerSolve.
+//! @{
 const int DIAG  = 1;
 const int DENSE = 2;
 const int NOJAC = 4;
 const int JAC   = 8;
 const int GMRES =16;
 const int BAND  =32;
+//! @}
 
 /**
  * Specifies the method used to integrate the system of equations.
@@ -115,6 +122,9 @@ public:
 
     //! Integrate the system of equations.
     /*!
+     * If the FuncEval object defines root functions, the integration stops
+     * early if any of them crosses zero. See getRootInfo().
+     *
      * @param tout Integrate to this time. Note that this is the
      *             absolute time value, not a time interval.
      */
@@ -123,15 +133,57 @@ public:
     }
 
     /**
-     * Integrate the system of equations.
+     * Take a single internal step of the integrator. If the previous call to
+     * integrate() returned a solution interpolated to a time before the end
+     * of the last internal step, no new step is taken, and the solution is
+     * returned at the end of that step.
      * @param tout integrate to this time. Note that this is the
      * absolute time value, not a time interval.
+     * @returns the time reached
      */
     virtual doublereal step(doublereal tout) {
         warn("step");
         return 0.0;
     }
 
+    //! The time corresponding to the current solution, i.e. the time reached
+    //! by the last call to integrate() or step().
+    virtual doublereal time() const {
+        warn("time");
+        return 0.0;
+    }
+
+    //! Determine whether the last call to integrate() or step() stopped at a
+    //! root of one of the root functions defined by the FuncEval object.
+    /*!
+     * @param[out] info For each root function, +1 if it crossed zero while
+     *     increasing, -1 if it crossed zero while decreasing, and 0
+     *     otherwise. Length FuncEval::nRootFunctions().
+     * @returns true if a root was found.
+     */
+    virtual bool getRootInfo(int* info) {
+        warn("getRootInfo");
+        return false;
+    }
+
+    //! Get the interpolated solution, or its derivatives, at time `t`
+    /*!
+     * The integrator maintains an interpolating polynomial for the solution
+     * within its last internal step, so the solution can be evaluated at any
+     * time in this interval without any further evaluations of the right
+     * hand side.
+     *
+     * @param t    Time at which to evaluate the solution. Must be within the
+     *             last internal step, i.e. between the time reached by the
+     *             previous call to step() and the current internal time.
+     * @param k    Order of the derivative. 0 for the solution itself.
+     * @param[out] dky The `k`-th derivative of the solution at `t`. Length
+     *             nEquations().
+     */
+    virtual void getDky(doublereal t, int k, doublereal* dky) {
+        warn("getDky");
+    }
+
     /** The current value of the solution of equation k. */
     virtual doublereal& solution(size_t k) {
         warn("solution");
@@ -12,6 +12,8 @@
 #include "cantera/base/ctexceptions.h"
 #include "refine.h"
 
+#include <map>
+
 namespace Cantera
 {
 
@@ -391,6 +393,23 @@ public:
      */
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
 
+    //! Collect the solver state of this domain for a binary checkpoint
+    /*!
+     * Adds named arrays holding the settings which are not part of the
+     * solution vector (tolerances, refinement criteria, and any
+     * domain-specific state) to `data`. Derived classes which override this
+     * method should call the base class method in addition to adding their
+     * own data. @see Sim1D::saveCheckpoint
+     */
+    virtual void getCheckpointData(std::map<std::string, vector_fp>& data) const;
+
+    //! Restore the solver state written by getCheckpointData()
+    /*!
+     * Called after the grid and the solution vector have been restored.
+     * Entries which are not present in `data` are left unchanged.
+     */
+    virtual void setCheckpointData(const std::map<std::string, vector_fp>& data);
+
     size_t size() const {
         return m_nv*m_points;
     }
@@ -167,6 +167,8 @@ public:
                       integer* diagg, doublereal rdt);
     virtual XML_Node& save(XML_Node& o, const doublereal* const soln);
     virtual void restore(const XML_Node& dom, doublereal* soln, int loglevel);
+    virtual void getCheckpointData(std::map<std::string, vector_fp>& data) const;
+    virtual void setCheckpointData(const std::map<std::string, vector_fp>& data);
 
 protected:
     int m_ilr;
@@ -13,6 +13,62 @@ namespace Cantera
 class MultiNewton;
 class Func1;
 
+//! Timing and iteration statistics accumulated while solving a OneDim
+//! problem.
+/*!
+ *  All times are CPU times in seconds, measured with `clock()`. The times
+ *  spent evaluating thermodynamic properties, production rates and transport
+ *  properties are recorded by the flow domains, and include the residual
+ *  evaluations made while computing the Jacobian.
+ *  @see OneDim::profile
+ *  @ingroup onedim
+ */
+struct OneDimProfile
+{
+    OneDimProfile() {
+        clear();
+    }
+
+    //! Reset all counters and timers to zero.
+    void clear();
+
+    //! Mean damping factor of the accepted damped Newton steps.
+    double meanDamping() const {
+        return (nDampedSteps > 0) ? dampSum / nDampedSteps : 1.0;
+    }
+
+    //! Write the statistics as an XML \<profile\> element to `s`
+    void write(std::ostream& s) const;
+
+    int nResidEvals; //!< residual evaluations, excluding Jacobian evaluation
+    double residTime; //!< time spent in counted residual evaluations
+    double thermoTime; //!< time spent updating thermodynamic properties
+    double kineticsTime; //!< time spent computing production rates
+    double transportTime; //!< time spent on transport properties and fluxes
+
+    int nJacEvals; //!< Jacobian evaluations
+    double jacTime; //!< time spent evaluating the Jacobian
+    int nFactor; //!< LU factorizations of the Jacobian
+    double factorTime; //!< time spent factoring the Jacobian
+    int nLinearSolves; //!< back-substitutions using the factored Jacobian
+    double linearSolveTime; //!< time spent in back-substitutions
+
+    int nNewtonSolves; //!< calls to the damped Newton solver
+    int nNewtonFailures; //!< Newton solves which failed to converge
+    double newtonTime; //!< time spent in the damped Newton solver
+    int nDampedSteps; //!< Newton steps for which a damping factor was found
+    int nDampFailures; //!< Newton steps for which no damping factor was found
+    double dampSum; //!< sum of the accepted damping factors
+    double dampMin; //!< smallest accepted damping factor
+
+    int nTimeSteps; //!< successful pseudo-transient time steps
+    int nTimeStepFailures; //!< failed time steps
+    double timeStepTime; //!< time spent time stepping
+
+    int nRegrid; //!< calls to Sim1D::refine
+    double regridTime; //!< time spent regridding
+};
+
 /**
  * Container class for multiple-domain 1D problems. Each domain is
  * represented by an instance of Domain1D.
@@ -244,6 +300,24 @@ public:
     //! Clear saved statistics
     void clearStats();
 
+    //! Timing and iteration statistics accumulated since the last call to
+    //! clearStats().
+    const OneDimProfile& profile() const {
+        return m_profile;
+    }
+
+    //! Mutable access to the statistics, used by the domains and solvers
+    //! operating on this object to record their work.
+    OneDimProfile& profile() {
+        return m_profile;
+    }
+
+    //! Write the accumulated timing and iteration statistics to the stream
+    //! `s` in XML format. @see OneDimProfile::write
+    void writeProfile(std::ostream& s) const {
+        m_profile.write(s);
+    }
+
     //! Set a function that will be called every time #eval is called.
     //! Can be used to provide keyboard interrupt support in the high-level
     //! language interfaces.
@@ -285,6 +359,9 @@ protected:
     //! Function called at the start of every call to #eval.
     Func1* m_interrupt;
 
+    //! Timing and iteration statistics
+    OneDimProfile m_profile;
+
 private:
     // statistics
     int m_nevals;
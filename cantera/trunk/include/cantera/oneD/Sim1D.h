@@ -115,7 +115,14 @@ public:
         OneDim::eval(npos, DATA_PTR(m_x), DATA_PTR(m_xnew), rdt, count);
     }
 
-    /// Refine the grid in all domains.
+    //! Refine the grid in all domains.
+    /*!
+     *  Points are added where required by the refinement criteria and
+     *  removed where allowed by the pruning and coarsening criteria, in a
+     *  single pass. @see Refiner
+     *  @returns the number of grid points added or removed, or a negative
+     *      value if the maximum number of grid points has been reached.
+     */
     int refine(int loglevel=0);
 
     //! Add node for fixed temperature point of freely propagating flame
@@ -130,6 +137,15 @@ public:
                            doublereal slope = 0.8, doublereal curve = 0.8, doublereal prune = -0.1);
     void setMaxGridPoints(int dom = -1, int npoints = 300);
 
+    //! Set the grid coarsening threshold in the specified domain(s).
+    /*!
+     *  @param dom Domain index. If dom == -1, the threshold is applied to
+     *      all domains.
+     *  @param coarsen Coarsening threshold. Set `coarsen <= 0` to disable
+     *      coarsening. @see Refiner::setCoarsenThreshold.
+     */
+    void setCoarsenThreshold(int dom, double coarsen);
+
     //! Set the minimum grid spacing in the specified domain(s).
     /*!
      *  @param dom Domain index. If dom == -1, the specified spacing
@@ -141,6 +157,43 @@ public:
     //! Initialize the solution with a previously-saved solution.
     void restore(const std::string& fname, const std::string& id, int loglevel=2);
 
+    //! Write a binary checkpoint of the current solution state.
+    /*!
+     *  The checkpoint contains the grid and the raw solution vector of each
+     *  domain together with the solver settings needed to continue the
+     *  calculation (tolerances, refinement criteria, energy and species
+     *  equation flags, fixed temperature data and time stepping parameters).
+     *  Unlike save(), no text formatting or XML tree is involved, so writing
+     *  a checkpoint is cheap enough to be done frequently during long
+     *  calculations.
+     *
+     *  The physical setup of the problem (mechanism, transport model, domain
+     *  types) is not stored. A checkpoint can only be restored into a Sim1D
+     *  object with the same domain structure and components. Use save() to
+     *  write a self-describing solution record.
+     *
+     *  @param fname  Name of the file to be written. An existing file is
+     *      overwritten.
+     */
+    void saveCheckpoint(const std::string& fname);
+
+    //! Restore the solution state from a file written by saveCheckpoint().
+    /*!
+     *  On POSIX systems the file is memory mapped rather than read into a
+     *  separate file buffer. The header and the grid and solution of every
+     *  domain are read and checked before any domain is modified; a
+     *  CanteraError is thrown if the file is truncated or if the number of
+     *  domains, components, or component names do not match this object.
+     *  The domain settings are then applied with
+     *  Domain1D::setCheckpointData(), which may still throw if an entry is
+     *  inconsistent, in which case the grid and solution of this object
+     *  have already been replaced.
+     *
+     *  @param fname  Name of the checkpoint file
+     *  @param loglevel  0 to suppress all output; 1 to show warnings
+     */
+    void restoreCheckpoint(const std::string& fname, int loglevel=1);
+
     void getInitialSoln();
 
     void setSolution(const doublereal* soln) {
@@ -165,6 +165,9 @@ public:
     virtual void restore(const XML_Node& dom, doublereal* soln,
                          int loglevel);
 
+    virtual void getCheckpointData(std::map<std::string, vector_fp>& data) const;
+    virtual void setCheckpointData(const std::map<std::string, vector_fp>& data);
+
     // overloaded in subclasses
     virtual std::string flowType() {
         return "<none>";
@@ -458,9 +461,15 @@ protected:
         return -2.0*(c2/(z(j+1) - z(j)) - c1/(z(j) - z(j-1)))/(z(j+1) - z(j-1));
     }
 
-    size_t mindex(size_t k, size_t j, size_t m) {
-        return m*m_nsp*m_nsp + m_nsp*j + k;
-    }
+    //! Multicomponent diffusion coefficients for the interval between
+    //! points j and j+1.
+    /*!
+     *  The coefficients are computed from the midpoint state saved by
+     *  updateTransport(), and are cached for the last few intervals
+     *  requested. The returned array is stored in column-major order, so the
+     *  coefficient for species k and m is at index `k + m*m_nsp`.
+     */
+    const doublereal* multiDiffCoeffs(size_t j);
 
     //! Update the diffusive mass fluxes.
     void updateDiffFluxes(const doublereal* x, size_t j0, size_t j1);
@@ -486,7 +495,21 @@ protected:
     vector_fp m_visc;
     vector_fp m_tcon;
     vector_fp m_diff;
+
+    //! Multicomponent diffusion coefficients for the intervals listed in
+    //! #m_multidiff_interval. Only a few intervals are stored at a time,
+    //! so that the storage does not scale as nsp*nsp*points. Four
+    //! intervals are sufficient for a Jacobian evaluation, where a
+    //! perturbation at point j requires the fluxes for the intervals from
+    //! j-2 to j+1.
     vector_fp m_multidiff;
+    std::vector<size_t> m_multidiff_interval;
+
+    //! Temperature and mass fractions at the midpoint of each interval used
+    //! to compute the multicomponent diffusion coefficients.
+    vector_fp m_tmid;
+    Array2D m_ymid;
+
     Array2D m_dthermal;
     Array2D m_flux;
 
@@ -584,6 +607,9 @@ public:
 
     virtual XML_Node& save(XML_Node& o, const doublereal* const sol);
 
+    virtual void getCheckpointData(std::map<std::string, vector_fp>& data) const;
+    virtual void setCheckpointData(const std::map<std::string, vector_fp>& data);
+
     //! Location of the point where temperature is fixed
     doublereal m_zfixed;
 
@@ -2,6 +2,7 @@
 #define CT_REFINE_H
 
 #include "cantera/base/ct_defs.h"
+#include <set>
 
 namespace Cantera
 {
@@ -37,11 +38,34 @@ public:
         m_active[comp] = state;
     }
 
+    //! Set the threshold for coarsening the grid
+    /*!
+     *  An interior grid point is removed if, for every active solution
+     *  component, the change in value and the change in slope across the
+     *  interval obtained by merging the intervals on either side of the point
+     *  are both smaller than `coarsen` times the corresponding `slope` and
+     *  `curve` refinement limits, and if removing the point does not violate
+     *  the `ratio` criterion. Since `coarsen < 1`, a removed point will not be
+     *  immediately re-added by the refinement criteria. Set `coarsen <= 0`
+     *  to disable coarsening.
+     */
+    void setCoarsenThreshold(double coarsen);
+
+    //! Returns the threshold used for coarsening the grid
+    double coarsenThreshold() const {
+        return m_coarsen;
+    }
+
     //! Set the maximum number of points allowed in the domain
     void setMaxPoints(int npmax) {
         m_npmax = npmax;
     }
 
+    //! Returns the maximum number of points allowed in the domain
+    size_t maxPoints() const {
+        return m_npmax;
+    }
+
     //! Set the minimum allowable spacing between adjacent grid points [m].
     void setGridMin(double gridmin) {
         m_gridmin = gridmin;
@@ -58,12 +82,16 @@ public:
     int nNewPoints() {
         return static_cast<int>(m_loc.size());
     }
+    //! Number of points marked for removal by the coarsening criteria
+    int nRemovedPoints() {
+        return static_cast<int>(m_remove.size());
+    }
     void show();
     bool newPointNeeded(size_t j) {
         return m_loc.find(j) != m_loc.end();
     }
     bool keepPoint(size_t j) {
-        return (m_keep[j] != -1);
+        return (m_keep[j] != -1 && m_remove.find(j) == m_remove.end());
     }
     double value(const double* x, size_t i, size_t j);
 
@@ -81,11 +109,18 @@ public:
     }
 
 protected:
+    //! Mark interior points which can be removed according to the coarsening
+    //! criteria. Called by analyze() after the refinement criteria have been
+    //! evaluated.
+    void coarsen(size_t n, const doublereal* z, const doublereal* x);
+
     std::map<size_t, int> m_loc;
+    std::set<size_t> m_remove; //!< points to be removed by coarsening
     std::map<size_t, int> m_keep;
     std::map<std::string, int> m_c;
     std::vector<bool> m_active;
     doublereal m_ratio, m_slope, m_curve, m_prune;
+    doublereal m_coarsen; //!< coarsening threshold (fraction of slope/curve)
     doublereal m_min_range;
     Domain1D* m_domain;
     size_t m_nv, m_npmax;
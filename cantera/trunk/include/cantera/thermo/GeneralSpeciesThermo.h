@@ -11,6 +11,8 @@
 
 #include "SpeciesThermoMgr.h"
 #include "SpeciesThermoInterpType.h"
+#include "PackedNasaPoly.h"
+#include <set>
 
 namespace Cantera
 {
@@ -23,6 +25,11 @@ namespace Cantera
  * temperature needed for each species. What it does is to create
  * a vector of SpeciesThermoInterpType objects.
  *
+ * The species with NASA polynomial parameterizations (types NASA1, NASA2,
+ * NASA9 and NASA9MULTITEMP) are an exception. Their coefficients are
+ * copied into PackedNasaPoly objects, which update() uses to evaluate all
+ * of them together instead of calling each SpeciesThermoInterpType object.
+ *
  * @ingroup mgrsrefcalc
  */
 class GeneralSpeciesThermo : public SpeciesThermo
@@ -109,6 +116,30 @@ public:
     virtual void update(doublereal T, doublereal* cp_R,
                         doublereal* h_RT, doublereal* s_R) const;
 
+    //! Compute the coefficients of the polynomials for a mixture.
+    /*!
+     * This is supported if all species use NASA polynomials, using
+     * PackedNasaPoly::getMixtureCoeffs().
+     *
+     * @see SpeciesThermo::getMixtureCoeffs
+     */
+    virtual bool getMixtureCoeffs(const doublereal* x, vector_fp& coeffs) const;
+
+    virtual void evalMixture(const vector_fp& coeffs, doublereal T,
+                             doublereal& cp_R, doublereal& h_RT) const;
+
+    //! Compute the reference-state properties for all species at many
+    //! temperatures.
+    /*!
+     * The species with NASA polynomials are evaluated for many temperatures
+     * at once by PackedNasaPoly::updateMany().
+     *
+     * @see SpeciesThermo::updateMany
+     */
+    virtual void updateMany(size_t nStates, const doublereal* T, size_t ld,
+                            doublereal* cp_R, doublereal* h_RT,
+                            doublereal* s_R) const;
+
     virtual doublereal minTemp(size_t k=npos) const;
     virtual doublereal maxTemp(size_t k=npos) const;
     virtual doublereal refPressure(size_t k=npos) const;
@@ -136,6 +167,10 @@ private:
 
     void clear(); //<! Delete owned SpeciesThermoInterpType objects.
 
+    //! Copy the coefficients of the species with NASA polynomials into
+    //! m_nasa7 and m_nasa9.
+    void packNasa() const;
+
 protected:
     typedef std::map<int, std::vector<SpeciesThermoInterpType*> > STIT_map;
     typedef std::map<int, std::vector<double> > tpoly_map;
@@ -161,6 +196,16 @@ protected:
     //! reference pressure (Pa)
     doublereal m_p0;
 
+    //! Evaluators for the species with 7- and 9-coefficient NASA polynomials
+    mutable PackedNasaPoly m_nasa7, m_nasa9;
+
+    //! Parameterization types whose species are all evaluated by m_nasa7
+    //! or m_nasa9
+    mutable std::set<int> m_packedTypes;
+
+    //! True if m_nasa7, m_nasa9 and m_packedTypes are up to date
+    mutable bool m_packedValid;
+
     //! Make the class VPSSMgr a friend because we need to access
     //! the function provideSTIT()
     friend class VPSSMgr;
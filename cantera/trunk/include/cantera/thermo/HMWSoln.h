@@ -2709,6 +2709,35 @@ private:
      */
     mutable vector_int m_CounterIJ;
 
+    //! Cation-anion pairs (i, j) of solute species, with i < j
+    /*!
+     * These are the binary interactions for which the B and C terms of the
+     * Pitzer model are evaluated. Set up by initInteractionLists().
+     */
+    std::vector<std::pair<size_t, size_t> > m_CationAnionPairs;
+
+    //! Pairs (i, j) of solute species with charges of the same sign, with
+    //! i < j
+    /*!
+     * These are the binary interactions for which the Phi terms of the
+     * Pitzer model are evaluated. Set up by initInteractionLists().
+     */
+    std::vector<std::pair<size_t, size_t> > m_LikeChargePairs;
+
+    //! Indices of the ternary interactions amongst the solute species which
+    //! have a nonzero coefficient in m_Psi_ijk_coeff
+    /*!
+     * The index is n = k + j * m_kk + i * m_kk * m_kk, as in m_Psi_ijk. Both
+     * the psi and the zeta interactions are included. Only these entries of
+     * m_Psi_ijk and of its derivatives are evaluated. Set up by
+     * initInteractionLists().
+     */
+    std::vector<size_t> m_PsiNonzero;
+
+    //! Contributions of the ternary interactions to the logarithms of the
+    //! activity coefficients, or to their derivatives. Length = m_kk.
+    mutable vector_fp m_PsiSum_k;
+
     //! This is elambda, MEC
     mutable double elambda[17];
 
@@ -3142,6 +3171,40 @@ private:
      */
     void counterIJ_setup() const;
 
+    //! Set up the lists of the binary and ternary interactions which are
+    //! evaluated in the Pitzer activity coefficient routines.
+    /*!
+     * These are the cation-anion pairs, the pairs of ions with charges of the
+     * same sign, and the ternary interactions with nonzero parameters. In
+     * most electrolyte models only a small fraction of all the pairs and
+     * triples of species interact, so that summing over these lists is much
+     * faster than summing over all the combinations of species.
+     *
+     * This is called by initLengths(), and again after the Pitzer parameters
+     * have been read.
+     */
+    void initInteractionLists();
+
+    //! Calculate the contributions of the ternary interactions to the
+    //! logarithms of the activity coefficients and to the osmotic
+    //! coefficient
+    /*!
+     * The psi terms (Pitzer Eqns. (62), (63) and (64)) and the zeta terms
+     * for the neutral species are summed over the interactions in
+     * m_PsiNonzero, using the cropped molalities. Since these terms are
+     * linear in the interaction parameters, the same routine yields the
+     * derivatives of the contributions when given the derivatives of the
+     * parameters.
+     *
+     * @param psi    Ternary interaction parameters, indexed as m_Psi_ijk.
+     *               This is m_Psi_ijk or one of its derivatives.
+     * @param lnac   Output: contribution to the logarithm of the activity
+     *               coefficient of each species. Length = m_kk.
+     * @return       Contribution to the sum in the expression for the
+     *               osmotic coefficient, Pitzer Eqn. (62)
+     */
+    double s_updatePitzer_psiSums(const double* psi, double* lnac) const;
+
     //! Calculate the cropped molalities
     /*!
      * This is an internal routine that calculates values
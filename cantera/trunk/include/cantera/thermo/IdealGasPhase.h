@@ -418,6 +418,33 @@ public:
      */
     virtual doublereal cv_mole() const;
 
+    //! Compute the mass-specific properties of the mixture at many states.
+    /*!
+     * The reference-state properties of the species are computed for all
+     * temperatures together using SpeciesThermo::updateMany(), which avoids
+     * setting the state of the phase for each point. The state of the phase
+     * is not changed.
+     *
+     * @param nStates Number of states
+     * @param T       Temperatures (K) (length nStates)
+     * @param P       Pressures (Pa) (length nStates). If null, the current
+     *                pressure is used for all states.
+     * @param Y       Mass fractions, with the mass fraction of species k in
+     *                state i at position i*nSpecies() + k. If null, the
+     *                current composition is used for all states. The mass
+     *                fractions are used as given, without normalization.
+     * @param cp      Output: heat capacity at constant pressure (J/kg/K)
+     *                (length nStates)
+     * @param h       Output: enthalpy (J/kg) (length nStates)
+     * @param s       Output: entropy (J/kg/K) (length nStates). Optional.
+     * @param g       Output: Gibbs function (J/kg) (length nStates).
+     *                Optional.
+     */
+    void getMassProperties(size_t nStates, const doublereal* T,
+                           const doublereal* P, const doublereal* Y,
+                           doublereal* cp, doublereal* h, doublereal* s = 0,
+                           doublereal* g = 0) const;
+
     /**
      * @returns species translational/rotational specific heat at
      * constant volume.  Inferred from the species gas
@@ -534,6 +561,100 @@ public:
 
     //@}
 
+    //! @name Setting the State
+    //! @{
+
+    using ThermoPhase::setState_TPX;
+    using ThermoPhase::setState_TPY;
+
+    //! Set the temperature (K), pressure (Pa), and mole fractions.
+    /*!
+     * The mean molecular weight computed while the mole fractions are
+     * normalized gives the density directly, so the temperature and density
+     * are set without going through setState_TP() and setPressure().
+     *
+     * @param t    Temperature (K)
+     * @param p    Pressure (Pa)
+     * @param x    Vector of mole fractions. Length is equal to m_kk.
+     */
+    virtual void setState_TPX(doublereal t, doublereal p, const doublereal* x);
+
+    //! Set the temperature (K), pressure (Pa), and mass fractions.
+    /*!
+     * Equivalent to setState_TPX(), for mass fractions.
+     *
+     * @param t    Temperature (K)
+     * @param p    Pressure (Pa)
+     * @param y    Vector of mass fractions. Length is equal to m_kk.
+     */
+    virtual void setState_TPY(doublereal t, doublereal p, const doublereal* y);
+
+    //! Set the specific enthalpy (J/kg) and pressure (Pa) at constant
+    //! composition.
+    /*!
+     * The temperature is found by a safeguarded Newton iteration. If all
+     * species use NASA polynomials, the enthalpy and heat capacity of the
+     * mixture are evaluated from polynomials whose coefficients are the
+     * mole-weighted sums of the species coefficients (see
+     * SpeciesThermo::getMixtureCoeffs()), and the state of the phase is only
+     * set once the temperature has converged. The iteration is continued
+     * until the relative change in temperature is below 1e-12. If it fails,
+     * ThermoPhase::setState_HP() is used.
+     *
+     * @param h    Specific enthalpy (J/kg)
+     * @param p    Pressure (Pa)
+     * @param tol  Tolerance on the temperature (K) for the fallback
+     *             iteration
+     */
+    virtual void setState_HP(doublereal h, doublereal p,
+                             doublereal tol = 1.e-4);
+
+    //! Set the specific internal energy (J/kg) and specific volume (m^3/kg)
+    //! at constant composition.
+    /*!
+     * The temperature is computed as in setState_HP().
+     *
+     * @param u    Specific internal energy (J/kg)
+     * @param v    Specific volume (m^3/kg)
+     * @param tol  Tolerance on the temperature (K) for the fallback
+     *             iteration
+     */
+    virtual void setState_UV(doublereal u, doublereal v,
+                             doublereal tol = 1.e-4);
+
+    //! Compute the temperatures of many states from their specific
+    //! enthalpies and compositions.
+    /*!
+     * The temperatures are computed as in setState_HP(), without changing
+     * the state of the phase. This is intended for updating the temperature
+     * of each cell of a flow solver from its transported enthalpy.
+     *
+     * @param nStates Number of states
+     * @param h       Specific enthalpies (J/kg) (length nStates)
+     * @param Y       Mass fractions, with the mass fraction of species k in
+     *                state i at position i*nSpecies() + k. If null, the
+     *                current composition is used for all states.
+     * @param T       On input, initial estimates of the temperatures (K).
+     *                On output, the temperatures. (length nStates)
+     */
+    void getTemperatures_HY(size_t nStates, const doublereal* h,
+                            const doublereal* Y, doublereal* T) const;
+
+    //! Compute the temperatures of many states from their specific internal
+    //! energies and compositions.
+    /*!
+     * @param nStates Number of states
+     * @param u       Specific internal energies (J/kg) (length nStates)
+     * @param Y       Mass fractions, as in getTemperatures_HY()
+     * @param T       On input, initial estimates of the temperatures (K).
+     *                On output, the temperatures. (length nStates)
+     * @see getTemperatures_HY
+     */
+    void getTemperatures_UY(size_t nStates, const doublereal* u,
+                            const doublereal* Y, doublereal* T) const;
+
+    //! @}
+
     /**
      * @name Chemical Potentials and Activities
      *
@@ -910,6 +1031,15 @@ protected:
     //! Temporary array containing internally calculated partial pressures
     mutable vector_fp m_pp;
 
+    //! Moles of each species per unit mass (kmol/kg) for the current
+    //! composition. Updated by _updateMixtureCoeffs().
+    mutable vector_fp m_mixYw;
+
+    //! Coefficients of the mixture polynomials for the current composition,
+    //! or empty if these are not available. Updated by
+    //! _updateMixtureCoeffs().
+    mutable vector_fp m_mixCoeffs;
+
 private:
     //! Update the species reference state thermodynamic functions
     /*!
@@ -924,6 +1054,30 @@ private:
      *  (or equivalent) call is made.
      */
     void _updateThermo() const;
+
+    //! Update #m_mixYw and #m_mixCoeffs if the composition has changed.
+    void _updateMixtureCoeffs() const;
+
+    //! Solve for the temperature at which the specific enthalpy or internal
+    //! energy of a mixture has the given value.
+    /*!
+     * @param target  Specific enthalpy or internal energy (J/kg)
+     * @param yw      Moles of each species per unit mass (kmol/kg)
+     * @param coeffs  Mixture coefficients computed from *yw* by
+     *                SpeciesThermo::getMixtureCoeffs(), or empty if these
+     *                are not available
+     * @param doUV    True to solve for the internal energy
+     * @param T       On input, the initial estimate of the temperature. On
+     *                output, the solution.
+     * @return  True if the iteration converged
+     */
+    bool solveTemperature(doublereal target, const vector_fp& yw,
+                          const vector_fp& coeffs, bool doUV,
+                          doublereal& T) const;
+
+    //! Implementation of getTemperatures_HY() and getTemperatures_UY()
+    void getTemperatures(size_t nStates, const doublereal* e,
+                         const doublereal* Y, bool doUV, doublereal* T) const;
 };
 }
 
@@ -161,6 +161,11 @@ public:
      */
     virtual void modifyParameters(doublereal* coeffs);
 
+    //! Number of temperature regions
+    size_t nTemperatureRegions() const {
+        return m_numTempRegions;
+    }
+
 protected:
     //! Number of temperature regions
     size_t m_numTempRegions;
@@ -196,6 +196,18 @@ public:
         }
     }
 
+    //! Get the midpoint temperature and the coefficients of the low and high
+    //! temperature polynomials, each in the order [a0, ..., a6].
+    void getParameters(doublereal& tmid, doublereal* clow,
+                       doublereal* chigh) const {
+        size_t n;
+        int type;
+        doublereal tlow, thigh, pref;
+        tmid = m_midT;
+        mnp_low.reportParameters(n, type, tlow, thigh, pref, clow);
+        mnp_high.reportParameters(n, type, tlow, thigh, pref, chigh);
+    }
+
     doublereal reportHf298(doublereal* const h298 = 0) const {
         double h;
         if (298.15 <= m_midT) {
@@ -0,0 +1,171 @@
+/**
+ *  @file PackedNasaPoly.h
+ *  Header for an evaluator of the NASA polynomials of many species at once
+ *  (see \ref mgrsrefcalc and class
+ *  \link Cantera::PackedNasaPoly PackedNasaPoly\endlink).
+ */
+
+#ifndef CT_PACKEDNASAPOLY_H
+#define CT_PACKEDNASAPOLY_H
+
+#include "cantera/base/ct_defs.h"
+
+namespace Cantera
+{
+
+//! Evaluates the NASA polynomials of a set of species together.
+/*!
+ * Species with the same temperature region boundaries are grouped, so that
+ * the region to use need only be determined once for each group, as in
+ * NasaThermo. Within a group, the coefficients are stored as a structure of
+ * arrays: for each region and each coefficient, the values for all species
+ * of the group are adjacent in memory. The properties of a group are then
+ * computed in loops over species that contain no branches or function calls
+ * and can be vectorized by the compiler. In most mechanisms, nearly all
+ * species share the same midpoint temperature and form a single group.
+ *
+ * Both the 7-coefficient NASA polynomials (as in NasaPoly1 and NasaPoly2)
+ * and the 9-coefficient NASA polynomials (as in Nasa9Poly1 and
+ * Nasa9PolyMultiTempRegion) are supported, but all species in one object
+ * must use the same form. The results are identical to those of the
+ * single-species classes, including at the region boundaries.
+ *
+ * This class is used by GeneralSpeciesThermo for the species with NASA
+ * parameterizations.
+ *
+ * @ingroup mgrsrefcalc
+ */
+class PackedNasaPoly
+{
+public:
+    //! Constructor
+    /*!
+     * @param nCoeffs  Number of coefficients of the polynomial for each
+     *                 region: 7 for the NASA polynomials, or 9 for the NASA9
+     *                 polynomials.
+     */
+    explicit PackedNasaPoly(size_t nCoeffs = 7);
+
+    //! Add a species
+    /*!
+     * @param k        Index of the species in the property arrays
+     * @param nRegions Number of temperature regions
+     * @param bounds   Lower temperature boundaries of the regions after the
+     *                 first, in increasing order (length nRegions-1)
+     * @param coeffs   Coefficients of the polynomial for each region, in the
+     *                 order of the single-species classes (length
+     *                 nRegions*nCoeffs)
+     */
+    void addSpecies(size_t k, size_t nRegions, const doublereal* bounds,
+                    const doublereal* coeffs);
+
+    //! Remove all species
+    void clear();
+
+    //! Number of species
+    size_t nSpecies() const {
+        return m_index.size();
+    }
+
+    //! Compute the reference state properties of all species
+    /*!
+     * For each species, the value at position k of each array is set, where
+     * k is the index given to addSpecies().
+     *
+     * @param T       Temperature (Kelvin)
+     * @param cp_R    Vector of dimensionless heat capacities
+     * @param h_RT    Vector of dimensionless enthalpies
+     * @param s_R     Vector of dimensionless entropies
+     */
+    void update(doublereal T, doublereal* cp_R, doublereal* h_RT,
+                doublereal* s_R) const;
+
+    //! Compute the reference state properties of all species at many
+    //! temperatures
+    /*!
+     * The properties of the species with index k at temperature T[i] are
+     * stored at position i*ld + k of each array. The loops are over the
+     * temperatures, so that they are vectorized even for groups with few
+     * species.
+     *
+     * @param nStates Number of temperatures
+     * @param T       Temperatures (Kelvin) (length nStates)
+     * @param ld      Distance between the properties at consecutive
+     *                temperatures in the output arrays
+     * @param cp_R    Dimensionless heat capacities (length nStates*ld)
+     * @param h_RT    Dimensionless enthalpies (length nStates*ld)
+     * @param s_R     Dimensionless entropies (length nStates*ld)
+     */
+    void updateMany(size_t nStates, const doublereal* T, size_t ld,
+                    doublereal* cp_R, doublereal* h_RT,
+                    doublereal* s_R) const;
+
+    //! Number of coefficients of the mixture polynomials
+    size_t nMixtureCoeffs() const;
+
+    //! Compute the coefficients of the polynomials for a mixture.
+    /*!
+     * For each group and region, the coefficients of the species are summed
+     * with the weights *x*. The results are stored in the order of the
+     * groups, then regions, then coefficients.
+     *
+     * @param x       Weight of each species, indexed by the index given to
+     *                addSpecies()
+     * @param coeffs  Output: coefficients (length nMixtureCoeffs())
+     */
+    void getMixtureCoeffs(const doublereal* x, doublereal* coeffs) const;
+
+    //! Add the weighted sums of the heat capacities and enthalpies of the
+    //! species at temperature *T*.
+    /*!
+     * @param coeffs  Coefficients computed by getMixtureCoeffs()
+     * @param T       Temperature (Kelvin)
+     * @param cp_R    Weighted sum of the dimensionless heat capacities,
+     *                which is incremented
+     * @param h_RT    Weighted sum of the dimensionless enthalpies, which is
+     *                incremented
+     */
+    void evalMixture(const doublereal* coeffs, doublereal T,
+                     doublereal& cp_R, doublereal& h_RT) const;
+
+protected:
+    //! Group the species and rearrange their coefficients into the packed
+    //! layout. Called by update() after species have been added.
+    void pack() const;
+
+    //! Number of coefficients per region
+    size_t m_ncoeff;
+
+    //! True for the 7-coefficient polynomials, where the upper region is
+    //! used only above its boundary. For the NASA9 polynomials, it is used
+    //! at and above its boundary.
+    bool m_strict;
+
+    //! Species indices, boundaries and coefficients of each species, as given
+    //! to addSpecies()
+    std::vector<size_t> m_index;
+    std::vector<vector_fp> m_spBounds;
+    std::vector<vector_fp> m_spCoeffs;
+
+    //! True if the groups are up to date
+    mutable bool m_packed;
+
+    //! Region boundaries of each group
+    mutable std::vector<vector_fp> m_groupBounds;
+
+    //! Species indices of each group, in increasing order
+    mutable std::vector<std::vector<size_t> > m_groupIndex;
+
+    //! Positions in each group where a run of consecutive species indices
+    //! begins, followed by the number of species in the group
+    mutable std::vector<std::vector<size_t> > m_groupRuns;
+
+    //! Coefficients of each group, indexed by (region*m_ncoeff +
+    //! coefficient)*(number of species in the group) + (position in the
+    //! group)
+    mutable std::vector<vector_fp> m_groupCoeffs;
+};
+
+}
+
+#endif
@@ -0,0 +1,559 @@
+/**
+ *  @file PengRobinsonMFTP.h
+ * Definition file for a derived class of ThermoPhase that implements the
+ * Peng-Robinson equation of state for a mixture of real fluids (see \ref
+ * thermoprops and class \link Cantera::PengRobinsonMFTP PengRobinsonMFTP\endlink).
+ */
+
+#ifndef CT_PENGROBINSONMFTP_H
+#define CT_PENGROBINSONMFTP_H
+
+#include "MixtureFugacityTP.h"
+
+namespace Cantera
+{
+/**
+ * @ingroup thermoprops
+ *
+ * Implementation of a multi-species Peng-Robinson equation of state
+ *
+ * The equation of state is
+ * \f[
+ *    P = \frac{RT}{v - b_{mix}} - \frac{a_{mix}(T)}{v^2 + 2 b_{mix} v - b_{mix}^2}
+ * \f]
+ *
+ * The pure species parameters are computed from the critical temperature
+ * \f$ T_{c,i} \f$, the critical pressure \f$ P_{c,i} \f$ and the acentric
+ * factor \f$ \omega_i \f$ of each species:
+ * \f[
+ *    a_i = 0.45724 \frac{R^2 T_{c,i}^2}{P_{c,i}}, \quad
+ *    b_i = 0.07780 \frac{R T_{c,i}}{P_{c,i}}, \quad
+ *    \alpha_i(T) = \left[1 + \kappa_i \left(1 - \sqrt{T/T_{c,i}}\right)\right]^2
+ * \f]
+ * where \f$ \kappa_i \f$ is a polynomial in \f$ \omega_i \f$, evaluated once
+ * when the phase is initialized.
+ *
+ * The mixture parameters are given by the van der Waals mixing rules,
+ * \f[
+ *    a_{mix} = \sum_i \sum_j X_i X_j (1 - k_{ij}) \sqrt{a_i \alpha_i a_j \alpha_j},
+ *    \quad b_{mix} = \sum_i X_i b_i
+ * \f]
+ * Since most of the binary interaction parameters \f$ k_{ij} \f$ are zero,
+ * \f$ a_{mix} \f$ is evaluated as \f$ \left(\sum_i X_i \sqrt{a_i \alpha_i}
+ * \right)^2 \f$ minus a correction for each of the pairs of species with a
+ * nonzero \f$ k_{ij} \f$. The cost of evaluating the mixing rules is
+ * therefore linear in the number of species. The mixing terms and their
+ * temperature derivatives are only reevaluated when the temperature or the
+ * mole fractions change.
+ *
+ * The molar volume is found from the analytic roots of the cubic equation for
+ * the compressibility factor, which are refined by Newton iterations, and
+ * the enthalpy, entropy and heat capacity are computed from analytic
+ * expressions for the departure functions.
+ *
+ * The parameters are read from the "activityCoefficients" node of the
+ * "thermo" node of the phase, which has the model attribute "PengRobinson":
+ *
+ * @code
+ *  <thermo model="PengRobinson">
+ *    <activityCoefficients>
+ *      <pureFluidParameters species="CO2">
+ *        <Tc units="K"> 304.13 </Tc>
+ *        <Pc units="Pa"> 7.3773E6 </Pc>
+ *        <acentric_factor> 0.22394 </acentric_factor>
+ *      </pureFluidParameters>
+ *      <crossFluidParameters species1="CO2" species2="H2O">
+ *        <k_ij> 0.12 </k_ij>
+ *      </crossFluidParameters>
+ *    </activityCoefficients>
+ *  </thermo>
+ * @endcode
+ */
+class PengRobinsonMFTP : public MixtureFugacityTP
+{
+public:
+    //! @name Constructors and Duplicators
+    //! @{
+
+    //! Base constructor.
+    PengRobinsonMFTP();
+
+    //! Construct and initialize a PengRobinsonMFTP object directly from an
+    //! ASCII input file
+    /*!
+     * @param infile    Name of the input file containing the phase XML data
+     *                  to set up the object
+     * @param id        ID of the phase in the input file. Defaults to the empty string.
+     */
+    PengRobinsonMFTP(const std::string& infile, std::string id="");
+
+    //! Construct and initialize a PengRobinsonMFTP object directly from an
+    //! XML database
+    /*!
+     *  @param phaseRef XML phase node containing the description of the phase
+     *  @param id       id attribute containing the name of the phase.  (default is the empty string)
+     */
+    PengRobinsonMFTP(XML_Node& phaseRef, const std::string& id = "");
+
+    //! Copy Constructor
+    /*!
+     * @param right Object to be copied.
+     */
+    PengRobinsonMFTP(const PengRobinsonMFTP& right);
+
+    //! Assignment operator
+    /*!
+     * @param right Object to be copied.
+     */
+    PengRobinsonMFTP& operator=(const PengRobinsonMFTP& right);
+
+    //! Duplicator from the ThermoPhase parent class
+    virtual ThermoPhase* duplMyselfAsThermoPhase() const;
+
+    //! Equation of state type flag. Returns cPengRobinsonMFTP.
+    virtual int eosType() const;
+
+    //! @}
+    //! @name Molar Thermodynamic properties
+    //! @{
+
+    /// Molar enthalpy. Units: J/kmol.
+    virtual doublereal enthalpy_mole() const;
+
+    /// Molar entropy. Units: J/kmol/K.
+    virtual doublereal entropy_mole() const;
+
+    /// Molar heat capacity at constant pressure. Units: J/kmol/K.
+    virtual doublereal cp_mole() const;
+
+    /// Molar heat capacity at constant volume. Units: J/kmol/K.
+    virtual doublereal cv_mole() const;
+
+    //! Compute the density and the mass-specific properties of the mixture
+    //! at many states.
+    /*!
+     * The state of the phase is not changed. Where the equation of state has
+     * both a liquid-like and a gas-like root, the one with the lower Gibbs
+     * function is used. See RedlichKwongMFTP::getMassProperties() for a
+     * description of the arguments.
+     */
+    void getMassProperties(size_t nStates, const doublereal* T,
+                           const doublereal* P, const doublereal* Y,
+                           doublereal* rho, doublereal* cp, doublereal* h,
+                           doublereal* s = 0) const;
+
+    //! @}
+    //! @name Mechanical Properties
+    //! @{
+
+    //! Return the thermodynamic pressure (Pa).
+    virtual doublereal pressure() const;
+
+    //! @}
+
+protected:
+    //! Set the temperature (K), keeping the density fixed
+    /*!
+     * @param temp Temperature in kelvin
+     */
+    virtual void setTemperature(const doublereal temp);
+
+    virtual void setMassFractions(const doublereal* const y);
+    virtual void setMassFractions_NoNorm(const doublereal* const y);
+    virtual void setMoleFractions(const doublereal* const x);
+    virtual void setMoleFractions_NoNorm(const doublereal* const x);
+    virtual void setConcentrations(const doublereal* const c);
+
+public:
+    //! Get the array of generalized concentrations, \f$ X_k / \bar V_k \f$,
+    //! in kmol/m^3.
+    virtual void getActivityConcentrations(doublereal* c) const;
+
+    //! Returns the standard concentration of species k, which is the inverse
+    //! of its standard state molar volume.
+    virtual doublereal standardConcentration(size_t k=0) const;
+
+    virtual void getUnitsStandardConc(double* uA, int k = 0, int sizeUA = 6) const;
+
+    //! Get the array of non-dimensional activity coefficients at the current
+    //! solution temperature, pressure, and solution concentration.
+    /*!
+     * The standard state is the ideal gas at the temperature and pressure of
+     * the solution, so that the activity coefficients are the fugacity
+     * coefficients of the species.
+     *
+     * @param ac Output vector of activity coefficients. Length: m_kk.
+     */
+    virtual void getActivityCoefficients(doublereal* ac) const;
+
+    /// @name  Partial Molar Properties of the Solution
+    //@{
+
+    //! Get the array of non-dimensional species chemical potentials,
+    //! \f$ \mu_k / \hat R T \f$.
+    void getChemPotentials_RT(doublereal* mu) const;
+
+    //! Get the species chemical potentials. Units: J/kmol.
+    virtual void getChemPotentials(doublereal* mu) const;
+
+    //! Get the species partial molar enthalpies. Units: J/kmol.
+    virtual void getPartialMolarEnthalpies(doublereal* hbar) const;
+
+    //! Get the species partial molar entropies. Units: J/kmol/K.
+    /*!
+     * These are computed as \f$ (\bar h_k - \mu_k) / T \f$.
+     */
+    virtual void getPartialMolarEntropies(doublereal* sbar) const;
+
+    //! Get the species partial molar internal energies. Units: J/kmol.
+    virtual void getPartialMolarIntEnergies(doublereal* ubar) const;
+
+    //! Get the partial molar heat capacities. Units: J/kmol/K
+    /*!
+     * As for RedlichKwongMFTP, these are the standard state heat capacities.
+     */
+    virtual void getPartialMolarCp(doublereal* cpbar) const;
+
+    //! Get the species partial molar volumes. Units: m^3/kmol.
+    virtual void getPartialMolarVolumes(doublereal* vbar) const;
+
+    //@}
+    /// @name Critical State Properties.
+    //@{
+
+    //! Critical temperature (K).
+    /*!
+     * The pseudo-critical temperature of the mixture is the temperature at
+     * which \f$ a_{mix}(T) / (b_{mix} R T) = \Omega_a / \Omega_b \f$. For a
+     * pure species, this is \f$ T_c \f$. It is cached until the mole
+     * fractions change.
+     */
+    virtual doublereal critTemperature() const;
+
+    /// Critical pressure (Pa).
+    virtual doublereal critPressure() const;
+
+    /// Critical volume (m3/kmol)
+    virtual doublereal critVolume() const;
+
+    /// Critical compressibility (unitless)
+    virtual doublereal critCompressibility() const;
+
+    /// Critical density (kg/m3).
+    virtual doublereal critDensity() const;
+
+    //@}
+    //! @name Initialization Methods - For Internal use
+    //@{
+
+    virtual void setParametersFromXML(const XML_Node& thermoNode);
+
+    virtual void initThermo();
+
+    //! This method is used by the ChemEquil equilibrium solver.
+    /*!
+     * @param lambda_RT Input vector of dimensionless element potentials
+     *                  The length is equal to nElements().
+     */
+    void setToEquilState(const doublereal* lambda_RT);
+
+    //! Initialize the object from the "thermo" node of the phase.
+    /*!
+     * Reads the pure fluid and cross fluid parameters, and computes the
+     * pure species parameters of the equation of state.
+     *
+     * @param phaseNode  XML phase node containing the description of the phase
+     * @param id         ID of the phase.
+     */
+    virtual void initThermoXML(XML_Node& phaseNode, const std::string& id);
+
+    //! Set the binary interaction parameter of a pair of species
+    /*!
+     * The parameters of the phase are not recomputed until the next change
+     * of state.
+     *
+     * @param i    Index of the first species
+     * @param j    Index of the second species
+     * @param kij  Binary interaction parameter
+     */
+    void setBinaryInteraction(size_t i, size_t j, doublereal kij);
+
+    //! Number of pairs of species with a nonzero binary interaction parameter
+    size_t nBinaryInteractions() const {
+        return m_pairKij.size();
+    }
+
+private:
+    //! Read the pure species Peng-Robinson parameters
+    /*!
+     *  @param pureFluidParam   XML_Node for the pure fluid parameters
+     */
+    void readXMLPureFluid(XML_Node& pureFluidParam);
+
+    //! Read the binary interaction parameter of a pair of species
+    /*!
+     *  @param crossFluidParam   XML_Node for the cross fluid parameters
+     */
+    void readXMLCrossFluid(XML_Node& crossFluidParam);
+
+    //! Compute the pure species parameters from the critical properties
+    //! and acentric factors
+    void calcSpeciesParameters();
+
+    //! @internal Initialize the internal lengths in this object.
+    void initLengths();
+    // @}
+
+protected:
+    // Special functions inherited from MixtureFugacityTP
+
+    //! Deviation of the molar entropy of the mixture from that of the ideal
+    //! gas mixture at the same temperature and pressure (J/kmol/K)
+    virtual doublereal sresid() const;
+
+    //! Deviation of the molar enthalpy of the mixture from that of the ideal
+    //! gas mixture at the same temperature and pressure (J/kmol)
+    virtual doublereal hresid() const;
+
+public:
+    //! Estimate for the molar volume of the liquid
+    /*!
+     *  @param TKelvin  temperature in kelvin
+     *  @param pres     Pressure in Pa. This is used as an initial guess. If the routine
+     *                  needs to change the pressure to find a stable liquid state, the
+     *                  new pressure is returned in this variable.
+     *
+     *  @return Returns the estimate of the liquid volume, or -1 if none
+     *          was found.
+     */
+    virtual doublereal liquidVolEst(doublereal TKelvin, doublereal& pres) const;
+
+    //! Calculates the density given the temperature and the pressure and a
+    //! guess at the density.
+    /*!
+     * The roots of the cubic are found analytically. Where there is more
+     * than one root, the requested phase is used, or the root closest to the
+     * guessed density if the phase is FLUID_UNDEFINED.
+     *
+     *  @param TKelvin   Temperature in Kelvin
+     *  @param pressure  Pressure in Pascals (Newton/m**2)
+     *  @param phase     int representing the phase whose density we are requesting.
+     *  @param rhoguess  Guessed density of the fluid. A value of -1.0 indicates that there
+     *                   is no guessed density
+     *
+     *  @return   We return the density of the fluid at the requested phase. If we have not found any
+     *            acceptable density we return a -1. If we have found an acceptable density at a
+     *            different phase, we return a -2.
+     */
+    virtual doublereal densityCalc(doublereal TKelvin, doublereal pressure, int phase, doublereal rhoguess);
+
+    virtual doublereal densSpinodalLiquid() const;
+
+    virtual doublereal densSpinodalGas() const;
+
+    //! Calculate the pressure given the temperature and the molar volume
+    /*!
+     * @param   TKelvin   temperature in kelvin
+     * @param   molarVol  molar volume ( m3/kmol)
+     */
+    virtual doublereal pressureCalc(doublereal TKelvin, doublereal molarVol) const;
+
+    //! Calculate the pressure and the pressure derivative given the temperature and the molar volume
+    /*!
+     * @param   TKelvin   temperature in kelvin
+     * @param   molarVol  molar volume ( m3/kmol)
+     * @param   presCalc  Returns the pressure.
+     *
+     *  @return  Returns the derivative of the pressure wrt the molar volume
+     */
+    virtual doublereal dpdVCalc(doublereal TKelvin, doublereal molarVol, doublereal& presCalc) const;
+
+    //! Calculate dpdV and dpdT at the current conditions
+    void pressureDerivatives() const;
+
+    virtual void updateMixingExpressions();
+
+    //! Update the a and b parameters of the mixture for the current state
+    void updateAB();
+
+    //! Update the mixing terms and the species values of \f$ \sqrt{a_i
+    //! \alpha_i} \f$ if the temperature or the mole fractions have changed
+    void updateMixingCoeffs() const;
+
+    //! Update the cached critical properties of the mixture
+    void updateCriticalConditions() const;
+
+    //! Evaluate the mixing rules at a given temperature and composition
+    /*!
+     * The cost is linear in the number of species and in the number of pairs
+     * of species with a nonzero binary interaction parameter.
+     *
+     * @param T       Temperature (K)
+     * @param x       Mole fractions
+     * @param a       Output: \f$ a_{mix} \f$
+     * @param dadt    Output: \f$ d a_{mix} / dT \f$
+     * @param d2adt2  Output: \f$ d^2 a_{mix} / dT^2 \f$
+     * @param sqrtAlpha   Optional output: \f$ \sqrt{a_i \alpha_i} \f$ for each
+     *                    species
+     * @param dsqrtAlpha  Optional output: temperature derivative of
+     *                    \f$ \sqrt{a_i \alpha_i} \f$ for each species
+     */
+    void mixtureA(doublereal T, const doublereal* x, doublereal& a,
+                  doublereal& dadt, doublereal& d2adt2,
+                  doublereal* sqrtAlpha = 0, doublereal* dsqrtAlpha = 0) const;
+
+    //!  Calculate the a and the b parameters given the temperature
+    /*!
+     *  Uses the stored mole fractions, and does not change the state.
+     *
+     *  @param temp  Temperature (TKelvin)
+     *  @param aCalc (output)  Returns the a value
+     *  @param bCalc (output)  Returns the b value.
+     */
+    void calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const;
+
+    //! Temperature derivative of a at the current state
+    doublereal da_dt() const;
+
+    //! Second temperature derivative of a at the current state
+    doublereal d2a_dt2() const;
+
+    //! Compute \f$ \sum_j X_j a_{kj} \f$ and its temperature derivative
+    //! for each species at the current state
+    /*!
+     * @param pp   Output: \f$ \sum_j X_j a_{kj} \f$. Length m_kk.
+     * @param dpp  Output: temperature derivative of pp. Length m_kk. Optional.
+     */
+    void speciesMixingTerms(doublereal* pp, doublereal* dpp = 0) const;
+
+    //! Solve the cubic equation of state for the molar volume
+    /*!
+     * The cubic in the compressibility factor,
+     * \f[
+     *    Z^3 - (1 - B) Z^2 + (A - 3 B^2 - 2 B) Z - (A B - B^2 - B^3) = 0
+     * \f]
+     * with \f$ A = a P / (RT)^2 \f$ and \f$ B = b P / RT \f$, is solved with
+     * the trigonometric or Cardano formula, and each root is refined by a
+     * few Newton iterations.
+     *
+     * @param TKelvin  Temperature (K)
+     * @param pres     Pressure (Pa)
+     * @param a        Value of a
+     * @param b        Value of b
+     * @param Vroot    Output: molar volumes of the roots with V > b, in
+     *                 increasing order
+     * @return the number of roots found (1, 2 or 3). If it is 0, then
+     *         there is an error.
+     */
+    int cubicSolve(double TKelvin, double pres, doublereal a, doublereal b,
+                   doublereal Vroot[3]) const;
+
+    //! Calculate the departure functions at a given state
+    /*!
+     * @param T      Temperature (K)
+     * @param P      Pressure (Pa)
+     * @param V      Molar volume (m^3/kmol)
+     * @param a      Value of a at T
+     * @param dadt   First derivative of a with respect to T
+     * @param d2adt2 Second derivative of a with respect to T
+     * @param b      Value of b
+     * @param hres   Output: residual enthalpy (J/kmol)
+     * @param sres   Output: residual entropy (J/kmol/K)
+     * @param cpres  Output: residual heat capacity at constant pressure
+     *               (J/kmol/K)
+     */
+    void residualProperties(doublereal T, doublereal P, doublereal V,
+                            doublereal a, doublereal dadt, doublereal d2adt2,
+                            doublereal b, doublereal& hres, doublereal& sres,
+                            doublereal& cpres) const;
+
+protected:
+    //! Value of b in the equation of state
+    mutable doublereal m_b_current;
+
+    //! Value of a in the equation of state
+    mutable doublereal m_a_current;
+
+    //! Critical temperatures of the species (K)
+    vector_fp m_tc_Species;
+
+    //! Critical pressures of the species (Pa)
+    vector_fp m_pc_Species;
+
+    //! Acentric factors of the species
+    vector_fp m_omega_Species;
+
+    //! Values of kappa of the species, computed from the acentric factors
+    vector_fp m_kappa;
+
+    //! Values of b of the species
+    vector_fp m_b_Species;
+
+    //! Constant part of \f$ \sqrt{a_i \alpha_i} = c_{0,i} + c_{1,i} \sqrt{T}
+    //! \f$ for each species
+    vector_fp m_sqrtAlpha0;
+
+    //! Coefficient of \f$ \sqrt{T} \f$ in \f$ \sqrt{a_i \alpha_i} \f$
+    vector_fp m_sqrtAlpha1;
+
+    //! Indices of the pairs of species with a nonzero binary interaction
+    //! parameter
+    std::vector<size_t> m_pairI, m_pairJ;
+
+    //! Binary interaction parameters of the pairs in m_pairI, m_pairJ
+    vector_fp m_pairKij;
+
+    //! Temperature and mole fractions for which the mixing terms were last
+    //! computed
+    mutable doublereal m_mixTemp;
+    mutable vector_fp m_mixMoleFractions;
+
+    //! Derivatives of a with respect to T at the current state
+    mutable doublereal m_dadt_current, m_d2adt2_current;
+
+    //! \f$ \sqrt{a_i \alpha_i} \f$ and its temperature derivative for each
+    //! species at the current temperature
+    mutable vector_fp m_sqrtAlpha;
+    mutable vector_fp m_dsqrtAlpha;
+
+    //! Mole fractions for which the critical properties were last computed
+    mutable vector_fp m_critMoleFractions;
+
+    //! Critical temperature, pressure and molar volume of the mixture
+    mutable doublereal m_tc_mix, m_pc_mix, m_vc_mix;
+
+    int NSolns_;
+
+    doublereal Vroot_[3];
+
+    //! Temporary storage - length = m_kk.
+    mutable vector_fp m_pp;
+
+    //! Temporary storage - length = m_kk.
+    mutable vector_fp m_tmpV;
+
+    // Partial molar volumes of the species
+    mutable vector_fp m_partialMolarVolumes;
+
+    //! The derivative of the pressure wrt the volume
+    mutable doublereal dpdV_;
+
+    //! The derivative of the pressure wrt the temperature
+    mutable doublereal dpdT_;
+
+    //! Vector of derivatives of pressure wrt mole number
+    mutable vector_fp dpdni_;
+
+public:
+    //! Omega constant for a, \f$ a_i = \Omega_a R^2 T_c^2 / P_c \f$
+    static const doublereal omega_a;
+
+    //! Omega constant for b, \f$ b_i = \Omega_b R T_c / P_c \f$
+    static const doublereal omega_b;
+
+    //! Critical compressibility factor
+    static const doublereal omega_vc;
+};
+}
+
+#endif
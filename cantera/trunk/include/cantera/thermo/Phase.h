@@ -27,6 +27,33 @@ namespace Cantera
  * support thermodynamic calculations (see \ref thermoprops).
  */
 
+//! A species composition with the species names resolved to indices
+/*!
+ * Created by Phase::compileComposition(). Setting the composition of a
+ * phase from a SparseComposition does not parse strings, look up species
+ * names or allocate memory, so it can be used to set the state of a phase
+ * repeatedly inside a loop. A SparseComposition may be used with the phase
+ * that created it, or with any phase that has the same species in the same
+ * order.
+ *
+ * @ingroup phases
+ */
+class SparseComposition
+{
+public:
+    SparseComposition() : nSpecies(0) {}
+
+    //! Number of species in the phase the composition was compiled for
+    size_t nSpecies;
+
+    //! Indices of the species included in the composition
+    std::vector<size_t> index;
+
+    //! Mole or mass fractions of the species in #index, which do not need
+    //! to be normalized
+    vector_fp value;
+};
+
 //! Class Phase is the base class for phases of matter, managing the species and elements in a phase, as well as the
 //! independent variables of temperature, mass density, species mass/mole fraction,
 //! and other generalized forces and intrinsic properties (such as electric potential)
@@ -327,6 +354,48 @@ public:
     //!     @param x String containing a composition map
     void setMassFractionsByName(const std::string& x);
 
+    //! Resolve the species names in a composition map to species indices.
+    //! Species that are not in the phase are ignored, as are species with
+    //! a value of zero.
+    //!     @param comp map from species names to mole or mass fractions
+    //!     @return the composition in a form that can be used with
+    //!         setMoleFractions_Sparse() and setMassFractions_Sparse()
+    SparseComposition compileComposition(const compositionMap& comp) const;
+
+    //! Resolve the species names in a composition string to species
+    //! indices.
+    //!     @param comp string in the form of a composition map, e.g.
+    //!         "CH4:1, O2:2, N2:7.52". All species must be in the phase.
+    SparseComposition compileComposition(const std::string& comp) const;
+
+    //! Set the mole fractions of the species listed in a SparseComposition
+    //! and normalize them. Species that are not listed are set to zero.
+    //!     @param x composition created by compileComposition()
+    void setMoleFractions_Sparse(const SparseComposition& x);
+
+    //! Set the mole fractions of a subset of the species and normalize
+    //! them. Species that are not listed are set to zero.
+    //!     @param nlist  Number of species listed
+    //!     @param index  Indices of the listed species, length nlist
+    //!     @param x      Unnormalized mole fractions of the listed species,
+    //!                   length nlist
+    void setMoleFractions_Sparse(size_t nlist, const size_t* index,
+                                 const doublereal* x);
+
+    //! Set the mass fractions of the species listed in a SparseComposition
+    //! and normalize them. Species that are not listed are set to zero.
+    //!     @param y composition created by compileComposition()
+    void setMassFractions_Sparse(const SparseComposition& y);
+
+    //! Set the mass fractions of a subset of the species and normalize
+    //! them. Species that are not listed are set to zero.
+    //!     @param nlist  Number of species listed
+    //!     @param index  Indices of the listed species, length nlist
+    //!     @param y      Unnormalized mass fractions of the listed species,
+    //!                   length nlist
+    void setMassFractions_Sparse(size_t nlist, const size_t* index,
+                                 const doublereal* y);
+
     //! Set the internally stored temperature (K), density, and mole fractions.
     //!     @param t     Temperature in kelvin
     //!     @param dens  Density (kg/m^3)
@@ -810,6 +879,22 @@ public:
         return m_stateNum;
     }
 
+    //! Cached property values of the phase, e.g. to check the numbers of
+    //! cache hits and misses with ValueCache::hits() and ValueCache::misses()
+    const ValueCache& propertyCache() const {
+        return m_cache;
+    }
+
+    //! Discard all cached property values.
+    /*!
+     * This must be called after changing parameters which affect the
+     * properties other than the temperature, density or composition, so that
+     * the properties are recomputed.
+     */
+    void invalidateCache() {
+        m_cache.clear();
+    }
+
 protected:
     //! Cached for saved calculations within each ThermoPhase.
     /*!
@@ -849,6 +934,9 @@ protected:
     UndefElement::behavior m_undefinedElementBehavior;
 
 private:
+    //! Reset the entries of #m_sparseWork set by a sparse composition setter
+    void clearSparseWork(size_t nlist, const size_t* index);
+
     XML_Node* m_xml; //!< XML node containing the XML info for this phase
 
     //! ID of the phase. This is the value of the ID attribute of the XML
@@ -884,6 +972,10 @@ private:
 
     vector_fp m_rmolwts; //!< inverse of species molecular weights (kmol kg-1)
 
+    //! Work array used by the sparse composition setters. All of its
+    //! elements are zero between calls. Length is m_kk.
+    vector_fp m_sparseWork;
+
     //! State Change variable. Whenever the mole fraction vector changes,
     //! this int is incremented.
     int m_stateNum;
@@ -115,6 +115,39 @@ public:
     /// Molar heat capacity at constant volume. Units: J/kmol/K.
     virtual doublereal cv_mole() const;
 
+    //! Compute the density and the mass-specific properties of the mixture
+    //! at many states.
+    /*!
+     * The reference-state properties of the species are computed for all
+     * temperatures together using SpeciesThermo::updateMany(), and the
+     * molar volume of each state is found directly from the roots of the
+     * cubic equation of state, without setting the state of the phase. The
+     * state of the phase is not changed.
+     *
+     * Where the equation of state has both a liquid-like and a gas-like
+     * root, the one with the lower Gibbs function is used. This may differ
+     * from setState_TP(), which stays on the branch of the previous state.
+     *
+     * @param nStates Number of states
+     * @param T       Temperatures (K) (length nStates)
+     * @param P       Pressures (Pa) (length nStates). If null, the current
+     *                pressure is used for all states.
+     * @param Y       Mass fractions, with the mass fraction of species k in
+     *                state i at position i*nSpecies() + k. If null, the
+     *                current composition is used for all states, and the
+     *                mixing terms of the equation of state are computed only
+     *                once. The mass fractions should sum to one.
+     * @param rho     Output: density (kg/m^3) (length nStates)
+     * @param cp      Output: heat capacity at constant pressure (J/kg/K)
+     *                (length nStates)
+     * @param h       Output: enthalpy (J/kg) (length nStates)
+     * @param s       Output: entropy (J/kg/K) (length nStates). Optional.
+     */
+    void getMassProperties(size_t nStates, const doublereal* T,
+                           const doublereal* P, const doublereal* Y,
+                           doublereal* rho, doublereal* cp, doublereal* h,
+                           doublereal* s = 0) const;
+
     //! @}
     //! @name Mechanical Properties
     //! @{
@@ -596,9 +629,26 @@ public:
     /*!
      *  The a and the b parameters depend on the mole fraction and the temperature.
      *  This function updates the internal numbers based on the state of the object.
+     *  The sums over species pairs are only recomputed when the mole
+     *  fractions or the temperature have changed; see updateMixingCoeffs().
      */
     void updateAB();
 
+    //! Update the composition-dependent mixing terms of a and b
+    /*!
+     *  Since each a_ij is a linear function of the temperature, the mixture
+     *  value of a is a0_mix + aT_mix * T, where a0_mix and aT_mix are sums
+     *  over the species pairs which only depend on the mole fractions. These
+     *  sums and b_mix are recomputed only if the mole fractions differ from
+     *  the ones used for the last evaluation, so that a change of the
+     *  temperature alone takes constant time. The critical properties of
+     *  the mixture are invalidated at the same time.
+     */
+    void updateMixingCoeffs() const;
+
+    //! Update the cached critical properties of the mixture
+    void updateCriticalConditions() const;
+
     //!  Calculate the a and the b parameters given the temperature
     /*!
      *  This function doesn't change the internal state of the object, so it is a const
@@ -631,6 +681,27 @@ public:
     int NicholsSolve(double TKelvin, double pres, doublereal a, doublereal b,
                      doublereal Vroot[3]) const;
 
+    //! Calculate the departure functions at a given state
+    /*!
+     * The expressions are the same as those used by hresid(), sresid() and
+     * cp_mole(), but all of the parameters are given explicitly.
+     *
+     * @param T     Temperature (K)
+     * @param P     Pressure (Pa)
+     * @param V     Molar volume (m^3/kmol)
+     * @param a     Value of a at T
+     * @param dadt  Derivative of a with respect to T
+     * @param b     Value of b
+     * @param hres  Output: residual enthalpy (J/kmol)
+     * @param sres  Output: residual entropy (J/kmol/K)
+     * @param cpres Output: residual heat capacity at constant pressure
+     *              (J/kmol/K)
+     */
+    void residualProperties(doublereal T, doublereal P, doublereal V,
+                            doublereal a, doublereal dadt, doublereal b,
+                            doublereal& hres, doublereal& sres,
+                            doublereal& cpres) const;
+
 protected:
     //! boolean indicating whether standard mixing rules are applied
     /*!
@@ -663,6 +734,28 @@ protected:
 
     Array2D  a_coeff_vec;
 
+    //! Temperature at which a_vec_Curr_ was last evaluated. Negative if it
+    //! needs to be evaluated.
+    doublereal m_aTemp;
+
+    //! Mole fractions for which the mixing terms were last computed
+    mutable vector_fp m_mixMoleFractions;
+
+    //! Mixture sum of the constant parts of a_ij
+    mutable doublereal m_a0_mix;
+
+    //! Mixture sum of the temperature coefficients of a_ij. This is da/dT.
+    mutable doublereal m_aT_mix;
+
+    //! Mixture value of b
+    mutable doublereal m_b_mix;
+
+    //! True if the cached critical properties are current
+    mutable bool m_critValid;
+
+    //! Critical temperature, pressure and molar volume of the mixture
+    mutable doublereal m_tc_mix, m_pc_mix, m_vc_mix;
+
     vector_fp m_pc_Species;
     vector_fp m_tc_Species;
     vector_fp m_vc_Species;
@@ -10,6 +10,7 @@
 #define CT_SPECIESTHERMO_H
 
 #include "cantera/base/ct_defs.h"
+#include "cantera/base/ctexceptions.h"
 
 namespace Cantera
 {
@@ -156,7 +157,7 @@ class SpeciesThermo
 public:
 
     //! Constructor
-    SpeciesThermo() {}
+    SpeciesThermo() : m_revision(0) {}
 
     //! Destructor
     virtual ~SpeciesThermo() {}
@@ -217,6 +218,29 @@ public:
     virtual void update(doublereal T, doublereal* cp_R,
                         doublereal* h_RT, doublereal* s_R) const=0;
 
+    //! Compute the reference-state properties for all species at many
+    //! temperatures.
+    /*!
+     * The properties of species k at temperature T[i] are stored at position
+     * i*ld + k of each array. The default treatment is to call update() for
+     * each temperature.
+     *
+     * @param nStates Number of temperatures
+     * @param T       Temperatures (Kelvin) (length nStates)
+     * @param ld      Distance between the properties at consecutive
+     *                temperatures in the output arrays; at least m_kk.
+     * @param cp_R    Dimensionless heat capacities (length nStates*ld)
+     * @param h_RT    Dimensionless enthalpies (length nStates*ld)
+     * @param s_R     Dimensionless entropies (length nStates*ld)
+     */
+    virtual void updateMany(size_t nStates, const doublereal* T, size_t ld,
+                            doublereal* cp_R, doublereal* h_RT,
+                            doublereal* s_R) const {
+        for (size_t i = 0; i < nStates; i++) {
+            update(T[i], cp_R + i*ld, h_RT + i*ld, s_R + i*ld);
+        }
+    }
+
     //! Like update(), but only updates the single species k.
     /*!
      *  The default treatment is to just call update() which means that
@@ -235,6 +259,39 @@ public:
         update(T, cp_R, h_RT, s_R);
     }
 
+    //! Compute the coefficients of the polynomials for a mixture.
+    /*!
+     * If the reference-state properties of all species are polynomials in
+     * temperature, the weighted sums of the properties over all species are
+     * polynomials with the same form, whose coefficients are the weighted
+     * sums of the species coefficients. These can be evaluated with
+     * evalMixture() at a cost which does not depend on the number of
+     * species, e.g. when solving for the temperature of a mixture with a
+     * given enthalpy.
+     *
+     * @param x       Weight of each species (length m_kk)
+     * @param coeffs  Output: coefficients of the mixture polynomials
+     * @return  False if the species parameterizations do not support
+     *          this, in which case *coeffs* is not set. The base class
+     *          returns false.
+     */
+    virtual bool getMixtureCoeffs(const doublereal* x, vector_fp& coeffs) const {
+        return false;
+    }
+
+    //! Evaluate the mixture polynomials computed by getMixtureCoeffs().
+    /*!
+     * @param coeffs  Coefficients from getMixtureCoeffs()
+     * @param T       Temperature (Kelvin)
+     * @param cp_R    Output: weighted sum of the dimensionless heat
+     *                capacities
+     * @param h_RT    Output: weighted sum of the dimensionless enthalpies
+     */
+    virtual void evalMixture(const vector_fp& coeffs, doublereal T,
+                             doublereal& cp_R, doublereal& h_RT) const {
+        throw NotImplementedError("SpeciesThermo::evalMixture");
+    }
+
     //! Minimum temperature.
     /*!
      * If no argument is supplied, this method returns the minimum temperature
@@ -318,7 +375,18 @@ public:
     //! Check if data for all species (0 through nSpecies-1) has been installed.
     bool ready(size_t nSpecies);
 
+    //! A number which changes whenever the species parameterizations may
+    //! have been modified, e.g. by modifyOneHf298(). Values derived from the
+    //! species parameters, such as the coefficients from getMixtureCoeffs(),
+    //! can be cached against it.
+    int revision() const {
+        return m_revision;
+    }
+
 protected:
+    //! Incremented when the species parameterizations change. See revision().
+    int m_revision;
+
     //! Mark species *k* as having its thermodynamic data installed
     void markInstalled(size_t k);
 
@@ -190,6 +190,7 @@ public:
     virtual void modifyOneHf298SS(const size_t k, const doublereal Hf298New) {
         m_spthermo->modifyOneHf298(k, Hf298New);
         m_tlast += 0.0001234;
+        invalidateCache();
     }
 
     //! Maximum temperature for which the thermodynamic data for the species
@@ -979,6 +980,18 @@ public:
      */
     virtual void setState_TPX(doublereal t, doublereal p, const std::string& x);
 
+    //! Set the temperature (K), pressure (Pa), and mole fractions.
+    /*!
+     * Note, the mole fractions are set first before the pressure is set.
+     * Setting the pressure may involve the solution of a nonlinear equation.
+     *
+     * @param t    Temperature (K)
+     * @param p    Pressure (Pa)
+     * @param x    Mole fractions created by compileComposition(). Species
+     *             not in the composition are set to zero mole fraction
+     */
+    virtual void setState_TPX(doublereal t, doublereal p, const SparseComposition& x);
+
     //! Set the internally stored temperature (K), pressure (Pa), and mass fractions of the phase.
     /*!
      * Note, the mass fractions are set first before the pressure is set.
@@ -1015,6 +1028,18 @@ public:
      */
     virtual void setState_TPY(doublereal t, doublereal p, const std::string& y);
 
+    //! Set the internally stored temperature (K), pressure (Pa), and mass fractions of the phase
+    /*!
+     * Note, the mass fractions are set first before the pressure is set.
+     * Setting the pressure may involve the solution of a nonlinear equation.
+     *
+     * @param t    Temperature (K)
+     * @param p    Pressure (Pa)
+     * @param y    Mass fractions created by compileComposition(). Species
+     *             not in the composition are set to zero mass fraction
+     */
+    virtual void setState_TPY(doublereal t, doublereal p, const SparseComposition& y);
+
     //! Set the temperature (K) and pressure (Pa)
     /*!
      * Setting the pressure may involve the solution of a nonlinear equation.
@@ -16,6 +16,8 @@
 
 namespace Cantera
 {
+class WaterPropsIAPWSTable;
+
 /**
  *  @name Names for the phase regions
  *
@@ -234,6 +236,10 @@ public:
      * WaterPropsIAPWSphi::dfind(), which does the iterative calculation to
      * find the density condition that matches the desired input pressure.
      *
+     * If useDensityTable() has been called and the liquid phase is
+     * requested, the density is interpolated from a table instead when the
+     * state is within it. The density guess is then not used.
+     *
      *  @param  temperature: Kelvin
      *  @param  pressure   : Pressure in Pascals (Newton/m**2)
      *  @param  phase      : guessed phase of water
@@ -275,6 +281,31 @@ public:
      */
     doublereal density_const(doublereal pressure, int phase = -1, doublereal rhoguess = -1.0) const;
 
+    //! Use a table to find the density of liquid water
+    /*!
+     * If *flag* is true, density() and density_const() interpolate the
+     * density of liquid water from the table returned by
+     * WaterPropsIAPWSTable::liquidTable() instead of solving the equation of
+     * state iteratively. This is done only when the phase is given as
+     * WATER_LIQUID and the state is in the part of the table that is
+     * entirely in the liquid region; otherwise, the exact calculation is
+     * used. All properties are then evaluated exactly at the interpolated
+     * density. The relative error of the density is below 5.0E-8. See
+     * WaterPropsIAPWSTable for details.
+     *
+     * The table is computed on the first call with *flag* true, which takes
+     * a fraction of a second, and is shared by all objects.
+     *
+     * @param flag  True to use the table; false to always use the exact
+     *              calculation (the default).
+     */
+    void useDensityTable(bool flag = true);
+
+    //! Returns true if a table is used to find the density of liquid water
+    bool usingDensityTable() const {
+        return m_table != 0;
+    }
+
     //! Returns the density (kg m-3)
     /*!
      * The density is an independent variable in the underlying equation of state
@@ -462,6 +493,10 @@ private:
 
     //! Current state of the system
     mutable int iState;
+
+    //! Table of the liquid density used by density(), or 0 to always use
+    //! the exact calculation
+    const WaterPropsIAPWSTable* m_table;
 };
 
 }
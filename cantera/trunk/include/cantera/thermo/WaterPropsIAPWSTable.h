@@ -0,0 +1,115 @@
+/**
+ * @file WaterPropsIAPWSTable.h
+ * Header for a table of the density of liquid water computed from the IAPWS
+ * 1995 Formulation (see class
+ * \link Cantera::WaterPropsIAPWSTable WaterPropsIAPWSTable\endlink).
+ */
+#ifndef WATERPROPSIAPWSTABLE_H
+#define WATERPROPSIAPWSTABLE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/ct_thread.h"
+
+namespace Cantera
+{
+
+//! Table of the density of liquid water as a function of temperature and
+//! pressure.
+/*!
+ * Finding the density of water at a given temperature and pressure with
+ * WaterPropsIAPWS::density() requires an iterative solution of the IAPWS-95
+ * equation of state, each iteration of which evaluates all of the terms of
+ * the residual Helmholtz free energy. Once the density is known, the other
+ * properties are evaluated directly from the equation of state, so this
+ * iteration dominates the cost of setting the state of a liquid water
+ * object.
+ *
+ * This class tabulates the exact liquid density on a uniform grid in the
+ * temperature and in the logarithm of the pressure, and interpolates it with
+ * bicubic Hermite polynomials. At each node, the derivatives of the density
+ * with respect to T and ln(P) are computed exactly from the equation of
+ * state. The mixed derivative is computed by differentiating the exact
+ * d(rho)/d(ln P) at nearby temperatures. The interpolant is therefore
+ * continuous, with continuous first derivatives, over the whole table.
+ *
+ * The saturation curve crosses the table. A node is stored only if its
+ * pressure is above the saturation pressure at its temperature, and a cell
+ * is used only if all four of its nodes are stored. Since the saturation
+ * pressure increases with temperature, every point of a usable cell is in
+ * the stable liquid region. For points in cells that straddle the
+ * saturation curve, and for points outside of the table, liquidDensity()
+ * returns -1, and the caller must fall back to the exact calculation.
+ *
+ * The shared table returned by liquidTable() has steps of 2.5 K and of 1/20
+ * of a decade in pressure. Its relative error in the density is below 1.0E-8
+ * up to 573 K, and below 5.0E-8 up to the end of the table at 598.16 K. In
+ * terms of the pressure, the error of the equation of state at the
+ * interpolated density is below 10 Pa. About 2% of the liquid states within
+ * the range of the table are in cells that straddle the saturation curve.
+ * Closer to the critical point, the liquid becomes so compressible that a
+ * much finer grid would be needed for the same accuracy, so the table stops
+ * at 598.16 K.
+ *
+ * @ingroup thermoprops
+ */
+class WaterPropsIAPWSTable
+{
+public:
+    //! Constructor, which computes the table
+    /*!
+     * @param Tmin  Lowest temperature of the table (Kelvin)
+     * @param Tmax  Highest temperature of the table (Kelvin). Must be below
+     *              the critical temperature.
+     * @param nT    Number of temperature nodes
+     * @param Pmin  Lowest pressure of the table (Pascal)
+     * @param Pmax  Highest pressure of the table (Pascal)
+     * @param nP    Number of pressure nodes, spaced uniformly in ln(P)
+     */
+    WaterPropsIAPWSTable(doublereal Tmin, doublereal Tmax, size_t nT,
+                         doublereal Pmin, doublereal Pmax, size_t nP);
+
+    //! Table covering 273.16 K to 598.16 K and 1 kPa to 100 MPa, shared by
+    //! all WaterPropsIAPWS objects which use a table. It is computed on
+    //! the first call.
+    static const WaterPropsIAPWSTable& liquidTable();
+
+    //! Interpolated density of liquid water (kg m-3)
+    /*!
+     * @param temperature  Temperature (Kelvin)
+     * @param pressure     Pressure (Pascal)
+     * @return the density, or -1 if the point is outside of the table or in
+     *         a cell which is not completely in the liquid region.
+     */
+    doublereal liquidDensity(doublereal temperature,
+                             doublereal pressure) const;
+
+    //! Number of cells of the table that can be interpolated
+    size_t nValidCells() const;
+
+protected:
+    //! Lowest temperature and temperature step (Kelvin)
+    doublereal m_Tmin, m_dT;
+
+    //! Logarithm of the lowest pressure, and step in ln(P)
+    doublereal m_lnPmin, m_dlnP;
+
+    //! Number of temperature and pressure nodes
+    size_t m_nT, m_nP;
+
+    //! Density at each node, and its derivatives with respect to T, ln(P),
+    //! and T and ln(P). The values for temperature node i and pressure node j
+    //! are at position i*m_nP + j.
+    vector_fp m_rho, m_rho_T, m_rho_lnP, m_rho_TlnP;
+
+    //! Flag for each cell; nonzero if the cell can be interpolated. The flag
+    //! for the cell with lower corner at node (i, j) is at position
+    //! i*(m_nP-1) + j.
+    vector_int m_valid;
+
+private:
+    //! Protects the construction of the shared table
+    static mutex_t table_mutex;
+};
+
+}
+#endif
@@ -0,0 +1,242 @@
+/**
+ *  @file ClosedReactor.h
+ */
+
+#ifndef CT_CLOSEDREACTOR_H
+#define CT_CLOSEDREACTOR_H
+
+#include "cantera/numerics/FuncEval.h"
+#include "cantera/base/Array.h"
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class Integrator;
+
+//! A closed, homogeneous ideal gas reactor at constant volume or constant
+//! pressure.
+/*!
+ *  This is a streamlined alternative to an IdealGasReactor or
+ *  IdealGasConstPressureReactor in a ReactorNet for the common case of a
+ *  single adiabatic reactor without walls, inlets, outlets or surfaces, as
+ *  used for ignition delay calculations. The state vector is the temperature
+ *  followed by the mass fractions of all species. The total mass is constant,
+ *  as are the density (at constant volume) or the pressure (at constant
+ *  pressure).
+ *
+ *  The state of the phase is set directly from the state vector, without the
+ *  intermediate saved state and the evaluation of wall and flow terms done
+ *  by the general reactor classes. The linear systems arising in the
+ *  integrator are solved using GMRES, preconditioned with an approximate
+ *  Jacobian which is assembled from the rate constants and the species
+ *  thermodynamic properties instead of by finite differences. The
+ *  preconditioner neglects the dependence of the rate constants on the third
+ *  body concentrations, and the temperature derivatives are evaluated with
+ *  a single finite difference.
+ *
+ *  The phase must be an ideal gas, and its state is updated as the
+ *  integration proceeds.
+ *
+ *  For operator splitting schemes, where the chemistry in each cell of a
+ *  flow simulation is advanced over a short time step, integrateCells()
+ *  advances the states of many cells in one call. The reactor, its
+ *  integrator and their work arrays are reused for all cells, and if
+ *  enabled using setJacobianReuse(), the Jacobian evaluated for one cell is
+ *  used for the next cell if their states are similar. Since the Jacobian is
+ *  only used as a preconditioner, this affects the cost of the integration
+ *  but not the accuracy of the solution.
+ *
+ *  @code
+ *  IdealGasMix gas("gri30.xml", "gri30");
+ *  gas.setState_TPX(1200.0, OneAtm, "CH4:1, O2:2, N2:7.52");
+ *  ClosedReactor r(gas, gas, true);
+ *  r.advance(0.1);
+ *  @endcode
+ */
+class ClosedReactor : public FuncEval
+{
+public:
+    //! Create a reactor containing the phase *thermo* with the reactions
+    //! from *kin*, which must be defined on *thermo*.
+    /*!
+     *  @param thermo        The ideal gas phase
+     *  @param kin           Kinetics manager for the homogeneous reactions
+     *  @param constPressure If true, the reactor is at constant pressure.
+     *      Otherwise, the reactor is at constant volume.
+     */
+    ClosedReactor(ThermoPhase& thermo, Kinetics& kin,
+                  bool constPressure=false);
+    virtual ~ClosedReactor();
+
+    //! Returns true if the reactor is at constant pressure
+    bool constantPressure() const {
+        return m_constPressure;
+    }
+
+    //! Enable or disable the energy equation. If disabled, the temperature
+    //! is held constant.
+    void setEnergy(bool energy);
+
+    //! Returns true if the energy equation is enabled
+    bool energyEnabled() const {
+        return m_energy;
+    }
+
+    //! Set the relative and absolute tolerances of the integrator.
+    void setTolerances(doublereal rtol, doublereal atol);
+
+    //! Set the maximum time step. If not set, the maximum step is the
+    //! length of the first integration interval.
+    void setMaxTimeStep(doublereal maxstep);
+
+    //! Reuse the Jacobian from the end of the previous integration when
+    //! restarting from a similar state.
+    /*!
+     *  The states are similar if the temperatures and the densities
+     *  (constant volume) or pressures (constant pressure) differ by less than
+     *  the relative tolerance *tol*, and the mass fractions differ by less
+     *  than *tol*. A value of 0 disables reuse, which is the default.
+     */
+    void setJacobianReuse(doublereal tol);
+
+    //! Set the current time and restart the integration from the current
+    //! state of the phase. Must be called after the state of the phase is
+    //! changed externally.
+    void setInitialTime(doublereal time);
+
+    //! Current time [s]
+    doublereal time() const {
+        return m_time;
+    }
+
+    //! Advance the state of the reactor to *time*.
+    void advance(doublereal time);
+
+    //! Take a single internal time step toward *time*. The time after the
+    //! step is returned.
+    doublereal step(doublereal time);
+
+    //! Advance the states of *n* independent cells by the time step *dt*.
+    /*!
+     *  The cells are integrated in order, so that if Jacobian reuse is
+     *  enabled, ordering the cells such that neighboring cells have similar
+     *  states reduces the number of Jacobian evaluations. On return, the
+     *  phase is in the final state of the last cell.
+     *
+     *  @param n   Number of cells
+     *  @param dt  Time step [s]
+     *  @param T   Temperatures [K]. Overwritten with the final temperatures.
+     *      Length *n*.
+     *  @param P   Initial pressures [Pa]. Length *n*.
+     *  @param Y   Mass fractions, with the mass fractions for each cell
+     *      stored contiguously. Overwritten with the final mass fractions.
+     *      Length *n* * number of species.
+     */
+    virtual void integrateCells(size_t n, doublereal dt, doublereal* T,
+                                const doublereal* P, doublereal* Y);
+
+    //! The phase contained in the reactor
+    ThermoPhase& thermo() {
+        return *m_thermo;
+    }
+
+    //! Number of times the Jacobian has been evaluated since the reactor
+    //! settings were last changed
+    size_t nJacobianEvals() const {
+        return m_njac;
+    }
+
+    //! Number of times the Jacobian from a previous integration has been
+    //! reused since the reactor settings were last changed
+    size_t nJacobianReuses() const {
+        return m_nreuse;
+    }
+
+    // overloaded methods of class FuncEval
+    virtual size_t neq() {
+        return m_nv;
+    }
+    virtual void eval(doublereal t, doublereal* y,
+                      doublereal* ydot, doublereal* p);
+    virtual void getInitialConditions(doublereal t0, size_t leny,
+                                      doublereal* y);
+    virtual bool preconditionerSetup(double t, double* y, double* ydot,
+                                     bool reuseJacobian, double gamma);
+    virtual void preconditionerSolve(const double* rhs, double* output);
+
+protected:
+    //! Read the state of the phase and (re)initialize the integrator for an
+    //! integration ending at *tEnd*.
+    void initialize(doublereal tEnd);
+
+    //! Set the state of the phase to correspond to the state vector *y*.
+    void updateState(const doublereal* y);
+
+    //! Evaluate the approximate Jacobian at *y* and store it in m_jac.
+    /*!
+     *  @param t     time
+     *  @param y     state vector
+     *  @param ydot  right hand side evaluated at *y*
+     */
+    void evalJacobian(doublereal t, doublereal* y, const doublereal* ydot);
+
+    //! Returns true if the state *y* is close enough to the state at which
+    //! the Jacobian was evaluated for the Jacobian to be reused.
+    bool similarToJacobianState(const doublereal* y) const;
+
+    ThermoPhase* m_thermo;
+    Kinetics* m_kin;
+    Integrator* m_integ;
+    bool m_constPressure;
+    bool m_energy;
+    bool m_init; //!< true if the integrator settings are up to date
+    bool m_integrator_init; //!< true if the integrator has been initialized
+
+    size_t m_nsp; //!< Number of species
+    size_t m_nv; //!< Number of state variables, m_nsp + 1
+
+    //! Density [kg/m^3] (constant volume) or pressure [Pa] (constant
+    //! pressure), which is held constant
+    doublereal m_rho, m_pressure;
+
+    doublereal m_time;
+    doublereal m_rtol, m_atol, m_maxstep;
+
+    //! @name Reaction stoichiometry, used to assemble the Jacobian
+    //! For each reaction, the species indices and stoichiometric
+    //! coefficients of the reactants and products, and the species indices
+    //! and net stoichiometric coefficients of all participating species.
+    //! @{
+    std::vector<std::vector<size_t> > m_rkIndex, m_pkIndex, m_netIndex;
+    std::vector<vector_fp> m_rkStoich, m_pkStoich, m_netStoich;
+    //! @}
+
+    doublereal m_reuseTol; //!< Tolerance for reusing the Jacobian
+    bool m_restarted; //!< true until the first setup after a restart
+    bool m_jacValid; //!< true if m_jac has been evaluated
+    vector_fp m_yJac; //!< State at which m_jac was evaluated
+    //! Density or pressure at which m_jac was evaluated
+    doublereal m_fixedJac;
+
+    Array2D m_jac; //!< Approximate Jacobian of the governing equations
+    Array2D m_dwdc; //!< Derivatives of wdot_k with respect to C_j
+    Array2D m_precon; //!< Factored Newton matrix, I - gamma * J
+    vector_int m_pivots;
+    size_t m_njac;
+    size_t m_nreuse;
+
+    vector_fp m_wdot; //!< Species net molar production rates
+    vector_fp m_ek; //!< Species molar enthalpies / RT
+    vector_fp m_cpk; //!< Species molar heat capacities / R
+    vector_fp m_conc, m_kf, m_kr, m_ydot;
+
+private:
+    ClosedReactor(const ClosedReactor&);
+    ClosedReactor& operator=(const ClosedReactor&);
+};
+
+}
+
+#endif
@@ -42,6 +42,10 @@ public:
     //! component named *nm*. Possible values for *nm* are "m", "H", the name
     //! of a homogeneous phase species, or the name of a surface species.
     virtual size_t componentIndex(const std::string& nm) const;
+
+protected:
+    virtual void getProductionRateAdjoint(const doublereal* lambda,
+                                          doublereal* mu);
 };
 
 }
@@ -59,6 +59,9 @@ public:
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
+    virtual void getProductionRateAdjoint(const doublereal* lambda,
+                                          doublereal* mu);
+
     doublereal m_speed, m_dist, m_T;
     doublereal m_fctr;
     doublereal m_rho0, m_speed0, m_P0, m_h0;
@@ -0,0 +1,221 @@
+/**
+ *  @file ISATReactor.h
+ */
+
+#ifndef CT_ISATREACTOR_H
+#define CT_ISATREACTOR_H
+
+#include "ClosedReactor.h"
+
+namespace Cantera
+{
+
+//! A ClosedReactor which tabulates its chemistry substeps using in situ
+//! adaptive tabulation (ISAT).
+/*!
+ *  In operator splitting schemes for reacting flows, the chemistry in each
+ *  cell is advanced over a time step from a given initial state, and many
+ *  cells present nearly identical problems. The ISAT algorithm (S. B. Pope,
+ *  Combust. Theory Modelling 1:41-63, 1997) stores the results of previous
+ *  integrations and reuses them for nearby initial states.
+ *
+ *  Each query is a point
+ *  \f$ x = (T/T_s, Y_1, \ldots, Y_K, \ln F, \ln \Delta t) \f$, where
+ *  \f$ T_s \f$ is the temperature scale, \f$ F \f$ is the pressure
+ *  (constant pressure reactors) or the density (constant volume reactors)
+ *  and \f$ \Delta t \f$ is the time step. The result of the query is the
+ *  scaled state \f$ R(x) = (T/T_s, Y_1, \ldots, Y_K) \f$ at the end of the
+ *  time step. Each record of the table stores a point \f$ x_0 \f$, the
+ *  mapping \f$ R(x_0) \f$, the mapping gradient \f$ A = \partial R /
+ *  \partial x \f$ and an ellipsoid of accuracy (EOA) around \f$ x_0 \f$,
+ *  within which the linear approximation \f$ R(x) \approx R(x_0) +
+ *  A (x - x_0) \f$ is expected to have an error less than the tolerance.
+ *  The records are the leaves of a binary tree with cutting planes between
+ *  them. For each query:
+ *
+ *  - If the query point is within the EOA of the record found by traversing
+ *    the tree or of one of the most recently used records, the result is
+ *    retrieved by linear approximation.
+ *  - Otherwise, the state is integrated directly. If the error of the linear
+ *    approximation from the record found in the tree is within the
+ *    tolerance, its EOA is grown to include the query point. Otherwise, a new
+ *    record is added.
+ *
+ *  The mapping gradient is approximated by \f$ A = (I - \Delta t J)^{-1} \f$
+ *  using the approximate Jacobian \f$ J \f$ of the reactor at the end of
+ *  the time step, as in an implicit Euler step, and the initial EOA is the
+ *  region where \f$ |A (x - x_0)| \f$ is less than the tolerance. Errors
+ *  of the linear approximation can be monitored by checking a fraction of
+ *  the retrievals against direct integration, see setErrorCheckInterval().
+ */
+class ISATReactor : public ClosedReactor
+{
+public:
+    //! Create a tabulating reactor. The arguments are the same as for
+    //! ClosedReactor.
+    ISATReactor(ThermoPhase& thermo, Kinetics& kin, bool constPressure=false);
+    virtual ~ISATReactor();
+
+    //! Set the error tolerance for the scaled state (default 1e-4).
+    //! Clears the table.
+    void setTolerance(doublereal tol);
+
+    //! Set the temperature scale [K] used to scale the temperature relative to
+    //! the mass fractions (default 1000 K). Clears the table.
+    void setTemperatureScale(doublereal Tscale);
+
+    //! Set the maximum number of records in the table (default 1000). Once
+    //! the table is full, queries which cannot be retrieved are integrated
+    //! directly.
+    void setMaxRecords(size_t n);
+
+    //! Check every *n*th retrieval against a direct integration to collect
+    //! error statistics. If 0 (default), no checks are done.
+    void setErrorCheckInterval(size_t n);
+
+    //! Remove all records from the table and reset the statistics.
+    void clear();
+
+    //! Advance the current state of the phase by the time step *dt*, using
+    //! the table if possible.
+    void substep(doublereal dt);
+
+    //! Advance the states of *n* independent cells by the time step *dt*,
+    //! using the table if possible. See ClosedReactor::integrateCells.
+    virtual void integrateCells(size_t n, doublereal dt, doublereal* T,
+                                const doublereal* P, doublereal* Y);
+
+    //! @name Statistics
+    //! @{
+
+    //! Number of records in the table
+    size_t nRecords() const {
+        return m_records.size();
+    }
+
+    //! Number of queries since the table was last cleared
+    size_t nQueries() const {
+        return m_nquery;
+    }
+
+    //! Number of queries resolved by retrieval from the table
+    size_t nRetrieves() const {
+        return m_nretrieve;
+    }
+
+    //! Number of queries which were integrated directly and grew the EOA of
+    //! an existing record
+    size_t nGrows() const {
+        return m_ngrow;
+    }
+
+    //! Number of queries which were integrated directly and added a record
+    size_t nAdds() const {
+        return m_nadd;
+    }
+
+    //! Number of queries which were integrated directly without modifying
+    //! the table because it was full
+    size_t nDirect() const {
+        return m_ndirect;
+    }
+
+    //! Number of retrievals which were checked against direct integration
+    size_t nErrorChecks() const {
+        return m_ncheck;
+    }
+
+    //! Maximum error of the checked retrievals, in the scaled state
+    doublereal maxError() const {
+        return m_maxError;
+    }
+
+    //! Mean error of the checked retrievals, in the scaled state
+    doublereal meanError() const {
+        return (m_ncheck) ? m_sumError / m_ncheck : 0.0;
+    }
+
+    //! Depth of the binary tree
+    size_t treeDepth() const;
+    //! @}
+
+protected:
+    //! A record of the table
+    struct Record {
+        vector_fp x; //!< Query point
+        vector_fp r; //!< Mapping at the query point
+        Array2D A; //!< Mapping gradient
+        Array2D G; //!< The EOA is the set of points where |G (x - x0)| <= 1
+    };
+
+    //! A node of the binary tree. Leaves refer to a record, and other nodes
+    //! have a cutting plane v . x = a and two children.
+    struct Node {
+        vector_fp v;
+        doublereal a;
+        size_t left; //!< child for points with v . x <= a
+        size_t right; //!< child for points with v . x > a
+        size_t record; //!< record index for leaves, or npos
+    };
+
+    //! Set the query point corresponding to the state of the phase in m_x
+    void getQueryPoint(doublereal dt);
+
+    //! Find the leaf of the tree containing the point m_x. Returns npos if
+    //! the table is empty.
+    size_t findLeaf() const;
+
+    //! Check whether m_x is within the EOA of record *i*. Sets m_dx.
+    bool inEOA(size_t i);
+
+    //! Set m_r to the linear approximation of the mapping from record *i*,
+    //! using m_dx as computed by inEOA().
+    void linearApprox(size_t i);
+
+    //! Integrate the query directly. The scaled result is stored in m_r.
+    void integrate(doublereal dt);
+
+    //! Set the state of the phase from the scaled state *r* and the fixed
+    //! pressure or density of the query.
+    void setStateFromScaled(const doublereal* r);
+
+    //! Grow the EOA of record *i* to include m_x.
+    void grow(size_t i);
+
+    //! Add a record for the query m_x with the result m_r, replacing the leaf
+    //! *leaf* of the tree. Requires the phase to be in the final state of
+    //! the direct integration.
+    void add(size_t leaf, doublereal dt);
+
+    //! Mark record *i* as most recently used
+    void touch(size_t i);
+
+    //! Depth of the subtree starting at *node*
+    size_t depth(size_t node) const;
+
+    doublereal m_tol; //!< Error tolerance
+    doublereal m_Tscale; //!< Temperature scale
+    size_t m_maxRecords;
+    size_t m_checkInterval;
+
+    std::vector<Record*> m_records;
+    std::vector<Node> m_nodes; //!< Nodes of the tree. The root is node 0.
+
+    //! Indices of the most recently used records, most recent first
+    std::vector<size_t> m_mru;
+
+    size_t m_nx; //!< Length of the query point, m_nv + 2
+    doublereal m_fixed; //!< Pressure or density of the current query
+
+    //! Work arrays
+    vector_fp m_x, m_dx, m_r, m_rcheck, m_z, m_f, m_f1;
+    Array2D m_work;
+
+    size_t m_nquery, m_nretrieve, m_ngrow, m_nadd, m_ndirect;
+    size_t m_ncheck;
+    doublereal m_maxError, m_sumError;
+};
+
+}
+
+#endif
@@ -46,6 +46,9 @@ public:
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
+    virtual void getProductionRateAdjoint(const doublereal* lambda,
+                                          doublereal* mu);
+
     vector_fp m_hk; //!< Species molar enthalpies
 };
 }
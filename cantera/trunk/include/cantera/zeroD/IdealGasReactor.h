@@ -41,6 +41,9 @@ public:
     virtual size_t componentIndex(const std::string& nm) const;
 
 protected:
+    virtual void getProductionRateAdjoint(const doublereal* lambda,
+                                          doublereal* mu);
+
     vector_fp m_uk; //!< Species molar internal energies
 };
 
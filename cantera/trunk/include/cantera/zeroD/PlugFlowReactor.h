@@ -0,0 +1,264 @@
+/**
+ *  @file PlugFlowReactor.h
+ */
+
+#ifndef CT_PLUGFLOWREACTOR_H
+#define CT_PLUGFLOWREACTOR_H
+
+#include "cantera/numerics/ResidJacEval.h"
+#include "cantera/base/Array.h"
+
+namespace Cantera
+{
+
+class ThermoPhase;
+class Kinetics;
+class InterfaceKinetics;
+class SurfPhase;
+class DAE_Solver;
+
+//! A steady, one-dimensional plug flow reactor with gas phase and surface
+//! reactions, integrated in the axial direction as a system of differential
+//! algebraic equations.
+/*!
+ *  The reactor is a channel of constant cross-sectional area with reacting
+ *  walls, such as a channel of a catalytic monolith. The flow is inviscid
+ *  and adiabatic. The reacting surfaces are at the gas temperature, and the
+ *  heat released by the surface reactions is transferred to the gas. The
+ *  surface species are assumed to be in a quasi-steady state.
+ *
+ *  The solution vector is \f$ y = (u, \rho, P, T, Y_1, \ldots, Y_K,
+ *  \theta_1, \ldots) \f$, where \f$ \theta \f$ are the coverages of the
+ *  species of each surface, and the residual equations are, with \f$ y' =
+ *  dy/dz \f$:
+ *
+ *  \f[
+ *      u \rho' + \rho u' = \dot S
+ *  \f]
+ *  \f[
+ *      \rho u u' + P' = - u \dot S
+ *  \f]
+ *  \f[
+ *      P = \rho R T \sum_k Y_k / W_k
+ *  \f]
+ *  \f[
+ *      \rho u c_p T' + \rho u^2 u' = - \frac{u^2}{2} \dot S
+ *          - \sum_k \dot\omega_k h_k
+ *          - a \sum_{j} \dot s_j h_j
+ *  \f]
+ *  \f[
+ *      \rho u Y_k' = W_k (\dot\omega_k + a \dot s_k) - Y_k \dot S
+ *  \f]
+ *  \f[
+ *      \dot s_k = 0 \quad \mbox{for the surface species, except}
+ *      \quad \sum \theta_k = 1
+ *  \f]
+ *
+ *  where \f$ a \f$ is the surface area per unit volume,
+ *  \f$ \dot S = a \sum_k W_k \dot s_k \f$ is the net mass production rate
+ *  from the surfaces, \f$ \dot\omega_k \f$ and \f$ \dot s_k \f$ are the
+ *  molar production rates from the gas phase and surface reactions, and the
+ *  sum over \f$ j \f$ includes the species of all phases of each surface
+ *  kinetics manager. The equation for the first species of each surface is
+ *  replaced by the condition that the coverages sum to one. If the energy
+ *  equation is disabled, the temperature is constant.
+ *
+ *  The equations are integrated with the IDA solver from SUNDIALS, using a
+ *  Jacobian in which the derivatives with respect to \f$ y' \f$ are
+ *  evaluated analytically and those with respect to \f$ y \f$ by finite
+ *  differences. The gas phase production rates are not evaluated for the
+ *  columns of the velocity, pressure and coverages, which do not affect
+ *  them. The state of the gas phase and the surface phases is updated as the
+ *  integration proceeds.
+ *
+ *  @code
+ *  IdealGasMix gas("ptcombust.xml", "gas");
+ *  std::vector<ThermoPhase*> phases(1, &gas);
+ *  Interface surf("ptcombust.xml", "Pt_surf", phases);
+ *  gas.setState_TPX(900.0, OneAtm, "CH4:0.095, O2:0.21, AR:0.79");
+ *  PlugFlowReactor pfr(gas, gas);
+ *  pfr.addSurface(surf);
+ *  pfr.setSurfaceAreaToVolumeRatio(1000.0);
+ *  pfr.setMassFlowRate(0.1);
+ *  pfr.advance(0.05);
+ *  @endcode
+ */
+class PlugFlowReactor : public ResidJacEval
+{
+public:
+    //! Create a plug flow reactor for the ideal gas *thermo* with the
+    //! homogeneous reactions from *kin*, which must be defined on *thermo*.
+    //! The state of *thermo* when the reactor is initialized is the inlet
+    //! state.
+    PlugFlowReactor(ThermoPhase& thermo, Kinetics& kin);
+    virtual ~PlugFlowReactor();
+
+    //! Add the reactions of the surface kinetics manager *kin* to the
+    //! reactor walls. The first phase of *kin* must be the gas.
+    void addSurface(InterfaceKinetics& kin);
+
+    //! Number of surfaces
+    size_t nSurfaces() const {
+        return m_surf.size();
+    }
+
+    //! Set the cross-sectional area [m^2] (default 1 m^2).
+    void setArea(doublereal area);
+
+    //! Cross-sectional area [m^2]
+    doublereal area() const {
+        return m_area;
+    }
+
+    //! Set the area of the reacting surfaces per unit volume [1/m] (default
+    //! 0). For a channel, this is the perimeter divided by the
+    //! cross-sectional area.
+    void setSurfaceAreaToVolumeRatio(doublereal sv);
+
+    //! Area of the reacting surfaces per unit volume [1/m]
+    doublereal surfaceAreaToVolumeRatio() const {
+        return m_sv;
+    }
+
+    //! Set the mass flow rate [kg/s] at the inlet.
+    void setMassFlowRate(doublereal mdot);
+
+    //! The mass flow rate [kg/s] at the current position. This differs from
+    //! the inlet value if there is a net mass flux to the surfaces.
+    doublereal massFlowRate() const;
+
+    //! Enable or disable the energy equation. If disabled, the temperature is
+    //! held constant.
+    void setEnergy(bool energy);
+
+    //! True if the energy equation is enabled
+    bool energyEnabled() const {
+        return m_energy;
+    }
+
+    //! Set the relative and absolute tolerances of the integrator. A negative
+    //! value leaves the corresponding tolerance unchanged.
+    void setTolerances(doublereal rtol, doublereal atol);
+
+    //! Set the maximum step size [m] of the integrator. If not positive, the
+    //! step size is not limited.
+    void setMaxStepSize(doublereal dzmax);
+
+    //! Initialize the integrator at the axial position *z0* [m], taking the
+    //! current states of the gas phase and the surfaces as the inlet state.
+    //! The surface coverages are first brought to their steady state.
+    void initialize(doublereal z0 = 0.0);
+
+    //! Advance the solution to the axial position *z* [m]. Initializes the
+    //! integrator if necessary.
+    void advance(doublereal z);
+
+    //! Current axial position [m]
+    doublereal distance() const {
+        return m_z;
+    }
+
+    //! Gas velocity [m/s] at the current position
+    doublereal speed() const;
+
+    //! Index of the component named *name* in the solution vector: "velocity",
+    //! "density", "pressure", "temperature", the name of a gas species or
+    //! the name of a surface species. Returns npos if there is no such
+    //! component.
+    size_t componentIndex(const std::string& name) const;
+
+    //! The current solution vector
+    const doublereal* solution() const;
+
+    //! Number of times the Jacobian has been evaluated
+    size_t nJacobianEvals() const {
+        return m_njac;
+    }
+
+    virtual int evalResidNJ(const doublereal t, const doublereal delta_t,
+                            const doublereal* const y,
+                            const doublereal* const ydot,
+                            doublereal* const resid,
+                            const ResidEval_Type_Enum evalType = Base_ResidEval,
+                            const int id_x = -1,
+                            const doublereal delta_x = 0.0);
+
+    //! Set the initial solution from the current state of the gas phase and
+    //! the surfaces, and the initial derivatives consistent with it.
+    virtual int getInitialConditions(const doublereal t0,
+                                     doublereal* const y,
+                                     doublereal* const ydot);
+
+    virtual int evalJacobianDP(const doublereal t, const doublereal delta_t,
+                               doublereal cj,
+                               const doublereal* const y,
+                               const doublereal* const ydot,
+                               doublereal* const* jacobianColPts,
+                               doublereal* const resid);
+
+protected:
+    //! Set the states of the gas phase and the surfaces from *y*.
+    void updateState(const doublereal* y);
+
+    //! Evaluate the production rates and the properties needed by the
+    //! residual for the current states of the phases. The gas phase rates
+    //! and properties are only updated if *gas* is true.
+    void updateRates(bool gas);
+
+    //! Evaluate the residual using the rates from the last call to
+    //! updateRates().
+    void evalResid(const doublereal* y, const doublereal* ydot,
+                   doublereal* r) const;
+
+    //! Compute column *j* of the Jacobian with respect to *y* by a finite
+    //! difference, using the residual *resid* at *y*. The gas phase rates
+    //! are only updated if *gas* is true.
+    void jacobianColumn(size_t j, bool gas, const doublereal* y,
+                        const doublereal* ydot, const doublereal* resid,
+                        doublereal* col);
+
+    ThermoPhase* m_thermo;
+    Kinetics* m_kin;
+    DAE_Solver* m_solver;
+
+    std::vector<InterfaceKinetics*> m_surf;
+    std::vector<SurfPhase*> m_surfPhase;
+    std::vector<size_t> m_surfStart; //!< Offset of each surface in the solution
+    std::vector<size_t> m_surfLoc; //!< Index of the surface phase species in each kinetics manager
+
+    size_t m_nsp; //!< Number of gas species
+    doublereal m_area;
+    doublereal m_sv;
+    doublereal m_mdot;
+    bool m_energy;
+    bool m_init; //!< true if the integrator has been initialized
+    doublereal m_z;
+    doublereal m_rtol;
+    doublereal m_maxstep;
+    size_t m_njac;
+    vector_fp m_y; //!< Solution at the current position
+
+    //! @name Rates and properties evaluated by updateRates()
+    //! @{
+    vector_fp m_wdot; //!< Gas phase molar production rates
+    vector_fp m_hk; //!< Gas species molar enthalpies
+    doublereal m_cp; //!< Mass specific heat capacity of the gas
+    std::vector<vector_fp> m_sdot; //!< Production rates from each surface
+    std::vector<vector_fp> m_hs; //!< Molar enthalpies of the surface kinetics species
+    vector_fp m_sdotGas; //!< Sum of the gas production rates of all surfaces
+    doublereal m_qsurf; //!< Heat released by the surface reactions [W/m^2]
+    //! @}
+
+    //! Work arrays
+    vector_fp m_ywork, m_rwork;
+    Array2D m_icMatrix;
+    vector_int m_pivots;
+
+private:
+    PlugFlowReactor(const PlugFlowReactor&);
+    PlugFlowReactor& operator=(const PlugFlowReactor&);
+};
+
+}
+
+#endif
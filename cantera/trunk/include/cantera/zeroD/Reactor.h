@@ -146,7 +146,33 @@ public:
     //! name of a homogeneous phase species, or the name of a surface species.
     virtual size_t componentIndex(const std::string& nm) const;
 
+    //! Number of reactions in the homogeneous phase
+    size_t nReactions() const {
+        return m_kin ? m_kin->nReactions() : 0;
+    }
+
+    //! Evaluate the derivatives of the governing equations with respect to
+    //! the rate multipliers of the homogeneous phase reactions, weighted by
+    //! the adjoint variables *lambda*.
+    /*!
+     *  Used for adjoint sensitivity analysis. The state of the reactor must
+     *  have been set using updateState().
+     *
+     *  @param[in] lambda Adjoint variables, length neq()
+     *  @param[out] dfdk  \f$ \sum_n \lambda_n \partial \dot{y}_n /
+     *      \partial k_i \f$ for each reaction \f$ i \f$, where
+     *      \f$ k_i \f$ is the rate multiplier. Length nReactions().
+     */
+    virtual void evalReactionAdjoint(const doublereal* lambda,
+                                     doublereal* dfdk);
+
 protected:
+    //! Derivatives of \f$ \sum_n \lambda_n \dot{y}_n \f$ with respect to
+    //! the net molar production rates of the homogeneous phase species. Used
+    //! by evalReactionAdjoint().
+    virtual void getProductionRateAdjoint(const doublereal* lambda,
+                                          doublereal* mu);
+
     //! Set reaction rate multipliers based on the sensitivity variables in
     //! *params*.
     virtual void applySensitivity(double* params);
@@ -190,6 +216,8 @@ protected:
 
     vector_fp m_wdot; //!< Species net molar production rates
     vector_fp m_uk; //!< Species molar internal energies
+    vector_fp m_mu_adj; //!< Work array for evalReactionAdjoint()
+    vector_fp m_rop; //!< Net rates of progress, for evalReactionAdjoint()
     bool m_chem;
     bool m_energy;
     size_t m_nv;
@@ -0,0 +1,184 @@
+/**
+ *  @file ReactorEnsemble.h
+ */
+
+#ifndef CT_REACTORENSEMBLE_H
+#define CT_REACTORENSEMBLE_H
+
+#include "cantera/base/ct_defs.h"
+#include "cantera/base/ct_thread.h"
+
+namespace Cantera
+{
+
+class XML_Node;
+class ThermoPhase;
+class Kinetics;
+class ClosedReactor;
+
+//! Integrate a large number of independent, closed ideal gas reactors.
+/*!
+ *  Each member of the ensemble is a single ClosedReactor at constant volume
+ *  or constant pressure with its own initial temperature, pressure and
+ *  composition, as used for ignition delay or parameter maps. Instead of
+ *  creating a new reactor for each case, each worker owns one set of phase,
+ *  kinetics and reactor objects, which are reset to the next initial state
+ *  and reused.
+ *
+ *  If Cantera is built with thread safety enabled, the cases are divided
+ *  among a pool of worker threads. Each thread repeatedly claims the next
+ *  block of unprocessed cases from a shared counter, so that threads that
+ *  finish early continue with the remaining work. Otherwise, all cases are
+ *  integrated by a single worker in the calling thread.
+ *
+ *  Inputs and outputs are flat, row-major arrays, with one row per case.
+ *  Each row of output contains the temperature [K], the pressure [Pa] and
+ *  the mass fractions of all species.
+ *
+ *  @code
+ *  ReactorEnsemble ens("gri30.xml", "gri30", 4);
+ *  ens.integrate(n, T0, P0, Y0, 0.1, states);
+ *  @endcode
+ */
+class ReactorEnsemble
+{
+public:
+    //! Create the ensemble for the gas phase `id` defined in `infile`.
+    /*!
+     *  @param infile   Input file containing the phase definition
+     *  @param id       ID of the phase within the file
+     *  @param nThreads Number of worker threads. If 0, the number of
+     *      hardware threads is used. Always 1 if Cantera is not built
+     *      with thread safety enabled.
+     */
+    ReactorEnsemble(const std::string& infile, const std::string& id="",
+                    size_t nThreads=0);
+    ~ReactorEnsemble();
+
+    //! Number of species in the gas phase
+    size_t nSpecies() const {
+        return m_nsp;
+    }
+
+    //! Number of worker threads
+    size_t nThreads() const {
+        return m_workers.size();
+    }
+
+    //! Number of values describing the state of each reactor (T, P, Y_k)
+    size_t stateSize() const {
+        return m_nsp + 2;
+    }
+
+    //! Integrate at constant pressure instead of constant volume
+    void setConstantPressure(bool cp);
+
+    //! Enable or disable the energy equation
+    void setEnergy(bool energy);
+
+    //! Set the relative and absolute tolerances for the integrator.
+    void setTolerances(doublereal rtol, doublereal atol);
+
+    //! Set the maximum time step. If not set, the maximum step is the
+    //! length of the integration interval.
+    void setMaxTimeStep(doublereal maxstep);
+
+    //! Integrate each reactor from t = 0 to `tEnd`.
+    /*!
+     *  @param n      Number of reactors
+     *  @param T      Initial temperatures [K]. Length `n`.
+     *  @param P      Initial pressures [Pa]. Length `n`.
+     *  @param Y      Initial mass fractions. Length `n*nSpecies()`.
+     *  @param tEnd   End time [s]
+     *  @param states On return, the final state of each reactor. Length
+     *      `n*stateSize()`.
+     */
+    void integrate(size_t n, const doublereal* T, const doublereal* P,
+                   const doublereal* Y, doublereal tEnd,
+                   doublereal* states);
+
+    //! Integrate each reactor and sample the state at the specified times.
+    /*!
+     *  @param n      Number of reactors
+     *  @param T      Initial temperatures [K]. Length `n`.
+     *  @param P      Initial pressures [Pa]. Length `n`.
+     *  @param Y      Initial mass fractions. Length `n*nSpecies()`.
+     *  @param nTimes Number of output times
+     *  @param times  Increasing, positive output times [s]
+     *  @param states On return, the state of reactor `i` at time `j` is in
+     *      the row `i*nTimes + j`. Length `n*nTimes*stateSize()`.
+     */
+    void integrate(size_t n, const doublereal* T, const doublereal* P,
+                   const doublereal* Y, size_t nTimes,
+                   const doublereal* times, doublereal* states);
+
+    //! Number of reactors which could not be integrated during the last
+    //! call to integrate(). The output rows of these reactors are set to
+    //! NaN.
+    size_t nFailures() const {
+        return m_nfail;
+    }
+
+    //! Error message for the first reactor which could not be integrated
+    //! during the last call to integrate().
+    const std::string& firstError() const {
+        return m_firstError;
+    }
+
+private:
+    //! The objects used by one worker thread
+    struct Worker {
+        Worker() : thermo(0), kin(0), reactor(0) {}
+        ThermoPhase* thermo;
+        Kinetics* kin;
+        ClosedReactor* reactor;
+    };
+
+    //! Arguments of the current call to integrate()
+    struct Task {
+        size_t n;
+        const doublereal* T;
+        const doublereal* P;
+        const doublereal* Y;
+        size_t nTimes;
+        const doublereal* times;
+        doublereal* states;
+    };
+
+    //! Create the reactor for worker `w` using the current reactor settings
+    void setupReactor(Worker& w);
+
+    //! Delete the objects owned by all of the workers
+    void deleteWorkers();
+
+    //! Process cases until none are left. Executed by each worker thread.
+    void run(size_t iworker);
+
+    //! Integrate the single case `i` using worker `w`
+    void integrateOne(Worker& w, size_t i);
+
+    //! Claim the next block of cases. Returns false if none are left.
+    bool nextBlock(size_t& begin, size_t& end);
+
+    std::vector<Worker> m_workers;
+    size_t m_nsp;
+
+    bool m_constPressure;
+    bool m_energy;
+    doublereal m_rtol, m_atol, m_maxstep;
+
+    Task m_task;
+    size_t m_next; //!< index of the next unclaimed case
+    size_t m_blockSize; //!< number of cases claimed at once
+    size_t m_nfail;
+    std::string m_firstError;
+    mutex_t m_mutex; //!< protects m_next, m_nfail and m_firstError
+
+private:
+    ReactorEnsemble(const ReactorEnsemble&);
+    ReactorEnsemble& operator=(const ReactorEnsemble&);
+};
+
+}
+
+#endif
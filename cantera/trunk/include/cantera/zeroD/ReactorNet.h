@@ -111,6 +111,86 @@ public:
     //! toward *time*.
     double step(doublereal time);
 
+    //! Advance the state of all reactors to the last of the specified times,
+    //! recording the state of the network at each of these times.
+    /*!
+     *  The state at each output time is interpolated within the internal
+     *  time steps of the integrator, so the output times do not affect the
+     *  step sizes, and no additional evaluations of the governing equations
+     *  are required. This is much cheaper than calling advance() for each
+     *  output time. The integration stops early if a terminal event occurs.
+     *
+     *  @param times Output times [s]. Must be increasing, and not before the
+     *      current time.
+     *  @param[out] output Resized to `times.size()` rows of the selected
+     *      components. Row `i` contains the state at time `times[i]`.
+     *  @param components Indices of the components of the global state
+     *      vector to record (see globalComponentIndex()). If empty, the full
+     *      state vector is recorded.
+     *  @returns the number of output times reached
+     */
+    size_t sampleTrajectory(const vector_fp& times, vector_fp& output,
+                            const std::vector<size_t>& components=
+                                std::vector<size_t>());
+
+    //@}
+
+    //! @name Events
+    //!
+    //! Events are located by the integrator as roots of event functions, so
+    //! the exact time of each event is found without limiting the step size.
+    //! Changes to the events take effect the next time the network is
+    //! initialized.
+    //@{
+
+    //! Add an event which occurs when a property of a reactor crosses the
+    //! specified value.
+    /*!
+     *  @param component "temperature", or the name of a species, in which
+     *      case the mass fraction of that species is used.
+     *  @param value value of the property at the event
+     *  @param reactor index of the reactor
+     *  @param terminal If true, advance() and step() return at the time of
+     *      the event. Otherwise, the time is recorded and the integration
+     *      continues.
+     *  @returns the index of the event
+     */
+    size_t addThresholdEvent(const std::string& component, doublereal value,
+                             size_t reactor=0, bool terminal=true);
+
+    //! Add an event which occurs at each maximum of a property of a reactor,
+    //! e.g. the peak of an intermediate species.
+    //! @copydetails addThresholdEvent
+    size_t addPeakEvent(const std::string& component, size_t reactor=0,
+                        bool terminal=true);
+
+    //! Add an event which occurs at each maximum of the rate of change of a
+    //! property of a reactor, e.g. the maximum of dT/dt used to define the
+    //! ignition delay.
+    //! @copydetails addThresholdEvent
+    size_t addMaxRateEvent(const std::string& component, size_t reactor=0,
+                           bool terminal=true);
+
+    //! Remove all events
+    void clearEvents();
+
+    //! Number of events
+    size_t nEvents() const {
+        return m_events.size();
+    }
+
+    //! The times at which the *n*-th event occurred since the network was
+    //! last initialized.
+    const vector_fp& eventTimes(size_t n) const {
+        return m_events.at(n).times;
+    }
+
+    //! The index of the terminal event at which the last call to advance() or
+    //! step() returned, or `npos` if it did not stop at an event.
+    size_t lastEvent() const {
+        return m_lastEvent;
+    }
+
     //@}
 
     //! Add the reactor *r* to this reactor network.
@@ -130,6 +210,11 @@ public:
         return *m_reactors[n];
     }
 
+    //! Number of reactors in this network
+    size_t nReactors() const {
+        return m_reactors.size();
+    }
+
     //! Returns `true` if verbose logging output is enabled.
     bool verbose() const {
         return m_verbose;
@@ -180,6 +265,9 @@ public:
 
     //! Evaluate the Jacobian matrix for the reactor network.
     /*!
+     *  Only the blocks coupling reactors which are connected by a FlowDevice
+     *  or a Wall are evaluated; all other elements are set to zero.
+     *
      *  @param[in] t Time at which to evaluate the Jacobian
      *  @param[in] y Global state vector at time *t*
      *  @param[out] ydot Time derivative of the state vector evaluated at *t*.
@@ -189,6 +277,101 @@ public:
     void evalJacobian(doublereal t, doublereal* y,
                       doublereal* ydot, doublereal* p, Array2D* j);
 
+    //! Set the method used to solve the linear systems within the integrator.
+    /*!
+     *  - `"dense"` (default): direct solution using a dense Jacobian, which
+     *    requires a number of network evaluations equal to the total number
+     *    of state variables to evaluate the Jacobian.
+     *  - `"gmres"`: iterative solution, preconditioned using the
+     *    block-sparse Jacobian. The diagonal blocks of each reactor and the
+     *    coupling blocks between connected reactors are evaluated together
+     *    by perturbing the variables of unconnected reactors simultaneously,
+     *    and the block lower triangular part of the Newton matrix (with
+     *    reactors in the order in which they were added) is used as the
+     *    preconditioner. This is exact for networks where each reactor only
+     *    depends on reactors added before it, e.g. a sequence of reactors
+     *    connected by MassFlowControllers.
+     */
+    void setLinearSolverType(const std::string& type);
+
+    //! The method used to solve the linear systems within the integrator.
+    //! See setLinearSolverType().
+    const std::string& linearSolverType() const {
+        return m_linearSolverType;
+    }
+
+    //! Number of network evaluations required to evaluate the Jacobian using
+    //! its block-sparse structure. Available after the network has been
+    //! initialized.
+    size_t nJacobianEvals() const;
+
+    //! @name Steady state
+    //! @{
+
+    //! Solve for the steady state of the network, starting from the current
+    //! state of the reactors.
+    /*!
+     *  The steady state is found using damped Newton iteration on the
+     *  residual of the governing equations, with the Jacobian evaluated by
+     *  evalJacobian(). Variables which are constant by construction, e.g. the
+     *  volume of a reactor without walls, are held fixed. If Newton iteration
+     *  fails to converge, the solver takes a number of backward Euler steps in
+     *  pseudo-time toward the steady state, starting with the time step set
+     *  by setSteadyTimeStep() and increasing it after each successful step,
+     *  and then retries Newton iteration. The time of the network is not
+     *  changed.
+     *
+     *  If the network has more than one steady state, e.g. burning and
+     *  extinguished states of a stirred reactor, the one which is found
+     *  depends on the initial state.
+     *
+     *  On return, the reactors are in the steady state, and the integrator
+     *  is reinitialized before any further integration.
+     */
+    void solveSteady();
+
+    //! Set the tolerances for the steady state solver. The solution is
+    //! converged when the RMS norm of the Newton step, weighted by
+    //! 1 / (*rtol* |y_i| + *atol*), is less than one. Negative values leave
+    //! the corresponding tolerance unchanged.
+    void setSteadyTolerances(doublereal rtol, doublereal atol);
+
+    //! Relative tolerance of the steady state solver
+    doublereal rtolSteady() const {
+        return m_ssRtol;
+    }
+
+    //! Absolute tolerance of the steady state solver
+    doublereal atolSteady() const {
+        return m_ssAtol;
+    }
+
+    //! Set the initial pseudo-time step [s] used by solveSteady() when Newton
+    //! iteration fails. The default is 1.0e-5 s.
+    void setSteadyTimeStep(doublereal dt);
+
+    //! Set the maximum number of pseudo-time steps, including failed steps,
+    //! taken by solveSteady() before giving up. The default is 500.
+    void setMaxSteadyTimeSteps(size_t n);
+
+    //! Number of Newton iterations taken by the last call to solveSteady(),
+    //! including those for the pseudo-time steps
+    size_t nSteadyIterations() const {
+        return m_ssIterations;
+    }
+
+    //! Number of successful pseudo-time steps taken by the last call to
+    //! solveSteady()
+    size_t nSteadyTimeSteps() const {
+        return m_ssTimeSteps;
+    }
+
+    //! Number of Jacobian evaluations by the last call to solveSteady()
+    size_t nSteadyJacobians() const {
+        return m_ssJacobians;
+    }
+    //! @}
+
     // overloaded methods of class FuncEval
     virtual size_t neq() {
         return m_nv;
@@ -200,6 +383,13 @@ public:
     virtual size_t nparams() {
         return m_ntotpar;
     }
+    virtual size_t nRootFunctions() {
+        return m_events.size();
+    }
+    virtual void evalRootFunctions(double t, double* y, double* gout);
+    virtual bool preconditionerSetup(double t, double* y, double* ydot,
+                                     bool reuseJacobian, double gamma);
+    virtual void preconditionerSolve(const double* rhs, double* output);
 
     //! Return the index corresponding to the component named *component* in the
     //! reactor with index *reactor* in the global state vector for the
@@ -236,6 +426,65 @@ protected:
      */
     void initialize();
 
+    //! Add an event of the specified type. See addThresholdEvent().
+    size_t addEvent(int type, const std::string& component, doublereal value,
+                    size_t reactor, bool terminal);
+
+    //! Record the events found by the integrator at the current time.
+    //! Returns true if any of them is terminal.
+    bool processEvents();
+
+    //! Value of the property monitored by event *e* at state *y*
+    doublereal eventValue(size_t e, doublereal* y);
+
+    //! Rate of change of the property monitored by event *e*, given the time
+    //! derivative *ydot* at state *y*.
+    doublereal eventRate(size_t e, doublereal t, doublereal* y,
+                         doublereal* ydot);
+
+    //! Determine which reactors are coupled through FlowDevice and Wall
+    //! connections, and divide the reactors into groups whose variables can
+    //! be perturbed simultaneously when evaluating the Jacobian.
+    void buildJacobianPattern();
+
+    //! Evaluate the nonzero blocks of the Jacobian, given the time
+    //! derivative *ydot* evaluated at *y*.
+    void evalJacobianBlocks(doublereal t, doublereal* y, doublereal* ydot,
+                            doublereal* p);
+
+    //! Return the Jacobian block for the dependence of the equations of
+    //! reactor *i* on the variables of reactor *j*, which must be coupled.
+    Array2D& jacobianBlock(size_t i, size_t j);
+
+    //! Solve F(y) - rdt * (y - yold) = 0 by damped Newton iteration, where
+    //! F is the right hand side of the governing equations, starting from
+    //! *y*. With *rdt* = 0, this gives the steady state, and with *rdt* > 0,
+    //! a backward Euler step of size 1/*rdt* from *yold*. Returns true if the
+    //! iteration converged, in which case *y* is the solution.
+    bool steadyNewton(vector_fp& y, const vector_fp& yold, doublereal rdt);
+
+    //! Evaluate the Jacobian at *y* and form and factor the Newton matrix
+    //! rdt * I - J. Returns false if the matrix is singular.
+    bool steadyJacobian(vector_fp& y, doublereal rdt);
+
+    //! Factor the Newton matrix rdt * I - J using the last Jacobian. Returns
+    //! false if the matrix is singular.
+    bool factorSteadyMatrix(doublereal rdt);
+
+    //! Compute the undamped Newton step at *y* and return its weighted norm,
+    //! or a large number if the residual cannot be evaluated at *y*.
+    doublereal steadyStep(vector_fp& y, const vector_fp& yold,
+                          doublereal rdt, vector_fp& step);
+
+    //! Weighted RMS norm of the Newton step *step* at *y*
+    doublereal steadyNorm(const vector_fp& y, const vector_fp& step) const;
+
+    //! Largest multiplier (up to 1) of the Newton step *step* at *y* which
+    //! keeps masses, volumes and temperatures positive and mass fractions
+    //! from becoming more than slightly negative.
+    doublereal boundSteadyStep(const vector_fp& y,
+                               const vector_fp& step) const;
+
     std::vector<Reactor*> m_reactors;
     Integrator* m_integ;
     doublereal m_time;
@@ -270,6 +519,63 @@ protected:
     vector_fp m_ydot;
 
     std::vector<bool> m_iown;
+
+    std::string m_linearSolverType;
+
+    //! m_connect[i] is the sorted list of reactors whose state affects the
+    //! equations of reactor i, including reactor i itself.
+    std::vector<std::vector<size_t> > m_connect;
+
+    //! Groups of reactors whose variables are perturbed simultaneously when
+    //! evaluating the Jacobian. No two reactors in a group are both
+    //! connected to any reactor.
+    std::vector<std::vector<size_t> > m_jacGroups;
+
+    //! m_jacBlocks[i][n] is the Jacobian block for the equations of reactor i
+    //! with respect to the variables of reactor m_connect[i][n].
+    std::vector<std::vector<Array2D> > m_jacBlocks;
+
+    //! LU-factored diagonal blocks of the preconditioner
+    std::vector<Array2D> m_precon;
+    std::vector<vector_int> m_pivots;
+
+    //! Value of gamma used to form the preconditioner
+    doublereal m_gamma;
+
+    //! An event function registered with addThresholdEvent(), addPeakEvent()
+    //! or addMaxRateEvent()
+    struct Event {
+        int type; //!< ThresholdEvent, PeakEvent or MaxRateEvent
+        size_t reactor;
+        size_t species; //!< species index, or npos for the temperature
+        size_t component; //!< index in the reactor state vector, or npos
+        doublereal value;
+        bool terminal;
+        vector_fp times; //!< times at which the event occurred
+    };
+    enum { ThresholdEvent, PeakEvent, MaxRateEvent };
+
+    std::vector<Event> m_events;
+    size_t m_lastEvent;
+    doublereal m_tstart; //!< Time at which the integrator was initialized
+    vector_int m_rootInfo;
+    vector_fp m_yevent, m_ydotevent; //!< work arrays for events and sampling
+    vector_fp m_yroot; //!< perturbed state used by evalRootFunctions()
+
+    //! @name Steady state solver
+    //! @{
+    doublereal m_ssRtol, m_ssAtol;
+    doublereal m_ssTimeStep; //!< initial pseudo-time step
+    size_t m_ssMaxTimeSteps;
+    size_t m_ssIterations, m_ssTimeSteps, m_ssJacobians;
+    Array2D m_ssJac; //!< Jacobian used by the steady state solver
+    Array2D m_ssMatrix; //!< Factored Newton matrix, rdt * I - J
+    vector_int m_ssPivots;
+    size_t m_ssJacAge; //!< Number of iterations since m_ssJac was evaluated
+    //! Bound type of each component: 0 for none, 1 for positive quantities
+    //! and 2 for mass fractions
+    vector_int m_ssBounds;
+    //! @}
 };
 }
 
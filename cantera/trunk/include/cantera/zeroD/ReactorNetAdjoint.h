@@ -0,0 +1,170 @@
+/**
+ *  @file ReactorNetAdjoint.h
+ */
+
+#ifndef CT_REACTORNETADJOINT_H
+#define CT_REACTORNETADJOINT_H
+
+#include "cantera/numerics/FuncEval.h"
+#include "cantera/base/Array.h"
+
+#include <map>
+
+namespace Cantera
+{
+
+class ReactorNet;
+class Integrator;
+
+//! Adjoint sensitivity analysis for a reactor network.
+/*!
+ *  Computes the derivatives of a scalar objective with respect to the rate
+ *  multipliers of all homogeneous phase reactions in all reactors, i.e. the
+ *  sensitivities with respect to the logarithms of the pre-exponential
+ *  factors. Unlike the forward sensitivity analysis provided by ReactorNet,
+ *  which requires one additional system of equations for each parameter,
+ *  the sensitivities with respect to all reactions are obtained from a
+ *  single backward integration of the adjoint system
+ *
+ *  \f[
+ *      \frac{d\lambda}{dt} = -J^T \lambda, \qquad
+ *      \frac{dG}{dk_i} = \int_{t_0}^{t_f} \lambda^T
+ *          \frac{\partial f}{\partial k_i} dt
+ *  \f]
+ *
+ *  from the final time \f$ t_f \f$ to the initial time \f$ t_0 \f$.
+ *
+ *  First, advance() integrates the network forward, storing the state and
+ *  its time derivative at the end of every internal time step. These
+ *  checkpoints are used to reconstruct the forward solution during the
+ *  backward integration using cubic Hermite interpolation. Then, solve() or
+ *  solveCrossingTime() integrate the adjoint system for the selected
+ *  objective. Several objectives can be evaluated for the same forward
+ *  solution.
+ *
+ *  @code
+ *  ReactorNetAdjoint adj(net);
+ *  net.addThresholdEvent("temperature", 1500.0);
+ *  adj.advance(1.0); // stops at T = 1500 K
+ *  adj.solveCrossingTime("temperature");
+ *  const vector_fp& dtau = adj.sensitivities(); // d(tau_ign)/d(ln A_i)
+ *  @endcode
+ */
+class ReactorNetAdjoint : public FuncEval
+{
+public:
+    //! Create the adjoint solver for the network *net*, which must not be
+    //! modified while the solver is in use.
+    ReactorNetAdjoint(ReactorNet& net);
+    virtual ~ReactorNetAdjoint();
+
+    //! Set the relative and absolute tolerances used for the backward
+    //! integration. The absolute tolerance applies directly to the adjoint
+    //! variables, whose scale depends on the magnitude of the objective.
+    void setTolerances(doublereal rtol, doublereal atol);
+
+    //! Advance the reactor network from its current time to *time*,
+    //! recording the trajectory. The integration stops early if a terminal
+    //! event occurs.
+    void advance(doublereal time);
+
+    //! Number of checkpoints stored by the last call to advance()
+    size_t nCheckpoints() const {
+        return m_times.size();
+    }
+
+    //! Compute the sensitivities of the value of *component* of the reactor
+    //! with index *reactor* at the end of the recorded trajectory.
+    void solve(const std::string& component, size_t reactor=0);
+
+    //! Compute the sensitivities of the time at which *component* of the
+    //! reactor with index *reactor* reaches its value at the end of the
+    //! recorded trajectory, e.g. the ignition delay time if the forward
+    //! integration was stopped by a threshold event on the temperature.
+    void solveCrossingTime(const std::string& component, size_t reactor=0);
+
+    //! Sensitivities of the objective with respect to the rate multipliers
+    //! of the reactions in the reactor with index *reactor*, computed by the
+    //! last call to solve() or solveCrossingTime().
+    const vector_fp& sensitivities(size_t reactor=0) const;
+
+    //! Number of evaluations of the reactor network equations during the
+    //! last backward integration
+    size_t nEvals() const {
+        return m_nevals;
+    }
+
+    // overloaded methods of class FuncEval
+    virtual size_t neq() {
+        return m_nv;
+    }
+    virtual void eval(doublereal s, doublereal* lambda,
+                      doublereal* lambdadot, doublereal* p);
+    virtual void getInitialConditions(doublereal s0, size_t leny,
+                                      doublereal* lambda);
+    virtual bool preconditionerSetup(double s, double* lambda, double* ydot,
+                                     bool reuseJacobian, double gamma);
+    virtual void preconditionerSolve(const double* rhs, double* output);
+
+protected:
+    //! Store the state of the network at time *t*, which must be within the
+    //! last internal time step of the forward integration.
+    void addCheckpoint(doublereal t);
+
+    //! Index of *component* of the reactor with index *reactor* in the
+    //! global state vector
+    size_t componentIndex(const std::string& component, size_t reactor);
+
+    //! Integrate the adjoint system backward from the final time with the
+    //! final condition lambda = dG/dy for the component with global index
+    //! *k*, and store the sensitivities of y_k scaled by *scale*.
+    void integrateAdjoint(size_t k, doublereal scale);
+
+    //! Interpolate the forward solution at time *t* into m_y
+    void interpolate(doublereal t);
+
+    //! Evaluate the Jacobian of the network equations at time *t* and store
+    //! it in m_jac.
+    void evalJacobian(doublereal t);
+
+    //! Jacobian of the network equations at the checkpoint *j*
+    const Array2D& checkpointJacobian(size_t j);
+
+    //! Add the integral of the parameter terms of the adjoint system over the
+    //! interval [*s0*, *s1*] of the backward time to the sensitivities.
+    void integrateSensitivities(doublereal s0, doublereal s1);
+
+    ReactorNet& m_net;
+    Integrator* m_integ; //!< Integrator for the adjoint system
+    size_t m_nv; //!< Number of state variables of the network
+    doublereal m_rtol, m_atol;
+
+    //! @name Checkpoints of the forward solution
+    //! @{
+    vector_fp m_times;
+    std::vector<vector_fp> m_ycp, m_ydotcp;
+    //! @}
+
+    vector_fp m_lambda0; //!< final condition for the adjoint variables
+
+    //! Sensitivities, for each reactor
+    std::vector<vector_fp> m_sens;
+
+    //! Offset of each reactor in the global state vector
+    std::vector<size_t> m_start;
+
+    Array2D m_jac; //!< Jacobian of the network equations
+    doublereal m_tjac; //!< Time at which m_jac was evaluated
+
+    //! Jacobians at the checkpoints bracketing the current backward time
+    std::map<size_t, Array2D> m_jacCache;
+    Array2D m_precon; //!< Factored preconditioner, I - gamma * J^T
+    vector_int m_pivots;
+
+    vector_fp m_y, m_ydot, m_ydot1, m_lambda, m_work;
+    size_t m_nevals;
+};
+
+}
+
+#endif
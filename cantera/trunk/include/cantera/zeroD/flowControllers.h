@@ -61,6 +61,12 @@ public:
         m_master = master;
     }
 
+    //! The flow device whose mass flow rate determines the flow rate through
+    //! this device.
+    FlowDevice* master() const {
+        return m_master;
+    }
+
     virtual void updateMassFlowRate(doublereal time) {
         doublereal master_mdot = m_master->massFlowRate(time);
         m_mdot = master_mdot + m_coeffs[0]*(in().pressure() -
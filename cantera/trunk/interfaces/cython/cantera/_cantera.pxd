@@ -40,6 +40,12 @@ cdef extern from "cantera/cython/funcWrapper.h":
 
 
 cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
+    cdef cppclass CxxSparseComposition "Cantera::SparseComposition":
+        CxxSparseComposition()
+        size_t nSpecies
+        vector[size_t] index
+        vector[double] value
+
     cdef cppclass CxxThermoPhase "Cantera::ThermoPhase":
         CxxThermoPhase()
 
@@ -99,6 +105,11 @@ cdef extern from "cantera/thermo/ThermoPhase.h" namespace "Cantera":
         double moleFraction(size_t) except +
         double moleFraction(string) except +
 
+        CxxSparseComposition compileComposition(string) except +
+        CxxSparseComposition compileComposition(stdmap[string,double]&) except +
+        void setMoleFractions_Sparse(CxxSparseComposition&) except +
+        void setMassFractions_Sparse(CxxSparseComposition&) except +
+
         double concentration(size_t) except +
         double elementalMassFraction(size_t) except +
         double elementalMoleFraction(size_t) except +
@@ -333,6 +344,8 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         void addReactor(CxxReactor&)
         void advance(double) except +
         double step(double) except +
+        size_t sampleTrajectory(vector[double]&, vector[double]&,
+                                vector[size_t]&) except +
         void reinitialize() except +
         double time()
         void setInitialTime(double)
@@ -341,9 +354,28 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         double atol()
         void setMaxTimeStep(double)
         void setMaxErrTestFails(int)
+        void setLinearSolverType(string&) except +
+        string linearSolverType()
+        size_t addThresholdEvent(string&, double, size_t, cbool) except +
+        size_t addPeakEvent(string&, size_t, cbool) except +
+        size_t addMaxRateEvent(string&, size_t, cbool) except +
+        void clearEvents()
+        size_t nEvents()
+        vector[double]& eventTimes(size_t) except +
+        size_t lastEvent()
         cbool verbose()
         void setVerbose(cbool)
         size_t neq()
+        size_t globalComponentIndex(string&, size_t) except +
+        void solveSteady() except +
+        void setSteadyTolerances(double, double)
+        double rtolSteady()
+        double atolSteady()
+        void setSteadyTimeStep(double) except +
+        void setMaxSteadyTimeSteps(size_t)
+        size_t nSteadyIterations()
+        size_t nSteadyTimeSteps()
+        size_t nSteadyJacobians()
 
         void setSensitivityTolerances(double, double)
         double rtolSensitivity()
@@ -354,6 +386,95 @@ cdef extern from "cantera/zeroD/ReactorNet.h":
         string sensitivityParameterName(size_t) except +
 
 
+cdef extern from "cantera/zeroD/ReactorNetAdjoint.h":
+    cdef cppclass CxxReactorNetAdjoint "Cantera::ReactorNetAdjoint":
+        CxxReactorNetAdjoint(CxxReactorNet&)
+        void setTolerances(double, double)
+        void advance(double) except +
+        size_t nCheckpoints()
+        void solve(string&, size_t) except +
+        void solveCrossingTime(string&, size_t) except +
+        vector[double]& sensitivities(size_t) except +
+
+
+cdef extern from "cantera/zeroD/ClosedReactor.h":
+    cdef cppclass CxxClosedReactor "Cantera::ClosedReactor":
+        CxxClosedReactor(CxxThermoPhase&, CxxKinetics&, cbool) except +
+        cbool constantPressure()
+        void setEnergy(cbool)
+        cbool energyEnabled()
+        void setTolerances(double, double)
+        void setMaxTimeStep(double)
+        void setInitialTime(double)
+        double time()
+        void advance(double) except +
+        double step(double) except +
+        size_t nJacobianEvals()
+        size_t nJacobianReuses()
+        void setJacobianReuse(double)
+        void integrateCells(size_t, double, double*, double*, double*) except +
+
+cdef extern from "cantera/zeroD/ISATReactor.h":
+    cdef cppclass CxxISATReactor "Cantera::ISATReactor" (CxxClosedReactor):
+        CxxISATReactor(CxxThermoPhase&, CxxKinetics&, cbool) except +
+        void setTolerance(double) except +
+        void setTemperatureScale(double) except +
+        void setMaxRecords(size_t)
+        void setErrorCheckInterval(size_t)
+        void clear()
+        void substep(double) except +
+        size_t nRecords()
+        size_t nQueries()
+        size_t nRetrieves()
+        size_t nGrows()
+        size_t nAdds()
+        size_t nDirect()
+        size_t nErrorChecks()
+        double maxError()
+        double meanError()
+        size_t treeDepth()
+
+cdef extern from "cantera/zeroD/PlugFlowReactor.h":
+    cdef cppclass CxxPlugFlowReactor "Cantera::PlugFlowReactor":
+        CxxPlugFlowReactor(CxxThermoPhase&, CxxKinetics&) except +
+        void addSurface(CxxInterfaceKinetics&) except +
+        size_t nSurfaces()
+        void setArea(double) except +
+        double area()
+        void setSurfaceAreaToVolumeRatio(double) except +
+        double surfaceAreaToVolumeRatio()
+        void setMassFlowRate(double) except +
+        double massFlowRate()
+        void setEnergy(cbool)
+        cbool energyEnabled()
+        void setTolerances(double, double)
+        void setMaxStepSize(double)
+        void initialize(double) except +
+        void advance(double) except +
+        double distance()
+        double speed()
+        size_t componentIndex(string&)
+        int nEquations()
+        double* solution() except +
+        size_t nJacobianEvals()
+
+
+cdef extern from "cantera/zeroD/ReactorEnsemble.h":
+    cdef cppclass CxxReactorEnsemble "Cantera::ReactorEnsemble":
+        CxxReactorEnsemble(string, string, size_t) except +
+        size_t nSpecies()
+        size_t nThreads()
+        size_t stateSize()
+        void setConstantPressure(cbool)
+        void setEnergy(cbool)
+        void setTolerances(double, double)
+        void setMaxTimeStep(double)
+        void integrate(size_t, double*, double*, double*, size_t, double*,
+                       double*) except +
+        size_t nFailures()
+        string firstError()
+
+
 cdef extern from "cantera/thermo/ThermoFactory.h" namespace "Cantera":
     cdef CxxThermoPhase* newPhase(string, string) except +
     cdef CxxThermoPhase* newPhase(XML_Node&) except +
@@ -465,6 +586,8 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void setRefineCriteria(size_t, double, double, double, double) except +
         void save(string, string, string, int) except +
         void restore(string, string, int) except +
+        void saveCheckpoint(string) except +
+        void restoreCheckpoint(string, int) except +
         void writeStats(int) except +
         void clearStats()
         int domainIndex(string) except +
@@ -476,6 +599,7 @@ cdef extern from "cantera/oneD/Sim1D.h":
         void setMinTimeStep(double)
         void setMaxTimeStep(double)
         void setGridMin(int, double) except +
+        void setCoarsenThreshold(int, double) except +
         void setFixedTemperature(double)
         void setInterrupt(CxxFunc1*) except +
 
@@ -604,6 +728,9 @@ cdef class ThermoPhase(_SolutionBase):
     cdef np.ndarray _getArray1(self, thermoMethod1d method)
     cdef void _setArray1(self, thermoMethod1d method, values) except *
 
+cdef class Composition:
+    cdef CxxSparseComposition comp
+
 cdef class InterfacePhase(ThermoPhase):
     cdef CxxSurfPhase* surf
 
@@ -691,6 +818,25 @@ cdef class ReactorNet:
     cdef CxxReactorNet net
     cdef list _reactors
 
+cdef class ReactorNetAdjoint:
+    cdef CxxReactorNetAdjoint* adj
+    cdef ReactorNet net
+
+cdef class ClosedReactor:
+    cdef CxxClosedReactor* reactor
+    cdef _SolutionBase _contents
+
+cdef class ISATReactor(ClosedReactor):
+    cdef CxxISATReactor* isat
+
+cdef class PlugFlowReactor:
+    cdef CxxPlugFlowReactor* reactor
+    cdef _SolutionBase _contents
+    cdef list _surfaces
+
+cdef class ReactorEnsemble:
+    cdef CxxReactorEnsemble* ens
+
 cdef class Domain1D:
     cdef CxxDomain1D* domain
 
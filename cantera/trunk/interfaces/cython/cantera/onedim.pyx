@@ -725,6 +725,23 @@ cdef class Sim1D:
             idom = self.domain_index(domain)
         self.sim.setGridMin(idom, dz)
 
+    def set_coarsen_threshold(self, coarsen, domain=None):
+        """
+        Set the threshold used to remove unneeded grid points on *domain*. A
+        point is removed if the change in value and the change in slope of
+        every component across the interval formed by removing it are smaller
+        than *coarsen* times the 'slope' and 'curve' refinement criteria. Set
+        to zero to disable coarsening. If *domain* is None, then set the
+        threshold for all domains.
+
+        >>> s.set_coarsen_threshold(0.2)
+        """
+        if domain is None:
+            idom = -1
+        else:
+            idom = self.domain_index(domain)
+        self.sim.setCoarsenThreshold(idom, coarsen)
+
     def set_max_jac_age(self, ss_age, ts_age):
         """
         Set the maximum number of times the Jacobian will be used before it
@@ -794,6 +811,29 @@ cdef class Sim1D:
         self.sim.restore(stringify(filename), stringify(name), loglevel)
         self._initialized = True
 
+    def save_checkpoint(self, filename='soln.chk'):
+        """
+        Save the solution and solver state in a compact binary format.
+
+        Checkpoints are much faster to write and read than the XML files
+        produced by `save`, but can only be restored into a simulation with
+        the same domains and components, on a machine with the same byte
+        order.
+
+        >>> s.save_checkpoint('flame.chk')
+        """
+        self.sim.saveCheckpoint(stringify(filename))
+
+    def restore_checkpoint(self, filename='soln.chk', loglevel=1):
+        """
+        Restore the solution and solver state from a file written by
+        `save_checkpoint`.
+
+        >>> s.restore_checkpoint('flame.chk')
+        """
+        self.sim.restoreCheckpoint(stringify(filename), loglevel)
+        self._initialized = True
+
     def show_stats(self, print_time=True):
         """
         Show the statistics for the last solution.
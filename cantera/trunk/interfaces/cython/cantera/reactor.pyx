@@ -766,6 +766,46 @@ cdef class ReactorNet:
         """
         return self.net.step(t)
 
+    def sample_trajectory(self, times, components=None, reactor=None):
+        """
+        Advance the state of the reactor network to the last of the output
+        times *times* [s], and return the state at each of these times. The
+        states are interpolated within the internal time steps of the
+        integrator, which is much faster than calling `advance` for each
+        output time.
+
+        *components* is a list of the state vector components to return,
+        given either as names of components of *reactor* (the first reactor
+        by default), or as indices into the global state vector. If it is not
+        given, the full state vector is returned. See `sensitivities` for the
+        order of the state variables.
+
+        Returns an array with one row for each output time reached, which is
+        fewer than ``len(times)`` if the integration stopped at a terminal
+        event.
+        """
+        cdef vector[double] tv, out
+        cdef vector[size_t] comps
+        cdef size_t r = self._reactor_index(reactor)
+        for t in times:
+            tv.push_back(t)
+        if components is not None:
+            for c in components:
+                if isinstance(c, (str, unicode)):
+                    comps.push_back(self.net.globalComponentIndex(stringify(c),
+                                                                  r))
+                else:
+                    comps.push_back(c)
+
+        cdef size_t n = self.net.sampleTrajectory(tv, out, comps)
+        cdef size_t nc = out.size() // tv.size() if tv.size() else 0
+        data = np.empty((n, nc))
+        cdef size_t i, j
+        for i in range(n):
+            for j in range(nc):
+                data[i,j] = out[i*nc + j]
+        return data
+
     def reinitialize(self):
         """
         Reinitialize the integrator after making changing to the state of the
@@ -801,6 +841,144 @@ cdef class ReactorNet:
         def __set__(self, n):
             self.net.setMaxErrTestFails(n)
 
+    property linear_solver_type:
+        """
+        The method used to solve the linear systems within the integrator.
+        Either ``'dense'`` (default) or ``'gmres'``, an iterative solver which
+        is preconditioned using the block-sparse Jacobian of the network, and
+        is much faster for networks containing many reactors.
+        """
+        def __get__(self):
+            return pystr(self.net.linearSolverType())
+        def __set__(self, solver_type):
+            self.net.setLinearSolverType(stringify(solver_type))
+
+    def solve_steady(self):
+        """
+        Solve for the steady state of the network, starting from the current
+        state of the reactors, using damped Newton iteration. If Newton
+        iteration fails, backward Euler steps in pseudo-time are taken toward
+        the steady state before trying again. The time of the network is not
+        changed. If the network has more than one steady state, e.g. burning
+        and extinguished states, the one which is found depends on the initial
+        state.
+
+        This is much faster than integrating to a large time, especially when
+        the network is solved repeatedly for slightly different parameters,
+        since each solution starts from the previous steady state.
+        """
+        self.net.solveSteady()
+
+    property rtol_steady:
+        """
+        The relative error tolerance of the steady state solver. The solution
+        is converged when the RMS norm of the Newton step, weighted by
+        ``1 / (rtol_steady * abs(y) + atol_steady)``, is less than one.
+        """
+        def __get__(self):
+            return self.net.rtolSteady()
+        def __set__(self, tol):
+            self.net.setSteadyTolerances(tol, -1)
+
+    property atol_steady:
+        """
+        The absolute error tolerance of the steady state solver. See
+        `rtol_steady`.
+        """
+        def __get__(self):
+            return self.net.atolSteady()
+        def __set__(self, tol):
+            self.net.setSteadyTolerances(-1, tol)
+
+    property steady_time_step:
+        """
+        The initial pseudo-time step [s] used by `solve_steady` when Newton
+        iteration fails. Default: 1e-5 s.
+        """
+        def __set__(self, double dt):
+            self.net.setSteadyTimeStep(dt)
+
+    property max_steady_time_steps:
+        """
+        The maximum number of pseudo-time steps, including failed steps, taken
+        by `solve_steady` before giving up. Default: 500.
+        """
+        def __set__(self, size_t n):
+            self.net.setMaxSteadyTimeSteps(n)
+
+    property steady_stats:
+        """
+        A tuple with the numbers of Newton iterations, successful pseudo-time
+        steps and Jacobian evaluations used by the last call to `solve_steady`.
+        """
+        def __get__(self):
+            return (self.net.nSteadyIterations(), self.net.nSteadyTimeSteps(),
+                    self.net.nSteadyJacobians())
+
+    def _reactor_index(self, reactor):
+        if reactor is None:
+            return 0
+        return self._reactors.index(reactor)
+
+    def add_threshold_event(self, component, double value, reactor=None,
+                            terminal=True):
+        """
+        Add an event which occurs when *component* of *reactor* crosses
+        *value*. *component* is ``'temperature'`` or the name of a species, in
+        which case its mass fraction is used. *reactor* defaults to the first
+        reactor in the network. If *terminal* is *True*, `advance` and `step`
+        return at the time of the event; otherwise, the time is recorded and
+        the integration continues. Returns the index of the event.
+        """
+        return self.net.addThresholdEvent(stringify(component), value,
+                                          self._reactor_index(reactor),
+                                          terminal)
+
+    def add_peak_event(self, component, reactor=None, terminal=True):
+        """
+        Add an event which occurs at each maximum of *component* of
+        *reactor*, e.g. the peak of an intermediate species. See
+        `add_threshold_event`.
+        """
+        return self.net.addPeakEvent(stringify(component),
+                                     self._reactor_index(reactor), terminal)
+
+    def add_max_rate_event(self, component, reactor=None, terminal=True):
+        """
+        Add an event which occurs at each maximum of the rate of change of
+        *component* of *reactor*, e.g. the maximum of dT/dt which defines the
+        ignition delay. See `add_threshold_event`.
+        """
+        return self.net.addMaxRateEvent(stringify(component),
+                                        self._reactor_index(reactor), terminal)
+
+    def clear_events(self):
+        """Remove all events."""
+        self.net.clearEvents()
+
+    property n_events:
+        """The number of events."""
+        def __get__(self):
+            return self.net.nEvents()
+
+    def event_times(self, int n):
+        """
+        The times at which event *n* occurred since the network was last
+        initialized.
+        """
+        return np.array(self.net.eventTimes(n))
+
+    property last_event:
+        """
+        The index of the terminal event at which the last call to `advance`
+        or `step` returned, or *None* if it did not stop at an event.
+        """
+        def __get__(self):
+            cdef size_t n = self.net.lastEvent()
+            if n == CxxNpos:
+                return None
+            return n
+
     property rtol:
         """
         The relative error tolerance used while integrating the reactor
@@ -937,3 +1115,658 @@ cdef class ReactorNet:
 
     def __copy__(self):
         raise NotImplementedError('ReactorNet object is not copyable')
+
+
+cdef class ReactorNetAdjoint:
+    """
+    Adjoint sensitivity analysis for a `ReactorNet`. Computes the
+    sensitivities of a scalar objective with respect to the rate multipliers
+    of all reactions, i.e. with respect to the logarithms of their
+    pre-exponential factors, using a single backward integration.
+
+    First, `advance` integrates the network forward and stores its
+    trajectory. Then, `solve` or `solve_crossing_time` compute the
+    sensitivities of the selected objective.
+
+    Example:
+
+    >>> net.add_threshold_event('temperature', 1500)
+    >>> adj = ReactorNetAdjoint(net)
+    >>> adj.advance(1.0)
+    >>> adj.solve_crossing_time('temperature')
+    >>> dtau = adj.sensitivities()
+    """
+    def __cinit__(self, ReactorNet net, *args, **kwargs):
+        self.adj = new CxxReactorNetAdjoint(net.net)
+
+    def __init__(self, ReactorNet net):
+        self.net = net  # prevents premature garbage collection
+
+    def __dealloc__(self):
+        del self.adj
+
+    def set_tolerances(self, double rtol, double atol):
+        """
+        Set the relative and absolute tolerances of the backward integration.
+        """
+        self.adj.setTolerances(rtol, atol)
+
+    def advance(self, double t):
+        """
+        Advance the reactor network to time *t* [s], recording the
+        trajectory. The integration stops early if a terminal event occurs.
+        """
+        self.adj.advance(t)
+
+    property n_checkpoints:
+        """Number of states stored by the last call to `advance`."""
+        def __get__(self):
+            return self.adj.nCheckpoints()
+
+    def _reactor_index(self, reactor):
+        if reactor is None:
+            return 0
+        return self.net._reactors.index(reactor)
+
+    def solve(self, component, reactor=None):
+        """
+        Compute the sensitivities of the value of *component* of *reactor*
+        (by default, the first reactor) at the end of the recorded trajectory.
+        """
+        self.adj.solve(stringify(component), self._reactor_index(reactor))
+
+    def solve_crossing_time(self, component, reactor=None):
+        """
+        Compute the sensitivities of the time at which *component* of
+        *reactor* reaches its value at the end of the recorded trajectory,
+        e.g. the ignition delay if the trajectory was stopped by a threshold
+        event on the temperature.
+        """
+        self.adj.solveCrossingTime(stringify(component),
+                                   self._reactor_index(reactor))
+
+    def sensitivities(self, reactor=None):
+        """
+        The sensitivities computed by the last call to `solve` or
+        `solve_crossing_time` with respect to the rate multipliers of the
+        reactions in *reactor*.
+        """
+        return np.array(self.adj.sensitivities(self._reactor_index(reactor)))
+
+
+cdef class ClosedReactor:
+    """
+    A closed, adiabatic ideal gas reactor at constant volume or constant
+    pressure, without walls, inlets, outlets or surfaces. For this common
+    case, e.g. for ignition delay calculations, `ClosedReactor` is faster than
+    an `IdealGasReactor` or `IdealGasConstPressureReactor` in a `ReactorNet`.
+    The state of *contents* is updated as the integration proceeds.
+
+    :param contents:
+        A `Solution` object representing an ideal gas with homogeneous
+        reactions.
+    :param constant_pressure:
+        If *True*, the reactor is at constant pressure. Otherwise, the reactor
+        is at constant volume.
+    :param energy:
+        Set to *False* to hold the temperature constant.
+
+    Example:
+
+    >>> gas.TPX = 1200, ct.one_atm, 'CH4:1, O2:2, N2:7.52'
+    >>> r = ClosedReactor(gas, constant_pressure=True)
+    >>> r.advance(0.1)
+
+    For operator splitting schemes, `integrate_cells` advances the states of
+    many cells over a short time step in a single call.
+    """
+    # If True, the chemistry substeps are tabulated (see `ISATReactor`)
+    tabulated = False
+
+    def __cinit__(self, _SolutionBase contents, constant_pressure=False,
+                  *args, **kwargs):
+        if contents.kinetics == NULL:
+            raise ValueError('Phase has no kinetics manager')
+        if self.tabulated:
+            self.reactor = new CxxISATReactor(deref(contents.thermo),
+                                              deref(contents.kinetics),
+                                              constant_pressure)
+        else:
+            self.reactor = new CxxClosedReactor(deref(contents.thermo),
+                                                deref(contents.kinetics),
+                                                constant_pressure)
+
+    def __init__(self, _SolutionBase contents, constant_pressure=False, *,
+                 energy=True):
+        self._contents = contents  # prevents premature garbage collection
+        if not energy:
+            self.energy_enabled = False
+
+    def __dealloc__(self):
+        del self.reactor
+
+    property thermo:
+        """The `Solution` object contained in the reactor."""
+        def __get__(self):
+            return self._contents
+
+    property constant_pressure:
+        """*True* if the reactor is at constant pressure."""
+        def __get__(self):
+            return self.reactor.constantPressure()
+
+    property energy_enabled:
+        """
+        *True* when the energy equation is being solved for this reactor.
+        When this is *False*, the reactor temperature is held constant.
+        """
+        def __get__(self):
+            return self.reactor.energyEnabled()
+        def __set__(self, pybool value):
+            self.reactor.setEnergy(value)
+
+    property time:
+        """The current time [s]."""
+        def __get__(self):
+            return self.reactor.time()
+
+    property max_time_step:
+        """
+        Maximum time step [s]. If not set, the maximum step is the length of
+        the first integration interval.
+        """
+        def __set__(self, double t):
+            self.reactor.setMaxTimeStep(t)
+
+    property jacobian_reuse:
+        """
+        Tolerance for reusing the Jacobian from the end of the previous
+        integration when restarting from a similar state. The states are
+        similar if the temperatures and pressures (or densities) differ by
+        less than this relative tolerance, and the mass fractions differ by
+        less than this tolerance. The Jacobian is only used as a
+        preconditioner, so this affects the cost of the integration but not
+        the solution. A value of 0 disables reuse, which is the default.
+        """
+        def __set__(self, double tol):
+            self.reactor.setJacobianReuse(tol)
+
+    property n_jacobian_evals:
+        """
+        Number of times the Jacobian has been evaluated since the reactor
+        settings were last changed.
+        """
+        def __get__(self):
+            return self.reactor.nJacobianEvals()
+
+    property n_jacobian_reuses:
+        """
+        Number of times the Jacobian from a previous integration has been
+        reused since the reactor settings were last changed.
+        """
+        def __get__(self):
+            return self.reactor.nJacobianReuses()
+
+    def set_tolerances(self, double rtol, double atol):
+        """Set the relative and absolute tolerances of the integrator."""
+        self.reactor.setTolerances(rtol, atol)
+
+    def set_initial_time(self, double t):
+        """
+        Set the current time and restart the integration from the current
+        state of the contents. Must be called after the state of the contents
+        is changed.
+        """
+        self.reactor.setInitialTime(t)
+
+    def advance(self, double t):
+        """Advance the state of the reactor to time *t* [s]."""
+        self.reactor.advance(t)
+
+    def step(self, double t):
+        """
+        Take a single internal time step toward time *t* [s]. The time after
+        the step is returned.
+        """
+        return self.reactor.step(t)
+
+    def integrate_cells(self, double dt, T, P, Y):
+        """
+        Advance the states of n independent cells, each starting from the
+        state (*T[i]*, *P[i]*, *Y[i,:]*), by the time step *dt* [s], e.g. for
+        the chemistry substep of an operator splitting scheme. *P* may be a
+        scalar. Returns the final temperatures and mass fractions as arrays of
+        shape (n,) and (n, n_species). The pressure of cells in constant
+        volume reactors changes during the time step.
+
+        The cells are integrated in order, so if `jacobian_reuse` is
+        enabled, ordering the cells such that neighboring cells have similar
+        states reduces the number of Jacobian evaluations.
+        """
+        cdef np.ndarray[np.double_t, ndim=1] T_ = \
+            np.array(T, dtype=np.double).ravel()
+        cdef size_t n = len(T_)
+        cdef size_t nsp = self._contents.n_species
+        cdef np.ndarray[np.double_t, ndim=1] P_ = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] Y_ = \
+            np.array(np.broadcast_to(Y, (n, nsp)), dtype=np.double)
+        if n:
+            self.reactor.integrateCells(n, dt, &T_[0], &P_[0], &Y_[0,0])
+        return T_, Y_
+
+
+cdef class ISATReactor(ClosedReactor):
+    """
+    A `ClosedReactor` which tabulates its chemistry substeps using in situ
+    adaptive tabulation (ISAT, S. B. Pope, Combust. Theory Modelling 1:41-63,
+    1997). The results of previous substeps are stored in a binary tree, and
+    the result for an initial state (temperature, mass fractions, pressure or
+    density, and time step) close to a stored one is retrieved by linear
+    approximation instead of by integration. The constructor arguments are the
+    same as for `ClosedReactor`.
+
+    Tabulation is used by `substep` and `integrate_cells`:
+
+    >>> r = ISATReactor(gas, constant_pressure=True)
+    >>> r.tolerance = 1e-4
+    >>> T, Y = r.integrate_cells(1e-5, T, ct.one_atm, Y)
+    >>> r.n_retrieves / r.n_queries
+    """
+    tabulated = True
+
+    def __cinit__(self, *args, **kwargs):
+        self.isat = <CxxISATReactor*>(self.reactor)
+
+    property tolerance:
+        """
+        Error tolerance for the state after a substep, with the temperature
+        scaled by `temperature_scale`. Setting the tolerance clears the table.
+        Default 1e-4.
+        """
+        def __set__(self, double tol):
+            self.isat.setTolerance(tol)
+
+    property temperature_scale:
+        """
+        Temperature scale [K] used to scale the temperature relative to the
+        mass fractions. Setting the scale clears the table. Default 1000 K.
+        """
+        def __set__(self, double T):
+            self.isat.setTemperatureScale(T)
+
+    property max_records:
+        """
+        Maximum number of records in the table. Once the table is full,
+        queries which cannot be retrieved are integrated directly.
+        """
+        def __set__(self, size_t n):
+            self.isat.setMaxRecords(n)
+
+    property error_check_interval:
+        """
+        If *n* > 0, check every *n*-th retrieval against a direct integration
+        to collect the error statistics `max_error` and `mean_error`.
+        """
+        def __set__(self, size_t n):
+            self.isat.setErrorCheckInterval(n)
+
+    def clear(self):
+        """Remove all records from the table and reset the statistics."""
+        self.isat.clear()
+
+    def substep(self, double dt):
+        """
+        Advance the current state of the contents by the time step *dt* [s],
+        using the table if possible.
+        """
+        self.isat.substep(dt)
+
+    property n_records:
+        """Number of records in the table."""
+        def __get__(self):
+            return self.isat.nRecords()
+
+    property n_queries:
+        """Number of queries since the table was last cleared."""
+        def __get__(self):
+            return self.isat.nQueries()
+
+    property n_retrieves:
+        """Number of queries resolved by retrieval from the table."""
+        def __get__(self):
+            return self.isat.nRetrieves()
+
+    property n_grows:
+        """
+        Number of queries which were integrated directly and grew the region
+        of accuracy of an existing record.
+        """
+        def __get__(self):
+            return self.isat.nGrows()
+
+    property n_adds:
+        """Number of queries which were integrated directly and added a record."""
+        def __get__(self):
+            return self.isat.nAdds()
+
+    property n_direct:
+        """
+        Number of queries which were integrated directly without modifying the
+        table because it was full.
+        """
+        def __get__(self):
+            return self.isat.nDirect()
+
+    property n_error_checks:
+        """Number of retrievals checked against direct integration."""
+        def __get__(self):
+            return self.isat.nErrorChecks()
+
+    property max_error:
+        """Maximum error of the checked retrievals."""
+        def __get__(self):
+            return self.isat.maxError()
+
+    property mean_error:
+        """Mean error of the checked retrievals."""
+        def __get__(self):
+            return self.isat.meanError()
+
+    property tree_depth:
+        """Depth of the binary tree of records."""
+        def __get__(self):
+            return self.isat.treeDepth()
+
+
+cdef class PlugFlowReactor:
+    """
+    A steady, one-dimensional plug flow reactor with gas phase and surface
+    reactions, such as a channel of a catalytic monolith. The governing
+    equations are integrated in the axial direction as a system of
+    differential algebraic equations, with the surface species in a
+    quasi-steady state. The flow is inviscid and adiabatic, and the heat
+    released by the surface reactions is transferred to the gas. The state of
+    the contents and the surfaces is updated as the integration proceeds.
+
+    :param contents:
+        A `Solution` object representing an ideal gas. Its state when the
+        reactor is initialized is the inlet state.
+    :param surfaces:
+        A sequence of `Interface` objects representing the reacting surfaces
+        of the channel walls.
+    :param area:
+        Cross-sectional area [m^2].
+    :param surface_area_to_volume_ratio:
+        Area of the reacting surfaces per unit volume [1/m].
+    :param mass_flow_rate:
+        Mass flow rate at the inlet [kg/s].
+    :param energy:
+        Set to *False* to hold the temperature constant.
+
+    Example:
+
+    >>> r = ct.PlugFlowReactor(gas, [surf], area=1e-4, mass_flow_rate=1e-3,
+    ...                        surface_area_to_volume_ratio=1000)
+    >>> r.advance(0.05)
+
+    Requires Cantera to be built with Sundials.
+    """
+    def __cinit__(self, _SolutionBase contents, *args, **kwargs):
+        if contents.kinetics == NULL:
+            raise ValueError('Phase has no kinetics manager')
+        self.reactor = new CxxPlugFlowReactor(deref(contents.thermo),
+                                              deref(contents.kinetics))
+
+    def __init__(self, _SolutionBase contents, surfaces=(), *, area=None,
+                 surface_area_to_volume_ratio=None, mass_flow_rate=None,
+                 energy=True):
+        self._contents = contents  # prevents premature garbage collection
+        self._surfaces = []
+        for surf in surfaces:
+            self.add_surface(surf)
+        if area is not None:
+            self.area = area
+        if surface_area_to_volume_ratio is not None:
+            self.surface_area_to_volume_ratio = surface_area_to_volume_ratio
+        if mass_flow_rate is not None:
+            self.mass_flow_rate = mass_flow_rate
+        if not energy:
+            self.energy_enabled = False
+
+    def __dealloc__(self):
+        del self.reactor
+
+    def add_surface(self, _SolutionBase surface):
+        """
+        Add the reactions of the `Interface` object *surface* to the channel
+        walls. The gas must be the first phase of *surface*.
+        """
+        if not isinstance(surface, InterfaceKinetics):
+            raise TypeError('Surface must be an Interface object')
+        self.reactor.addSurface(deref(<CxxInterfaceKinetics*>surface.kinetics))
+        self._surfaces.append(surface)
+
+    property thermo:
+        """The `Solution` object contained in the reactor."""
+        def __get__(self):
+            return self._contents
+
+    property surfaces:
+        """The list of `Interface` objects of the reacting surfaces."""
+        def __get__(self):
+            return list(self._surfaces)
+
+    property area:
+        """Cross-sectional area [m^2]. Default 1 m^2."""
+        def __get__(self):
+            return self.reactor.area()
+        def __set__(self, double area):
+            self.reactor.setArea(area)
+
+    property surface_area_to_volume_ratio:
+        """
+        Area of the reacting surfaces per unit volume [1/m]. For a channel,
+        this is the perimeter divided by the cross-sectional area.
+        """
+        def __get__(self):
+            return self.reactor.surfaceAreaToVolumeRatio()
+        def __set__(self, double sv):
+            self.reactor.setSurfaceAreaToVolumeRatio(sv)
+
+    property mass_flow_rate:
+        """
+        Mass flow rate [kg/s]. Setting it sets the value at the inlet. The
+        value at the current position differs from the inlet value if there is
+        a net mass flux to the surfaces.
+        """
+        def __get__(self):
+            return self.reactor.massFlowRate()
+        def __set__(self, double mdot):
+            self.reactor.setMassFlowRate(mdot)
+
+    property energy_enabled:
+        """
+        *True* when the energy equation is being solved. When this is
+        *False*, the temperature is held constant.
+        """
+        def __get__(self):
+            return self.reactor.energyEnabled()
+        def __set__(self, pybool value):
+            self.reactor.setEnergy(value)
+
+    property max_step_size:
+        """Maximum step size [m] of the integrator."""
+        def __set__(self, double dz):
+            self.reactor.setMaxStepSize(dz)
+
+    property distance:
+        """The current axial position [m]."""
+        def __get__(self):
+            return self.reactor.distance()
+
+    property speed:
+        """The gas velocity [m/s] at the current position."""
+        def __get__(self):
+            return self.reactor.speed()
+
+    property n_jacobian_evals:
+        """Number of times the Jacobian has been evaluated."""
+        def __get__(self):
+            return self.reactor.nJacobianEvals()
+
+    def set_tolerances(self, double rtol, double atol):
+        """Set the relative and absolute tolerances of the integrator."""
+        self.reactor.setTolerances(rtol, atol)
+
+    def component_index(self, name):
+        """
+        Returns the index of the component named *name* in the solution
+        vector: ``'velocity'``, ``'density'``, ``'pressure'``,
+        ``'temperature'``, or the name of a gas or surface species.
+        """
+        k = self.reactor.componentIndex(stringify(name))
+        if k == CxxNpos:
+            raise IndexError('No such component: {!r}'.format(name))
+        return k
+
+    def get_state(self):
+        """The current solution vector."""
+        cdef int n = self.reactor.nEquations()
+        cdef double* y = self.reactor.solution()
+        return np.array([y[i] for i in range(n)])
+
+    def initialize(self, double z0=0.0):
+        """
+        Initialize the integrator at the axial position *z0* [m], taking the
+        current states of the contents and the surfaces as the inlet state.
+        The surface coverages are first brought to their steady state. Must be
+        called after the inlet state is changed.
+        """
+        self.reactor.initialize(z0)
+
+    def advance(self, double z):
+        """Advance the solution to the axial position *z* [m]."""
+        self.reactor.advance(z)
+
+
+cdef class ReactorEnsemble:
+    """
+    An ensemble of independent, closed ideal gas reactors, integrated in
+    parallel. This is more efficient than creating a separate `ReactorNet`
+    for each case when computing ignition delays or similar parameter maps
+    for many initial conditions.
+
+    :param infile:
+        Input file containing the gas phase definition.
+    :param phaseid:
+        ID of the phase within the file.
+    :param threads:
+        Number of worker threads. If 0, the number of hardware threads is
+        used. Only a single thread is used if Cantera was not built with
+        thread safety enabled.
+
+    Example:
+
+    >>> ens = ReactorEnsemble('gri30.xml', threads=4)
+    >>> states = ens.integrate(T0, P0, Y0, 0.1)
+    """
+    def __cinit__(self, infile, phaseid='', threads=0, *args, **kwargs):
+        self.ens = new CxxReactorEnsemble(stringify(infile),
+                                          stringify(phaseid), threads)
+
+    def __init__(self, infile, phaseid='', threads=0, *, constant_pressure=False,
+                 energy=True):
+        if constant_pressure:
+            self.constant_pressure = True
+        if not energy:
+            self.energy = False
+
+    def __dealloc__(self):
+        del self.ens
+
+    property n_species:
+        """Number of species in the gas phase."""
+        def __get__(self):
+            return self.ens.nSpecies()
+
+    property n_threads:
+        """Number of worker threads."""
+        def __get__(self):
+            return self.ens.nThreads()
+
+    property constant_pressure:
+        """
+        Set to *True* to integrate the reactors at constant pressure instead
+        of constant volume.
+        """
+        def __set__(self, cp):
+            self.ens.setConstantPressure(cp)
+
+    property energy:
+        """
+        Set to *False* to integrate the reactors at constant temperature.
+        """
+        def __set__(self, energy):
+            self.ens.setEnergy(energy)
+
+    def set_tolerances(self, double rtol, double atol):
+        """Set the relative and absolute tolerances of the integrator."""
+        self.ens.setTolerances(rtol, atol)
+
+    def set_max_time_step(self, double t):
+        """Set the maximum time step *t* [s] of the integrator."""
+        self.ens.setMaxTimeStep(t)
+
+    property n_failures:
+        """
+        Number of reactors which could not be integrated during the last call
+        to `integrate`. The states returned for these reactors are NaN.
+        """
+        def __get__(self):
+            return self.ens.nFailures()
+
+    property first_error:
+        """
+        Error message for the first reactor which could not be integrated
+        during the last call to `integrate`.
+        """
+        def __get__(self):
+            return pystr(self.ens.firstError())
+
+    def integrate(self, T, P, Y, times):
+        """
+        Integrate each reactor from the initial state (*T[i]*, *P[i]*,
+        *Y[i,:]*) starting at time 0. If *times* is a scalar, returns an array
+        of shape (n, m) containing the state of each reactor at that time,
+        where each row contains the temperature, the pressure and the mass
+        fractions, and m = `n_species` + 2. If *times* is a sequence of
+        increasing output times, returns an array of shape (n, len(times), m).
+        """
+        cdef np.ndarray[np.double_t, ndim=1] T_ = \
+            np.ascontiguousarray(T, dtype=np.double).ravel()
+        cdef size_t n = len(T_)
+        cdef np.ndarray[np.double_t, ndim=1] P_ = \
+            np.ascontiguousarray(np.broadcast_to(P, (n,)), dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=2] Y_ = \
+            np.ascontiguousarray(np.broadcast_to(Y, (n, self.n_species)),
+                                 dtype=np.double)
+        cdef np.ndarray[np.double_t, ndim=1] times_ = \
+            np.ascontiguousarray(times, dtype=np.double).ravel()
+        cdef size_t nt = len(times_)
+        cdef size_t m = self.ens.stateSize()
+        cdef np.ndarray[np.double_t, ndim=3] states = np.empty((n, nt, m))
+        if n == 0:
+            return states[:,0,:] if np.isscalar(times) else states
+
+        self.ens.integrate(n, &T_[0], &P_[0], &Y_[0,0], nt, &times_[0],
+                           &states[0,0,0])
+        if np.isscalar(times):
+            return states[:,0,:]
+        return states
+
+    def __reduce__(self):
+        raise NotImplementedError('ReactorEnsemble object is not picklable')
+
+    def __copy__(self):
+        raise NotImplementedError('ReactorEnsemble object is not copyable')
@@ -234,6 +234,24 @@ class TestFreeFlame(utilities.CanteraTest):
         # TODO: check that the solution is actually correct (i.e. that the
         # residual satisfies the error tolerances) on the new grid.
 
+    def test_coarsen(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = ct.one_atm
+        Tin = 300
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        self.solve_mix(slope=0.1, curve=0.1)
+        N1 = len(self.sim.grid)
+        Su1 = self.sim.u[0]
+
+        self.sim.set_coarsen_threshold(0.5)
+        self.solve_mix(slope=0.3, curve=0.3)
+        N2 = len(self.sim.grid)
+
+        self.assertLess(N2, N1)
+        self.assertNear(self.sim.u[0], Su1, 1e-1)
+
     def test_save_restore(self):
         reactants= 'H2:1.1, O2:1, AR:5'
         p = 2 * ct.one_atm
@@ -287,6 +305,40 @@ class TestFreeFlame(utilities.CanteraTest):
         self.assertArrayNear(u1, u3, 1e-3)
         self.assertArrayNear(V1, V3, 1e-3)
 
+    def test_save_restore_checkpoint(self):
+        reactants= 'H2:1.1, O2:1, AR:5'
+        p = 2 * ct.one_atm
+        Tin = 400
+
+        self.create_sim(p, Tin, reactants)
+        self.solve_fixed_T()
+        filename = 'onedim-fixed-T.chk'
+        if os.path.exists(filename):
+            os.remove(filename)
+
+        self.sim.save_checkpoint(filename)
+        Y1 = self.sim.Y
+        u1 = self.sim.u
+        z1 = self.sim.grid
+
+        # Create flame object with dummy initial grid
+        self.sim = ct.FreeFlame(self.gas)
+        self.sim.restore_checkpoint(filename, loglevel=0)
+
+        self.assertFalse(self.sim.energy_enabled)
+        self.assertNear(self.sim.P, p)
+        rtol, atol = self.sim.flame.tolerances('T')
+        self.assertNear(rtol, self.tol_ss[0])
+        self.assertNear(atol, self.tol_ss[1])
+        self.assertArrayNear(z1, self.sim.grid)
+        self.assertArrayNear(Y1, self.sim.Y, 1e-14)
+        self.assertArrayNear(u1, self.sim.u, 1e-14)
+
+        # A checkpoint cannot be restored into a different mechanism
+        self.sim = ct.FreeFlame(ct.Solution('h2o2-plus.xml'))
+        with self.assertRaises(Exception):
+            self.sim.restore_checkpoint(filename, loglevel=0)
+
     def test_array_properties(self):
         self.create_sim(ct.one_atm, 300, 'H2:1.1, O2:1, AR:5')
 
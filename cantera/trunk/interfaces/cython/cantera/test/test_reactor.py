@@ -503,6 +503,63 @@ class TestReactor(utilities.CanteraTest):
         self.assertNear(T1a, T1b)
         self.assertNear(T2a, T2b)
 
+    def test_linear_solver_type(self):
+        T = []
+        for solver in ('dense', 'gmres'):
+            self.make_reactors(T1=300, T2=1000, P2=2*ct.one_atm)
+            self.add_wall(U=200, A=1.0, K=1e-5)
+            self.net.linear_solver_type = solver
+            self.assertEqual(self.net.linear_solver_type, solver)
+            self.net.advance(1.0)
+            T.append((self.r1.T, self.r2.T))
+
+        self.assertNear(T[0][0], T[1][0], 1e-6)
+        self.assertNear(T[0][1], T[1][1], 1e-6)
+
+        with self.assertRaises(Exception):
+            self.net.linear_solver_type = 'spam'
+
+    def test_sample_trajectory(self):
+        self.make_reactors(T1=300, T2=1000, P2=2*ct.one_atm)
+        self.add_wall(U=200, A=1.0)
+        times = np.linspace(0.1, 1.0, 10)
+        data = self.net.sample_trajectory(times,
+                                          components=['volume', 'O2'],
+                                          reactor=self.r2)
+        self.assertEqual(data.shape, (10, 2))
+        self.assertNear(self.net.time, 1.0)
+        self.assertNear(data[-1,0], self.r2.volume, 1e-6)
+        self.assertNear(data[-1,1], self.r2.Y[self.gas2.species_index('O2')],
+                        1e-6)
+
+        # compare with the states obtained by advancing to each time
+        self.make_reactors(T1=300, T2=1000, P2=2*ct.one_atm)
+        self.add_wall(U=200, A=1.0)
+        for i,t in enumerate(times):
+            self.net.advance(t)
+            self.assertNear(data[i,0], self.r2.volume, 1e-6)
+
+        full = self.net.sample_trajectory([1.5, 2.0])
+        self.assertEqual(full.shape, (2, self.net.n_vars))
+
+    def test_sample_trajectory_after_advance(self):
+        # The last internal step taken by advance() generally extends past
+        # the requested time, so the first output times lie within that step
+        times = np.linspace(0.501, 0.6, 100)
+        self.make_reactors(T1=300, T2=1000, P2=2*ct.one_atm)
+        self.add_wall(U=200, A=1.0)
+        self.net.advance(0.01)
+        self.net.advance(0.5)
+        data = self.net.sample_trajectory(times, components=['volume'],
+                                          reactor=self.r2)
+        self.assertNear(self.net.time, 0.6)
+
+        self.make_reactors(T1=300, T2=1000, P2=2*ct.one_atm)
+        self.add_wall(U=200, A=1.0)
+        for i,t in enumerate(times):
+            self.net.advance(t)
+            self.assertNear(data[i,0], self.r2.volume, 1e-6)
+
     def test_unpicklable(self):
         self.make_reactors()
         import pickle
@@ -893,6 +950,401 @@ class TestWallKinetics(utilities.CanteraTest):
         self.assertFalse(bool(bad), bad)
 
 
+class TestClosedReactor(utilities.CanteraTest):
+    def compare(self, constant_pressure, energy=True):
+        gas1 = ct.Solution('gri30.xml')
+        gas1.TPX = 1200, ct.one_atm, 'CH4:1, O2:2, N2:7.52'
+        r1 = ct.ClosedReactor(gas1, constant_pressure, energy=energy)
+        self.assertEqual(r1.constant_pressure, constant_pressure)
+        self.assertEqual(r1.energy_enabled, energy)
+
+        gas2 = ct.Solution('gri30.xml')
+        gas2.TPX = 1200, ct.one_atm, 'CH4:1, O2:2, N2:7.52'
+        if constant_pressure:
+            r2 = ct.IdealGasConstPressureReactor(gas2, energy='on' if energy else 'off')
+        else:
+            r2 = ct.IdealGasReactor(gas2, energy='on' if energy else 'off')
+        net = ct.ReactorNet([r2])
+
+        for t in [1e-3, 0.02, 0.05, 0.1]:
+            r1.advance(t)
+            net.advance(t)
+            self.assertNear(r1.time, t)
+            self.assertNear(gas1.T, gas2.T, 1e-6)
+            self.assertNear(gas1.P, gas2.P, 1e-6)
+            self.assertArrayNear(gas1.Y, gas2.Y, 1e-5, 1e-12)
+        self.assertTrue(r1.n_jacobian_evals > 0)
+
+    def test_const_volume(self):
+        self.compare(False)
+
+    def test_const_pressure(self):
+        self.compare(True)
+
+    def test_isothermal(self):
+        self.compare(True, False)
+
+    def test_restart(self):
+        gas = ct.Solution('h2o2.xml')
+        r = ct.ClosedReactor(gas)
+        T = []
+        for i in range(2):
+            gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+            r.set_initial_time(0.0)
+            while r.step(1e-3) < 1e-3:
+                pass
+            T.append(gas.T)
+        self.assertNear(T[0], T[1], 1e-12)
+        self.assertTrue(T[0] > 2000)
+
+    def test_integrate_cells(self):
+        gas = ct.Solution('h2o2.xml')
+        T0 = np.linspace(1000, 1010, 5)
+        gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        Y0 = gas.Y
+        dt = 2e-5
+
+        r = ct.ClosedReactor(gas, True)
+        r.set_tolerances(1e-9, 1e-15)
+        r.jacobian_reuse = 0.05
+        T, Y = r.integrate_cells(dt, T0, ct.one_atm, Y0)
+        self.assertEqual(T.shape, (5,))
+        self.assertEqual(Y.shape, (5, gas.n_species))
+        self.assertTrue(r.n_jacobian_reuses >= 4)
+
+        for i in range(5):
+            gas.TPY = T0[i], ct.one_atm, Y0
+            ref = ct.ClosedReactor(gas, True)
+            ref.set_tolerances(1e-9, 1e-15)
+            ref.advance(dt)
+            self.assertNear(T[i], gas.T, 1e-8)
+            self.assertArrayNear(Y[i], gas.Y, 1e-6, 1e-14)
+
+    def test_bad_phase(self):
+        water = ct.PureFluid('liquidvapor.xml', 'water')
+        with self.assertRaises(Exception):
+            ct.ClosedReactor(water)
+
+
+class TestISATReactor(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1500, ct.one_atm, 'H2:2, O2:1, AR:4'
+        self.Y0 = self.gas.Y
+        self.T0 = 1500 + 1e-3 * np.arange(20)
+
+    def test_retrieve(self):
+        dt = 1e-5
+        r = ct.ISATReactor(self.gas, True)
+        r.tolerance = 1e-4
+        r.error_check_interval = 1
+        T, Y = r.integrate_cells(dt, self.T0, ct.one_atm, self.Y0)
+        self.assertEqual(r.n_queries, 20)
+        self.assertEqual(r.n_adds, 1)
+        self.assertEqual(r.n_records, 1)
+        self.assertEqual(r.n_retrieves + r.n_grows + r.n_adds, 20)
+        self.assertTrue(r.n_retrieves > 10)
+        self.assertEqual(r.n_error_checks, r.n_retrieves)
+        self.assertTrue(r.max_error < 1e-4)
+        self.assertTrue(r.mean_error <= r.max_error)
+
+        for i in (0, 10, 19):
+            self.gas.TPY = self.T0[i], ct.one_atm, self.Y0
+            ref = ct.ClosedReactor(self.gas, True)
+            ref.advance(dt)
+            self.assertNear(T[i], self.gas.T, 1e-4)
+            self.assertArrayNear(Y[i], self.gas.Y, 1e-4, 1e-4)
+
+        r.clear()
+        self.assertEqual(r.n_records, 0)
+        self.assertEqual(r.n_queries, 0)
+
+    def test_add(self):
+        # Distinct time steps are not within the same region of accuracy
+        r = ct.ISATReactor(self.gas, False)
+        for dt in (1e-5, 1e-4, 1e-3):
+            self.gas.TPY = 1500, ct.one_atm, self.Y0
+            r.substep(dt)
+        self.assertEqual(r.n_adds, 3)
+        self.assertEqual(r.tree_depth, 3)
+
+        r.max_records = 3
+        self.gas.TPY = 1200, 10 * ct.one_atm, self.Y0
+        r.substep(1e-4)
+        self.assertEqual(r.n_records, 3)
+        self.assertEqual(r.n_direct, 1)
+
+    def test_bad_tolerance(self):
+        r = ct.ISATReactor(self.gas)
+        with self.assertRaises(Exception):
+            r.tolerance = 0
+
+
+class TestPlugFlowReactor(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('methane_pox_on_pt.xml', 'gas')
+        self.gas.TPX = 1073.15, ct.one_atm, 'CH4:1, O2:1.5, AR:0.1'
+        self.surf = ct.Interface('methane_pox_on_pt.xml', 'Pt_surf',
+                                 [self.gas])
+        self.surf.TP = self.gas.TP
+
+    def test_bad_input(self):
+        r = ct.PlugFlowReactor(self.gas)
+        with self.assertRaises(TypeError):
+            r.add_surface(self.gas)
+        with self.assertRaises(Exception):
+            r.area = -1.0
+        with self.assertRaises(Exception):
+            r.mass_flow_rate = 0.0
+        with self.assertRaises(IndexError):
+            r.component_index('spam')
+
+    def test_components(self):
+        r = ct.PlugFlowReactor(self.gas, [self.surf])
+        self.assertEqual(r.component_index('velocity'), 0)
+        self.assertEqual(r.component_index('temperature'), 3)
+        self.assertEqual(r.component_index(self.gas.species_name(0)), 4)
+        self.assertEqual(r.component_index(self.surf.species_name(0)),
+                         4 + self.gas.n_species)
+
+    @unittest.skipUnless(ct._have_sundials(), "Requires Sundials")
+    def test_isothermal(self):
+        # Methane partial oxidation in a catalytic channel at constant
+        # temperature. The reference value is from an explicit march with
+        # quasi-steady coverages and from a long chain of small CSTRs.
+        r = ct.PlugFlowReactor(self.gas, [self.surf], area=0.3e-4,
+                               surface_area_to_volume_ratio=1e5,
+                               mass_flow_rate=0.4/60*self.gas.density*1e-4,
+                               energy=False)
+        r.advance(0.003)
+        self.assertNear(r.distance, 0.003)
+        self.assertNear(self.gas.T, 1073.15)
+        self.assertNear(self.gas['CH4'].X[0], 0.0187, 1e-2)
+        self.assertNear(sum(self.surf.coverages), 1.0, 1e-8)
+
+    @unittest.skipUnless(ct._have_sundials(), "Requires Sundials")
+    def test_conservation(self):
+        # Catalytic ignition. Mass and total enthalpy are conserved because
+        # the surfaces have no net production at steady state.
+        gas = ct.Solution('ptcombust.xml', 'gas')
+        gas.TPX = 900, ct.one_atm, 'CH4:0.095, O2:0.21, AR:0.695'
+        surf = ct.Interface('ptcombust.xml', 'Pt_surf', [gas])
+        surf.TP = gas.TP
+        area = 0.3e-4
+        r = ct.PlugFlowReactor(gas, [surf], area=area, mass_flow_rate=3e-4,
+                               surface_area_to_volume_ratio=1e5)
+        r.set_tolerances(1e-8, 1e-15)
+        mdot0 = r.mass_flow_rate
+        htot0 = gas.enthalpy_mass + 0.5 * (mdot0 / (gas.density * area))**2
+        r.advance(0.005)
+
+        self.assertTrue(gas.T > 2200)
+        self.assertNear(r.mass_flow_rate, mdot0, 1e-4)
+        self.assertNear(gas.enthalpy_mass + 0.5 * r.speed**2, htot0, 1e-4)
+        self.assertTrue(r.n_jacobian_evals > 0)
+
+
+class TestReactorEnsemble(utilities.CanteraTest):
+    def test_integrate(self):
+        gas = ct.Solution('h2o2.xml')
+        T0 = np.array([900.0, 1000.0, 1100.0, 1200.0])
+        gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        times = [1e-4, 1e-3]
+        ens = ct.ReactorEnsemble('h2o2.xml', threads=2)
+        states = ens.integrate(T0, ct.one_atm, gas.Y, times)
+        self.assertEqual(states.shape, (4, 2, gas.n_species + 2))
+        self.assertEqual(ens.n_failures, 0)
+
+        for i in range(len(T0)):
+            gas.TPX = T0[i], ct.one_atm, 'H2:2, O2:1, AR:4'
+            r = ct.IdealGasReactor(gas)
+            net = ct.ReactorNet([r])
+            for j, t in enumerate(times):
+                net.advance(t)
+                self.assertNear(states[i,j,0], r.T, 1e-6)
+                self.assertNear(states[i,j,1], r.thermo.P, 1e-6)
+                self.assertArrayNear(states[i,j,2:], r.Y, 1e-6, 1e-12)
+
+    def test_const_pressure(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1200, ct.one_atm, 'H2:2, O2:1, AR:4'
+        ens = ct.ReactorEnsemble('h2o2.xml', constant_pressure=True)
+        states = ens.integrate([1200.0], ct.one_atm, gas.Y, 1e-3)
+        self.assertEqual(states.shape, (1, gas.n_species + 2))
+        self.assertNear(states[0,1], ct.one_atm)
+        self.assertTrue(states[0,0] > 1500)
+
+    def test_failure(self):
+        gas = ct.Solution('h2o2.xml')
+        gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        ens = ct.ReactorEnsemble('h2o2.xml')
+        states = ens.integrate([-100.0, 1000.0], ct.one_atm, gas.Y, 1e-4)
+        self.assertEqual(ens.n_failures, 1)
+        self.assertTrue(ens.first_error)
+        self.assertTrue(np.isnan(states[0]).all())
+        self.assertTrue(np.isfinite(states[1]).all())
+
+
+
+class TestReactorNetSteadyState(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 300, ct.one_atm, 'H2:2, O2:1, AR:4'
+        self.inlet = ct.Reservoir(self.gas)
+        self.gas.equilibrate('HP')
+        self.r1 = ct.IdealGasReactor(self.gas, volume=1e-3)
+        self.r2 = ct.IdealGasReactor(self.gas, volume=2e-3)
+        self.exhaust = ct.Reservoir(self.gas)
+        self.mdot = self.gas.density * 1e-3 / 1e-4
+        self.mfc = ct.MassFlowController(self.inlet, self.r1, mdot=self.mdot)
+        ct.PressureController(self.r1, self.r2, master=self.mfc, K=1e-2)
+        ct.Valve(self.r2, self.exhaust, K=1e-2)
+        self.net = ct.ReactorNet([self.r1, self.r2])
+
+    def state(self):
+        return np.hstack([self.r1.T, self.r1.mass, self.r1.thermo.Y,
+                          self.r2.T, self.r2.mass, self.r2.thermo.Y])
+
+    def test_steady_state(self):
+        self.net.solve_steady()
+        iterations, steps, jacobians = self.net.steady_stats
+        self.assertTrue(iterations > 0)
+        self.assertEqual(self.net.time, 0.0)
+        steady = self.state()
+
+        self.net.advance(0.05)
+        self.assertArrayNear(steady, self.state(), 1e-6, 1e-12)
+
+        # Solution starting from the previous steady state
+        self.mfc.set_mass_flow_rate(0.8 * self.mdot)
+        self.net.solve_steady()
+        iterations, steps, jacobians = self.net.steady_stats
+        self.assertEqual(steps, 0)
+        self.assertTrue(jacobians <= 3)
+        steady = self.state()
+
+        self.net.set_initial_time(0)
+        self.net.advance(0.05)
+        self.assertArrayNear(steady, self.state(), 1e-6, 1e-12)
+
+    def test_tolerances(self):
+        self.net.rtol_steady = 1e-6
+        self.net.atol_steady = 1e-12
+        self.assertEqual(self.net.rtol_steady, 1e-6)
+        self.assertEqual(self.net.atol_steady, 1e-12)
+        self.net.solve_steady()
+        steady = self.state()
+        self.net.advance(0.05)
+        self.assertArrayNear(steady, self.state(), 1e-4, 1e-8)
+
+    def test_max_time_steps(self):
+        self.net.max_steady_time_steps = 1
+        with self.assertRaises(Exception):
+            self.net.solve_steady()
+
+
+class TestReactorEvents(utilities.CanteraTest):
+    def setUp(self):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        self.r = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r])
+
+    def test_threshold(self):
+        e = self.net.add_threshold_event('temperature', 1500)
+        self.net.advance(1.0)
+        self.assertEqual(self.net.last_event, e)
+        self.assertNear(self.r.T, 1500, 1e-6)
+        self.assertEqual(len(self.net.event_times(e)), 1)
+        self.assertNear(self.net.event_times(e)[0], self.net.time)
+
+        # continue past the event to the requested time
+        self.net.advance(1.0)
+        self.assertTrue(self.net.last_event is None)
+        self.assertNear(self.net.time, 1.0)
+
+    def test_ignition_delay(self):
+        e1 = self.net.add_max_rate_event('temperature')
+        e2 = self.net.add_peak_event('H2O2', terminal=False)
+        self.assertEqual(self.net.n_events, 2)
+        self.net.advance(1.0)
+        self.assertEqual(self.net.last_event, e1)
+        tig = self.net.time
+        self.assertTrue(len(self.net.event_times(e2)) > 0)
+        self.assertTrue(self.net.event_times(e2)[-1] < tig)
+
+        # compare with the maximum of dT/dt sampled at fixed intervals
+        self.gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        r = ct.IdealGasReactor(self.gas)
+        net = ct.ReactorNet([r])
+        dt = 2e-7
+        t = np.arange(dt, 2*tig, dt)
+        T = []
+        for tt in t:
+            net.advance(tt)
+            T.append(r.T)
+        i = np.argmax(np.diff(T))
+        self.assertNear(t[i] + 0.5 * dt, tig, 1e-2)
+
+    def test_bad_component(self):
+        with self.assertRaises(Exception):
+            self.net.add_threshold_event('spam', 1.0)
+
+
+class TestReactorNetAdjoint(utilities.CanteraTest):
+    def make_net(self, threshold=None):
+        self.gas = ct.Solution('h2o2.xml')
+        self.gas.TPX = 1000, ct.one_atm, 'H2:2, O2:1, AR:4'
+        self.r = ct.IdealGasReactor(self.gas)
+        self.net = ct.ReactorNet([self.r])
+        self.net.rtol = 1e-12
+        self.net.atol = 1e-20
+        if threshold:
+            self.net.add_threshold_event('temperature', threshold)
+
+    def finite_difference(self, i, objective, t, threshold=None):
+        values = []
+        for mult in (1 + 1e-4, 1 - 1e-4):
+            self.make_net(threshold)
+            self.gas.set_multiplier(mult, i)
+            self.net.advance(t)
+            values.append(objective())
+        return (values[0] - values[1]) / 2e-4
+
+    def test_species(self):
+        self.make_net()
+        adj = ct.ReactorNetAdjoint(self.net)
+        adj.advance(2.3e-4)
+        self.assertNear(self.net.time, 2.3e-4)
+        self.assertTrue(adj.n_checkpoints > 2)
+        adj.solve('H2O')
+        S = adj.sensitivities()
+        self.assertEqual(len(S), self.gas.n_reactions)
+
+        k = self.gas.species_index('H2O')
+        for i in np.argsort(-abs(S))[:3]:
+            fd = self.finite_difference(i, lambda: self.r.Y[k], 2.3e-4)
+            self.assertNear(S[i], fd, 2e-3)
+
+    def test_ignition_delay(self):
+        self.make_net(1500)
+        adj = ct.ReactorNetAdjoint(self.net)
+        adj.advance(1.0)
+        adj.solve_crossing_time('temperature')
+        S = adj.sensitivities()
+
+        for i in np.argsort(-abs(S))[:3]:
+            fd = self.finite_difference(i, lambda: self.net.time, 1.0, 1500)
+            self.assertNear(S[i], fd, 2e-3)
+
+    def test_bad_component(self):
+        self.make_net()
+        adj = ct.ReactorNetAdjoint(self.net)
+        adj.advance(1e-4)
+        with self.assertRaises(Exception):
+            adj.solve('spam')
+
+
 @unittest.skipUnless(ct._have_sundials(),
                      "Sensitivity calculations require Sundials")
 class TestReactorSensitivities(utilities.CanteraTest):
@@ -128,6 +128,28 @@ class TestThermoPhase(utilities.CanteraTest):
         self.assertNear(Y[0], 0.25)
         self.assertNear(Y[3], 0.75)
 
+    def test_setCompositionCompiled(self):
+        comp = self.phase.composition('H2:1.0, O2:3.0')
+        self.assertEqual(comp.species_indices, [0, 3])
+        self.phase.X = 'AR:1.0'
+        self.phase.X = comp
+        X = self.phase.X
+        self.assertNear(X[0], 0.25)
+        self.assertNear(X[3], 0.75)
+        self.assertNear(X[8], 0.0)
+
+        self.phase.Y = self.phase.composition({'H2':1.0, 'O2':3.0})
+        Y = self.phase.Y
+        self.assertNear(Y[0], 0.25)
+        self.assertNear(Y[3], 0.75)
+
+        self.phase.TPX = 500, 2e5, comp
+        self.assertNear(self.phase.T, 500)
+        self.assertNear(self.phase.X[3], 0.75)
+
+        with self.assertRaises(Exception):
+            self.phase.composition('H2:1.0, CO2:1.5')
+
     def test_getCompositionDict(self):
         self.phase.X = 'OH:1e-9, O2:0.4, AR:0.6'
         self.assertEqual(len(self.phase.mole_fraction_dict(1e-7)), 2)
@@ -14,6 +14,23 @@ cdef stdmap[string,double] comp_map(dict X) except *:
     return m
 
 
+cdef class Composition:
+    """
+    A species composition with the species names resolved to species
+    indices. Created by `ThermoPhase.composition`, and usable with that phase
+    or any phase with the same species in the same order.
+    """
+    property species_indices:
+        """Indices of the species included in the composition."""
+        def __get__(self):
+            return [k for k in self.comp.index]
+
+    property values:
+        """Unnormalized fractions of the species in `species_indices`."""
+        def __get__(self):
+            return [v for v in self.comp.value]
+
+
 cdef class ThermoPhase(_SolutionBase):
     """
     A phase with an equation of state.
@@ -282,18 +299,21 @@ cdef class ThermoPhase(_SolutionBase):
     property Y:
         """
         Get/Set the species mass fractions. Can be set as an array, as a dictionary,
-        or as a string. Always returns an array::
+        as a string, or as a `Composition`. Always returns an array::
 
             >>> phase.Y = [0.1, 0, 0, 0.4, 0, 0, 0, 0, 0.5]
             >>> phase.Y = {'H2':0.1, 'O2':0.4, 'AR':0.5}
             >>> phase.Y = 'H2:0.1, O2:0.4, AR:0.5'
+            >>> phase.Y = phase.composition('H2:0.1, O2:0.4, AR:0.5')
             >>> phase.Y
             array([0.1, 0, 0, 0.4, 0, 0, 0, 0, 0.5])
         """
         def __get__(self):
             return self._getArray1(thermo_getMassFractions)
         def __set__(self, Y):
-            if isinstance(Y, (str, unicode)):
+            if isinstance(Y, Composition):
+                self.thermo.setMassFractions_Sparse((<Composition>Y).comp)
+            elif isinstance(Y, (str, unicode)):
                 self.thermo.setMassFractionsByName(stringify(Y))
             elif isinstance(Y, dict):
                 self.thermo.setMassFractionsByName(comp_map(Y))
@@ -303,18 +323,21 @@ cdef class ThermoPhase(_SolutionBase):
     property X:
         """
         Get/Set the species mole fractions. Can be set as an array, as a dictionary,
-        or as a string. Always returns an array::
+        as a string, or as a `Composition`. Always returns an array::
 
             >>> phase.X = [0.1, 0, 0, 0.4, 0, 0, 0, 0, 0.5]
             >>> phase.X = {'H2':0.1, 'O2':0.4, 'AR':0.5}
             >>> phase.X = 'H2:0.1, O2:0.4, AR:0.5'
+            >>> phase.X = phase.composition('H2:0.1, O2:0.4, AR:0.5')
             >>> phase.X
             array([0.1, 0, 0, 0.4, 0, 0, 0, 0, 0.5])
         """
         def __get__(self):
             return self._getArray1(thermo_getMoleFractions)
         def __set__(self, X):
-            if isinstance(X, (str, unicode)):
+            if isinstance(X, Composition):
+                self.thermo.setMoleFractions_Sparse((<Composition>X).comp)
+            elif isinstance(X, (str, unicode)):
                 self.thermo.setMoleFractionsByName(stringify(X))
             elif isinstance(X, dict):
                 self.thermo.setMoleFractionsByName(comp_map(X))
@@ -393,6 +416,27 @@ cdef class ThermoPhase(_SolutionBase):
             raise ValueError("Array has incorrect length")
         self.thermo.setMoleFractions_NoNorm(&data[0])
 
+    def composition(self, values):
+        """
+        Resolve the species names in a composition string or dictionary to
+        species indices, and return a `Composition` that can be assigned to
+        `X` or `Y` (and to `TPX`, `TPY`, etc.). Assigning a `Composition` is
+        faster than assigning the string or dictionary it was created from,
+        which is useful when the state is set repeatedly inside a loop::
+
+            >>> fuel = gas.composition('CH4:1, O2:2, N2:7.52')
+            >>> for T in temperatures:
+            ...     gas.TPX = T, ct.one_atm, fuel
+        """
+        cdef Composition comp = Composition()
+        if isinstance(values, (str, unicode)):
+            comp.comp = self.thermo.compileComposition(stringify(values))
+        elif isinstance(values, dict):
+            comp.comp = self.thermo.compileComposition(comp_map(values))
+        else:
+            raise TypeError("Expected a string or a dict")
+        return comp
+
     def mass_fraction_dict(self, double threshold=0.0):
         Y = self.thermo.getMassFractionsByName(threshold)
         return {pystr(item.first):item.second for item in Y}
@@ -0,0 +1,112 @@
+/*
+ * Compare the cost of evaluating the state of a real-gas mixture with the
+ * Redlich-Kwong and Peng-Robinson equations of state. For each model, the
+ * density, enthalpy and heat capacity are computed for a set of
+ * temperatures, pressures and compositions, first by setting the state of
+ * the phase one point at a time, and then with a single call to
+ * getMassProperties().
+ */
+
+#include "cantera/thermo.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/PengRobinsonMFTP.h"
+
+#include <cstdio>
+#include <ctime>
+
+using namespace Cantera;
+
+static double seconds(clock_t t0)
+{
+    return double(clock() - t0) / CLOCKS_PER_SEC;
+}
+
+//! Evaluate the states one at a time. Returns the time per state in seconds.
+static double timeStates(ThermoPhase& phase, size_t nStates, const vector_fp& T,
+                         const vector_fp& P, const vector_fp& Y, int nRepeat,
+                         double& check)
+{
+    size_t kk = phase.nSpecies();
+    check = 0.0;
+    clock_t t0 = clock();
+    for (int n = 0; n < nRepeat; n++) {
+        for (size_t i = 0; i < nStates; i++) {
+            phase.setState_TPY(T[i], P[i], &Y[i*kk]);
+            check += phase.density() + phase.enthalpy_mass() + phase.cp_mass();
+        }
+    }
+    return seconds(t0) / (nRepeat * nStates);
+}
+
+//! Evaluate all states with one call. Returns the time per state in seconds.
+template<class Model>
+double timeBatch(Model& phase, size_t nStates, const vector_fp& T,
+                 const vector_fp& P, const vector_fp& Y, int nRepeat,
+                 double& check)
+{
+    vector_fp rho(nStates), cp(nStates), h(nStates);
+    check = 0.0;
+    clock_t t0 = clock();
+    for (int n = 0; n < nRepeat; n++) {
+        phase.getMassProperties(nStates, &T[0], &P[0], &Y[0], &rho[0], &cp[0], &h[0]);
+        for (size_t i = 0; i < nStates; i++) {
+            check += rho[i] + h[i] + cp[i];
+        }
+    }
+    return seconds(t0) / (nRepeat * nStates);
+}
+
+void demoprog()
+{
+    RedlichKwongMFTP rk("co2_cubic.xml", "co2_rk");
+    PengRobinsonMFTP pr("co2_cubic.xml", "co2_pr");
+    size_t kk = rk.nSpecies();
+
+    // Supercritical CO2 with impurities, as in a power cycle
+    const size_t nStates = 1000;
+    vector_fp T(nStates), P(nStates), Y(nStates * kk);
+    for (size_t i = 0; i < nStates; i++) {
+        double f = double(i) / nStates;
+        T[i] = 320.0 + 800.0 * f;
+        P[i] = 8.0E6 + 2.2E7 * (1.0 - f);
+        Y[i*kk] = 0.90 - 0.05 * f; // CO2
+        Y[i*kk+1] = 0.02 + 0.05 * f; // H2O
+        Y[i*kk+2] = 0.03; // CH4
+        Y[i*kk+3] = 0.03; // N2
+        Y[i*kk+4] = 0.02; // O2
+    }
+    const int nRepeat = 20;
+    double c1, c2, c3, c4;
+
+    double tRK = timeStates(rk, nStates, T, P, Y, nRepeat, c1);
+    double tPR = timeStates(pr, nStates, T, P, Y, nRepeat, c2);
+    double tRKb = timeBatch(rk, nStates, T, P, Y, nRepeat, c3);
+    double tPRb = timeBatch(pr, nStates, T, P, Y, nRepeat, c4);
+
+    printf("Time per state (microseconds), %d species:\n", int(kk));
+    printf("                     setState_TPY   getMassProperties\n");
+    printf("  Redlich-Kwong      %12.3f   %17.3f\n", 1e6 * tRK, 1e6 * tRKb);
+    printf("  Peng-Robinson      %12.3f   %17.3f\n", 1e6 * tPR, 1e6 * tPRb);
+    printf("\nState at T = %g K, P = %g Pa:\n", T[0], P[0]);
+    rk.setState_TPY(T[0], P[0], &Y[0]);
+    pr.setState_TPY(T[0], P[0], &Y[0]);
+    printf("  Redlich-Kwong: rho = %10.4f kg/m^3, cp = %10.2f J/kg/K\n",
+           rk.density(), rk.cp_mass());
+    printf("  Peng-Robinson: rho = %10.4f kg/m^3, cp = %10.2f J/kg/K\n",
+           pr.density(), pr.cp_mass());
+    // Use the accumulated values so that the evaluations are not optimized away
+    if (c1 + c2 + c3 + c4 == 0.0) {
+        printf("\n");
+    }
+}
+
+int main()
+{
+    try {
+        demoprog();
+    } catch (CanteraError& err) {
+        std::cout << err.what() << std::endl;
+        return -1;
+    }
+    return 0;
+}
@@ -27,4 +27,32 @@ void ValueCache::clear()
     m_arrayCache.clear();
 }
 
+size_t ValueCache::hits() const
+{
+    size_t n = 0;
+    for (std::map<int, CachedValue<double> >::const_iterator iter =
+             m_scalarCache.begin(); iter != m_scalarCache.end(); iter++) {
+        n += iter->second.hits;
+    }
+    for (std::map<int, CachedValue<vector_fp> >::const_iterator iter =
+             m_arrayCache.begin(); iter != m_arrayCache.end(); iter++) {
+        n += iter->second.hits;
+    }
+    return n;
+}
+
+size_t ValueCache::misses() const
+{
+    size_t n = 0;
+    for (std::map<int, CachedValue<double> >::const_iterator iter =
+             m_scalarCache.begin(); iter != m_scalarCache.end(); iter++) {
+        n += iter->second.misses;
+    }
+    for (std::map<int, CachedValue<vector_fp> >::const_iterator iter =
+             m_arrayCache.begin(); iter != m_arrayCache.end(); iter++) {
+        n += iter->second.misses;
+    }
+    return n;
+}
+
 }
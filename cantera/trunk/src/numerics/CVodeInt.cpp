@@ -18,6 +18,9 @@ using namespace std;
 
 #include "cantera/base/stringUtils.h"
 
+#include <cfloat>
+#include <cstdlib>
+
 extern "C" {
 
     /**
@@ -72,6 +75,43 @@ extern "C" {
             ydata[j] = ysave;
         }
     }
+
+    /**
+     *  Function called by cvode to compute and factor the preconditioner
+     *  for the GMRES linear solver.
+     *  @ingroup odeGroup
+     */
+    static int cvode_precond(integer N, real t, N_Vector y, N_Vector fy,
+                             boole jok, boole* jcurPtr, real gamma,
+                             N_Vector ewt, real h, real uround,
+                             long int* nfePtr, void* P_data,
+                             N_Vector vtemp1, N_Vector vtemp2,
+                             N_Vector vtemp3)
+    {
+        Cantera::FuncEval* f = (Cantera::FuncEval*)P_data;
+        try {
+            *jcurPtr = f->preconditionerSetup(t, N_VDATA(y), N_VDATA(fy),
+                                              jok, gamma);
+        } catch (Cantera::CanteraError& err) {
+            Cantera::popError();
+            return 1; // recoverable; retried with a new Jacobian
+        }
+        return 0;
+    }
+
+    /**
+     *  Function called by cvode to apply the preconditioner.
+     *  @ingroup odeGroup
+     */
+    static int cvode_psolve(integer N, real t, N_Vector y, N_Vector fy,
+                            N_Vector vtemp, real gamma, N_Vector ewt,
+                            real delta, long int* nfePtr, N_Vector r,
+                            int lr, void* P_data, N_Vector z)
+    {
+        Cantera::FuncEval* f = (Cantera::FuncEval*)P_data;
+        f->preconditionerSolve(N_VDATA(r), N_VDATA(z));
+        return 0;
+    }
 }
 
 namespace Cantera
@@ -90,7 +130,13 @@ CVodeInt::CVodeInt() : m_neq(0),
     m_abstols(1.e-15),
     m_nabs(0),
     m_hmax(0.0),
-    m_maxsteps(20000)
+    m_maxsteps(20000),
+    m_time(0.0),
+    m_func(0),
+    m_nroots(0),
+    m_ytmp(0),
+    m_tg(0.0),
+    m_rootFound(false)
 {
     m_ropt.resize(OPT_SIZE,0.0);
     m_iopt = new long[OPT_SIZE];
@@ -108,6 +154,9 @@ CVodeInt::~CVodeInt()
     if (m_abstol) {
         N_VFree(m_abstol);
     }
+    if (m_ytmp) {
+        N_VFree(m_ytmp);
+    }
     delete[] m_iopt;
 }
 
@@ -240,9 +289,23 @@ void CVodeInt::initialize(double t0, FuncEval& func)
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, NONE, MODIFIED_GS, 0, 0.0,
                 NULL, NULL, NULL);
+    } else if (m_type == GMRES + JAC) {
+        CVSpgmr(m_cvode_mem, LEFT, MODIFIED_GS, 0, 0.0,
+                cvode_precond, cvode_psolve, m_data);
     } else {
         throw CVodeErr("unsupported option");
     }
+
+    m_func = &func;
+    m_nroots = func.nRootFunctions();
+    if (m_ytmp) {
+        N_VFree(m_ytmp);
+        m_ytmp = 0;
+    }
+    if (m_nroots) {
+        m_ytmp = N_VNew(m_neq, 0);
+    }
+    initRoots();
 }
 
 void CVodeInt::reinitialize(double t0, FuncEval& func)
@@ -257,6 +320,17 @@ void CVodeInt::reinitialize(double t0, FuncEval& func)
 
     // pass a pointer to func in m_data
     m_data = (void*)&func;
+
+    // CVReInit discards the linear solver without freeing it, and a new one
+    // is attached below.
+    CVodeMem cv_mem = (CVodeMem) m_cvode_mem;
+    if (cv_mem->cv_linitOK) {
+        cv_mem->cv_lfree(cv_mem);
+    } else {
+        free(cv_mem->cv_lmem);
+    }
+    cv_mem->cv_lmem = 0;
+
     int result;
     if (m_itol) {
         result = CVReInit(m_cvode_mem, cvode_rhs, m_t0, m_y, m_method,
@@ -283,18 +357,60 @@ void CVodeInt::reinitialize(double t0, FuncEval& func)
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, NONE, MODIFIED_GS, 0, 0.0,
                 NULL, NULL, NULL);
+    } else if (m_type == GMRES + JAC) {
+        CVSpgmr(m_cvode_mem, LEFT, MODIFIED_GS, 0, 0.0,
+                cvode_precond, cvode_psolve, m_data);
     } else {
         throw CVodeErr("unsupported option");
     }
+    initRoots();
+}
+
+void CVodeInt::initRoots()
+{
+    m_time = m_t0;
+    m_rootFound = false;
+    if (m_nroots) {
+        m_tg = m_t0;
+        m_g.resize(m_nroots);
+        m_ga.resize(m_nroots);
+        m_gtmp.resize(m_nroots);
+        m_gm.resize(m_nroots);
+        m_rootInfo.assign(m_nroots, 0);
+        m_func->evalRootFunctions(m_t0, N_VDATA(m_y), DATA_PTR(m_g));
+    }
 }
 
 void CVodeInt::integrate(double tout)
 {
     double t;
     int flag;
-    flag = CVode(m_cvode_mem, tout, m_y, &t, NORMAL);
-    if (flag != SUCCESS) {
-        throw CVodeErr(" CVode error encountered. Error code: " + int2str(flag));
+    if (m_nroots == 0) {
+        flag = CVode(m_cvode_mem, tout, m_y, &t, NORMAL);
+        if (flag != SUCCESS) {
+            throw CVodeErr(" CVode error encountered. Error code: " + int2str(flag));
+        }
+        m_time = t;
+        return;
+    }
+
+    // Take single steps, checking for roots within each step, until tout
+    // is passed. Then interpolate the solution at tout.
+    m_rootFound = false;
+    while (true) {
+        double tend = std::min(m_ropt[TCUR], tout);
+        if (tend > m_tg && checkRoots(tend)) {
+            return;
+        }
+        if (m_ropt[TCUR] >= tout) {
+            CVodeDky(m_cvode_mem, tout, 0, m_y);
+            m_time = tout;
+            return;
+        }
+        flag = CVode(m_cvode_mem, tout, m_y, &t, ONE_STEP);
+        if (flag != SUCCESS) {
+            throw CVodeErr(" CVode error encountered. Error code: " + int2str(flag));
+        }
     }
 }
 
@@ -302,11 +418,137 @@ double CVodeInt::step(double tout)
 {
     double t;
     int flag;
+    double tcur = m_ropt[TCUR];
+    if (m_nroots) {
+        m_rootFound = false;
+        // If the last call stopped at a root, finish checking the remainder
+        // of the last internal step before taking a new one.
+        if (tcur > m_tg) {
+            if (!checkRoots(tcur)) {
+                CVodeDky(m_cvode_mem, tcur, 0, m_y);
+                m_time = tcur;
+            }
+            return m_time;
+        }
+    } else if (tcur > m_time) {
+        // integrate() interpolated the solution to a time within the last
+        // internal step. As CVODES does, return the end of that step first,
+        // so that the interval in between can be interpolated by getDky().
+        CVodeDky(m_cvode_mem, tcur, 0, m_y);
+        m_time = tcur;
+        return m_time;
+    }
     flag = CVode(m_cvode_mem, tout, m_y, &t, ONE_STEP);
     if (flag != SUCCESS) {
         throw CVodeErr(" CVode error encountered. Error code: " + int2str(flag));
     }
-    return t;
+    m_time = t;
+    if (m_nroots) {
+        checkRoots(t);
+    }
+    return m_time;
+}
+
+bool CVodeInt::checkRoots(double tend)
+{
+    double ta = m_tg;
+    double tb = tend;
+    vector_fp& ga = m_ga;
+    vector_fp& gb = m_gtmp;
+    vector_fp& gm = m_gm;
+    ga = m_g;
+    CVodeDky(m_cvode_mem, tb, 0, m_ytmp);
+    m_func->evalRootFunctions(tb, N_VDATA(m_ytmp), DATA_PTR(gb));
+
+    bool found = false;
+    for (size_t i = 0; i < m_nroots; i++) {
+        if (ga[i] != 0.0 && ga[i]*gb[i] <= 0.0) {
+            found = true;
+        }
+    }
+    if (!found) {
+        m_tg = tb;
+        m_g = gb;
+        return false;
+    }
+
+    // Locate the earliest root in [ta, tb] using the Illinois algorithm,
+    // keeping the root bracketed by [ta, tb].
+    double ttol = 100 * DBL_EPSILON * (fabs(tb) + fabs(tb - ta));
+    double alpha = 1.0;
+    int side = 0, sideprev = 0;
+    for (int iter = 0; tb - ta > ttol; iter++) {
+        // secant estimate for the root function which crosses zero first
+        double tm = tb;
+        for (size_t i = 0; i < m_nroots; i++) {
+            if (ga[i] != 0.0 && ga[i]*gb[i] <= 0.0) {
+                double ti = tb - (tb - ta) * gb[i] / (gb[i] - alpha * ga[i]);
+                tm = std::min(tm, ti);
+            }
+        }
+        if (iter % 4 == 3) {
+            tm = 0.5 * (ta + tb); // guarantee progress
+        }
+        tm = std::max(ta + 0.5 * ttol, std::min(tb - 0.5 * ttol, tm));
+
+        CVodeDky(m_cvode_mem, tm, 0, m_ytmp);
+        m_func->evalRootFunctions(tm, N_VDATA(m_ytmp), DATA_PTR(gm));
+        found = false;
+        for (size_t i = 0; i < m_nroots; i++) {
+            if (ga[i] != 0.0 && ga[i]*gm[i] <= 0.0) {
+                found = true;
+            }
+        }
+        sideprev = side;
+        if (found) {
+            tb = tm;
+            gb = gm;
+            side = 1;
+        } else {
+            ta = tm;
+            ga = gm;
+            side = 2;
+        }
+        if (side == sideprev) {
+            alpha = (side == 2) ? 2 * alpha : 0.5 * alpha;
+        } else {
+            alpha = 1.0;
+        }
+    }
+
+    for (size_t i = 0; i < m_nroots; i++) {
+        if (ga[i] != 0.0 && ga[i]*gb[i] <= 0.0) {
+            m_rootInfo[i] = (gb[i] > ga[i]) ? 1 : -1;
+        } else {
+            m_rootInfo[i] = 0;
+        }
+    }
+    CVodeDky(m_cvode_mem, tb, 0, m_y);
+    m_time = tb;
+    m_tg = tb;
+    m_g = gb;
+    m_rootFound = true;
+    return true;
+}
+
+bool CVodeInt::getRootInfo(int* info)
+{
+    for (size_t i = 0; i < m_nroots; i++) {
+        info[i] = m_rootFound ? m_rootInfo[i] : 0;
+    }
+    return m_rootFound;
+}
+
+void CVodeInt::getDky(double t, int k, double* dky)
+{
+    N_Vector v;
+    N_VMAKE(v, dky, m_neq);
+    int flag = CVodeDky(m_cvode_mem, t, k, v);
+    N_VDISPOSE(v);
+    if (flag != OKAY) {
+        throw CVodeErr("CVodeDky failed at t = " + fp2str(t) +
+                       ". Error code: " + int2str(flag));
+    }
 }
 
 int CVodeInt::nEvals() const
@@ -62,8 +62,21 @@ public:
     virtual void setMinStepSize(double hmin);
     virtual void setMaxSteps(int nmax);
     virtual void setMaxErrTestFails(int nmax) {}
+    virtual doublereal time() const {
+        return m_time;
+    }
+    virtual bool getRootInfo(int* info);
+    virtual void getDky(double t, int k, double* dky);
 
 private:
+    //! Check for sign changes of the root functions between m_tg and `tend`,
+    //! which must be within the last internal step. If a root is found, set
+    //! the solution to the state at the root and return true.
+    bool checkRoots(double tend);
+
+    //! Evaluate the root functions at the initial time
+    void initRoots();
+
     int m_neq;
     void* m_cvode_mem;
     double m_t0;
@@ -82,6 +95,22 @@ private:
     vector_fp m_ropt;
     long int* m_iopt;
     void* m_data;
+
+    double m_time; //!< The time corresponding to m_y
+
+    //! @name Root finding
+    //! The bundled CVODE does not support root finding, so roots are located
+    //! here by interpolating the solution within each internal step.
+    //! @{
+    FuncEval* m_func;
+    size_t m_nroots; //!< Number of root functions
+    N_Vector m_ytmp; //!< Interpolated solution
+    double m_tg; //!< Time up to which roots have been checked
+    vector_fp m_g; //!< Values of the root functions at m_tg
+    vector_fp m_ga, m_gtmp, m_gm; //!< Work arrays for checkRoots()
+    vector_int m_rootInfo;
+    bool m_rootFound;
+    //! @}
 };
 
 }    // namespace
@@ -78,6 +78,60 @@ extern "C" {
         return 0; // successful evaluation
     }
 
+    //! Function called by CVodes to evaluate the root functions
+    static int cvodes_root(realtype t, N_Vector y, realtype* gout,
+                           void* f_data)
+    {
+        try {
+            Cantera::FuncEval* f = ((Cantera::FuncData*) f_data)->m_func;
+            f->evalRootFunctions(t, NV_DATA_S(y), gout);
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return -1; // unrecoverable error
+        } catch (...) {
+            std::cerr << "cvodes_root: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to compute and factor the preconditioner
+    //! for the GMRES linear solver.
+    static int cvodes_prec_setup(realtype t, N_Vector y, N_Vector fy,
+                                 booleantype jok, booleantype* jcurPtr,
+                                 realtype gamma, void* f_data,
+                                 N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+    {
+        try {
+            Cantera::FuncEval* f = ((Cantera::FuncData*) f_data)->m_func;
+            *jcurPtr = f->preconditionerSetup(t, NV_DATA_S(y), NV_DATA_S(fy),
+                                              jok, gamma);
+        } catch (Cantera::CanteraError& err) {
+            std::cerr << err.what() << std::endl;
+            return 1; // possibly recoverable error
+        } catch (...) {
+            std::cerr << "cvodes_prec_setup: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
+    //! Function called by CVodes to apply the preconditioner.
+    static int cvodes_prec_solve(realtype t, N_Vector y, N_Vector fy,
+                                 N_Vector r, N_Vector z, realtype gamma,
+                                 realtype delta, int lr, void* f_data,
+                                 N_Vector tmp)
+    {
+        try {
+            Cantera::FuncEval* f = ((Cantera::FuncData*) f_data)->m_func;
+            f->preconditionerSolve(NV_DATA_S(r), NV_DATA_S(z));
+        } catch (...) {
+            std::cerr << "cvodes_prec_solve: unhandled exception" << std::endl;
+            return -1; // unrecoverable error
+        }
+        return 0;
+    }
+
     //! Function called by CVodes when an error is encountered instead of
     //! writing to stdout. Here, save the error message provided by CVodes so
     //! that it can be included in the subsequently raised CanteraError.
@@ -113,7 +167,9 @@ CVodesIntegrator::CVodesIntegrator() :
     m_fdata(0),
     m_np(0),
     m_mupper(0), m_mlower(0),
-    m_sens_ok(false)
+    m_sens_ok(false),
+    m_nroots(0),
+    m_rootFound(false)
 {
 }
 
@@ -331,6 +387,15 @@ void CVodesIntegrator::initialize(double t0, FuncEval& func)
     if (flag != CV_SUCCESS) {
         throw CVodesErr("CVodeSetUserData failed.");
     }
+    m_nroots = func.nRootFunctions();
+    if (m_nroots) {
+        flag = CVodeRootInit(m_cvode_mem, static_cast<int>(m_nroots),
+                             cvodes_root);
+        if (flag != CV_SUCCESS) {
+            throw CVodesErr("CVodeRootInit failed.");
+        }
+    }
+    m_rootFound = false;
     if (func.nparams() > 0) {
         sensInit(t0, func);
         flag = CVodeSetSensParams(m_cvode_mem, DATA_PTR(m_fdata->m_pars),
@@ -352,6 +417,7 @@ void CVodesIntegrator::reinitialize(double t0, FuncEval& func)
     if (result != CV_SUCCESS) {
         throw CVodesErr("CVodeReInit failed. result = "+int2str(result));
     }
+    m_rootFound = false;
     applyOptions();
 }
 
@@ -368,6 +434,10 @@ void CVodesIntegrator::applyOptions()
         CVDiag(m_cvode_mem);
     } else if (m_type == GMRES) {
         CVSpgmr(m_cvode_mem, PREC_NONE, 0);
+    } else if (m_type == GMRES + JAC) {
+        CVSpgmr(m_cvode_mem, PREC_LEFT, 0);
+        CVSpilsSetPreconditioner(m_cvode_mem, cvodes_prec_setup,
+                                 cvodes_prec_solve);
     } else if (m_type == BAND + NOJAC) {
         long int N = m_neq;
         long int nu = m_mupper;
@@ -401,7 +471,8 @@ void CVodesIntegrator::applyOptions()
 void CVodesIntegrator::integrate(double tout)
 {
     int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_NORMAL);
-    if (flag != CV_SUCCESS) {
+    m_rootFound = (flag == CV_ROOT_RETURN);
+    if (flag != CV_SUCCESS && flag != CV_ROOT_RETURN) {
         throw CVodesErr("CVodes error encountered. Error code: " + int2str(flag) + "\n" + m_error_message +
                         "\nComponents with largest weighted error estimates:\n" + getErrorInfo(10));
     }
@@ -411,7 +482,8 @@ void CVodesIntegrator::integrate(double tout)
 double CVodesIntegrator::step(double tout)
 {
     int flag = CVode(m_cvode_mem, tout, m_y, &m_time, CV_ONE_STEP);
-    if (flag != CV_SUCCESS) {
+    m_rootFound = (flag == CV_ROOT_RETURN);
+    if (flag != CV_SUCCESS && flag != CV_ROOT_RETURN) {
         throw CVodesErr("CVodes error encountered. Error code: " + int2str(flag) + "\n" + m_error_message +
                         "\nComponents with largest weighted error estimates:\n" + getErrorInfo(10));
 
@@ -420,6 +492,27 @@ double CVodesIntegrator::step(double tout)
     return m_time;
 }
 
+void CVodesIntegrator::getDky(double t, int k, double* dky)
+{
+    N_Vector v = N_VMake_Serial(m_neq, dky);
+    int flag = CVodeGetDky(m_cvode_mem, t, k, v);
+    N_VDestroy_Serial(v);
+    if (flag != CV_SUCCESS) {
+        throw CVodesErr("CVodeGetDky failed at t = " + fp2str(t) +
+                        ". Error code: " + int2str(flag));
+    }
+}
+
+bool CVodesIntegrator::getRootInfo(int* info)
+{
+    if (m_rootFound) {
+        CVodeGetRootInfo(m_cvode_mem, info);
+    } else {
+        std::fill(info, info + m_nroots, 0);
+    }
+    return m_rootFound;
+}
+
 int CVodesIntegrator::nEvals() const
 {
     long int ne;
@@ -147,6 +147,59 @@ void Domain1D::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     }
 }
 
+void Domain1D::getCheckpointData(std::map<std::string, vector_fp>& data) const
+{
+    data["abstol_transient"] = m_atol_ts;
+    data["reltol_transient"] = m_rtol_ts;
+    data["abstol_steady"] = m_atol_ss;
+    data["reltol_steady"] = m_rtol_ss;
+
+    vector_fp& ref = data["refine_criteria"];
+    ref.resize(7);
+    ref[0] = m_refiner->maxRatio();
+    ref[1] = m_refiner->maxDelta();
+    ref[2] = m_refiner->maxSlope();
+    ref[3] = m_refiner->prune();
+    ref[4] = m_refiner->gridMin();
+    ref[5] = m_refiner->coarsenThreshold();
+    ref[6] = static_cast<double>(m_refiner->maxPoints());
+}
+
+void Domain1D::setCheckpointData(const std::map<std::string, vector_fp>& data)
+{
+    std::map<std::string, vector_fp>::const_iterator iter;
+    iter = data.find("abstol_transient");
+    if (iter != data.end() && iter->second.size() == nComponents()) {
+        m_atol_ts = iter->second;
+    }
+    iter = data.find("reltol_transient");
+    if (iter != data.end() && iter->second.size() == nComponents()) {
+        m_rtol_ts = iter->second;
+    }
+    iter = data.find("abstol_steady");
+    if (iter != data.end() && iter->second.size() == nComponents()) {
+        m_atol_ss = iter->second;
+    }
+    iter = data.find("reltol_steady");
+    if (iter != data.end() && iter->second.size() == nComponents()) {
+        m_rtol_ss = iter->second;
+    }
+
+    iter = data.find("refine_criteria");
+    if (iter != data.end()) {
+        const vector_fp& ref = iter->second;
+        if (ref.size() != 7) {
+            throw CanteraError("Domain1D::setCheckpointData",
+                               "refine_criteria has length " +
+                               int2str(ref.size()) + " but should be 7");
+        }
+        m_refiner->setCriteria(ref[0], ref[1], ref[2], ref[3]);
+        m_refiner->setGridMin(ref[4]);
+        m_refiner->setCoarsenThreshold(ref[5]);
+        m_refiner->setMaxPoints(static_cast<int>(ref[6]));
+    }
+}
+
 void Domain1D::setupGrid(size_t n, const doublereal* z)
 {
     if (n > 1) {
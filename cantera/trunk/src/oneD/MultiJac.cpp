@@ -90,8 +90,12 @@ void MultiJac::eval(doublereal* x0, doublereal* resid0, doublereal rdt)
         m_ssdiag[n] = value(n,n);
     }
 
-    m_elapsed += double(clock() - t0)/CLOCKS_PER_SEC;
+    doublereal elapsed = double(clock() - t0)/CLOCKS_PER_SEC;
+    m_elapsed += elapsed;
     m_age = 0;
+    OneDimProfile& profile = m_resid->profile();
+    profile.nJacEvals++;
+    profile.jacTime += elapsed;
 }
 
 } // namespace
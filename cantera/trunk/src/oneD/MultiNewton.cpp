@@ -199,7 +199,22 @@ void MultiNewton::step(doublereal* x, doublereal* step,
     }
 #endif
 
-    iok = jac.solve(step, step);
+    // Factor the Jacobian separately from the back-substitution so that the
+    // time spent in each can be recorded
+    OneDimProfile& profile = r.profile();
+    iok = 0;
+    if (!jac.factored()) {
+        clock_t t0 = clock();
+        iok = jac.factor();
+        profile.nFactor++;
+        profile.factorTime += double(clock() - t0)/CLOCKS_PER_SEC;
+    }
+    if (iok == 0) {
+        clock_t t0 = clock();
+        iok = jac.solve(step, step);
+        profile.nLinearSolves++;
+        profile.linearSolveTime += double(clock() - t0)/CLOCKS_PER_SEC;
+    }
 
     // if iok is non-zero, then solve failed
     if (iok != 0) {
@@ -280,6 +295,7 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
     // condition.
     if (fbound < 1.e-10) {
         writelog("\nAt limits.\n", loglevel);
+        r.profile().nDampFailures++;
         return -3;
     }
 
@@ -336,13 +352,18 @@ int MultiNewton::dampStep(const doublereal* x0, const doublereal* step0,
     // solution after stepping by the damped step would represent
     // a converged solution, and return 0 otherwise. If no damping
     // coefficient could be found, return -2.
+    OneDimProfile& profile = r.profile();
     if (m < NDAMP) {
+        profile.nDampedSteps++;
+        profile.dampSum += ff;
+        profile.dampMin = std::min(profile.dampMin, ff);
         if (s1 > 1.0) {
             return 0;
         } else {
             return 1;
         }
     } else {
+        profile.nDampFailures++;
         return -2;
     }
 }
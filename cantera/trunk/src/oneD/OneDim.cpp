@@ -14,6 +14,62 @@ using namespace std;
 namespace Cantera
 {
 
+void OneDimProfile::clear()
+{
+    nResidEvals = 0;
+    residTime = 0.0;
+    thermoTime = 0.0;
+    kineticsTime = 0.0;
+    transportTime = 0.0;
+    nJacEvals = 0;
+    jacTime = 0.0;
+    nFactor = 0;
+    factorTime = 0.0;
+    nLinearSolves = 0;
+    linearSolveTime = 0.0;
+    nNewtonSolves = 0;
+    nNewtonFailures = 0;
+    newtonTime = 0.0;
+    nDampedSteps = 0;
+    nDampFailures = 0;
+    dampSum = 0.0;
+    dampMin = 1.0;
+    nTimeSteps = 0;
+    nTimeStepFailures = 0;
+    timeStepTime = 0.0;
+    nRegrid = 0;
+    regridTime = 0.0;
+}
+
+void OneDimProfile::write(std::ostream& s) const
+{
+    XML_Node root("profile");
+    addInteger(root, "nResidEvals", nResidEvals);
+    addFloat(root, "residTime", residTime, "s");
+    addFloat(root, "thermoTime", thermoTime, "s");
+    addFloat(root, "kineticsTime", kineticsTime, "s");
+    addFloat(root, "transportTime", transportTime, "s");
+    addInteger(root, "nJacEvals", nJacEvals);
+    addFloat(root, "jacTime", jacTime, "s");
+    addInteger(root, "nFactor", nFactor);
+    addFloat(root, "factorTime", factorTime, "s");
+    addInteger(root, "nLinearSolves", nLinearSolves);
+    addFloat(root, "linearSolveTime", linearSolveTime, "s");
+    addInteger(root, "nNewtonSolves", nNewtonSolves);
+    addInteger(root, "nNewtonFailures", nNewtonFailures);
+    addFloat(root, "newtonTime", newtonTime, "s");
+    addInteger(root, "nDampedSteps", nDampedSteps);
+    addInteger(root, "nDampFailures", nDampFailures);
+    addFloat(root, "meanDamping", meanDamping());
+    addFloat(root, "minDamping", dampMin);
+    addInteger(root, "nTimeSteps", nTimeSteps);
+    addInteger(root, "nTimeStepFailures", nTimeStepFailures);
+    addFloat(root, "timeStepTime", timeStepTime, "s");
+    addInteger(root, "nRegrid", nRegrid);
+    addFloat(root, "regridTime", regridTime, "s");
+    root.write(s);
+}
+
 OneDim::OneDim()
     : m_tmin(1.0e-16), m_tmax(10.0), m_tfactor(0.5),
       m_jac(0), m_newt(0),
@@ -111,6 +167,26 @@ void OneDim::writeStats(int printTime)
         }
         writelog(buf);
     }
+
+    if (printTime) {
+        const OneDimProfile& p = m_profile;
+        sprintf(buf, "\n Residual: %9.4f  (thermo %9.4f, kinetics %9.4f, "
+                "transport %9.4f)\n", p.residTime, p.thermoTime,
+                p.kineticsTime, p.transportTime);
+        writelog(buf);
+        sprintf(buf, " Jacobian: %9.4f  factor: %9.4f (%5i)  solve: %9.4f (%5i)\n",
+                p.jacTime, p.factorTime, p.nFactor, p.linearSolveTime,
+                p.nLinearSolves);
+        writelog(buf);
+        sprintf(buf, " Newton:   %9.4f  (%i solves, %i failed, mean damping %6.4f)\n",
+                p.newtonTime, p.nNewtonSolves, p.nNewtonFailures,
+                p.meanDamping());
+        writelog(buf);
+        sprintf(buf, " Timestep: %9.4f  (%i steps, %i failed)  regrid: %9.4f (%i)\n",
+                p.timeStepTime, p.nTimeSteps, p.nTimeStepFailures,
+                p.regridTime, p.nRegrid);
+        writelog(buf);
+    }
 }
 
 void OneDim::saveStats()
@@ -138,6 +214,7 @@ void OneDim::clearStats()
     m_funcElapsed.clear();
     m_nevals = 0;
     m_evaltime = 0.0;
+    m_profile.clear();
 }
 
 void OneDim::resize()
@@ -199,13 +276,20 @@ void OneDim::resize()
 
 int OneDim::solve(doublereal* x, doublereal* xnew, int loglevel)
 {
+    clock_t t0 = clock();
     if (!m_jac_ok) {
         eval(npos, x, xnew, 0.0, 0);
         m_jac->eval(x, xnew, 0.0);
         m_jac->updateTransient(m_rdt, DATA_PTR(m_mask));
         m_jac_ok = true;
     }
-    return m_newt->solve(x, xnew, *this, *m_jac, loglevel);
+    int m = m_newt->solve(x, xnew, *this, *m_jac, loglevel);
+    m_profile.nNewtonSolves++;
+    if (m < 0) {
+        m_profile.nNewtonFailures++;
+    }
+    m_profile.newtonTime += double(clock() - t0)/CLOCKS_PER_SEC;
+    return m;
 }
 
 void OneDim::evalSSJacobian(doublereal* x, doublereal* xnew)
@@ -258,6 +342,8 @@ void OneDim::eval(size_t j, double* x, double* r, doublereal rdt, int count)
         clock_t t1 = clock();
         m_evaltime += double(t1 - t0)/CLOCKS_PER_SEC;
         m_nevals++;
+        m_profile.residTime += double(t1 - t0)/CLOCKS_PER_SEC;
+        m_profile.nResidEvals++;
     }
 }
 
@@ -319,6 +405,8 @@ void OneDim::init()
 doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
                             doublereal* r, int loglevel)
 {
+    clock_t t0 = clock();
+
     // set the Jacobian age parameter to the transient value
     newton().setOptions(m_ts_jac_age);
 
@@ -344,6 +432,7 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
         // the current solution in x.
         if (m >= 0) {
             n += 1;
+            m_profile.nTimeSteps++;
             writelog("\n", loglevel);
             copy(r, r + m_size, x);
             if (m == 100) {
@@ -356,16 +445,20 @@ doublereal OneDim::timeStep(int nsteps, doublereal dt, doublereal* x,
         // Decrease the stepsize and try again.
         else {
             writelog("...failure.\n", loglevel);
+            m_profile.nTimeStepFailures++;
             dt *= m_tfactor;
-            if (dt < m_tmin)
+            if (dt < m_tmin) {
+                m_profile.timeStepTime += double(clock() - t0)/CLOCKS_PER_SEC;
                 throw CanteraError("OneDim::timeStep",
                                    "Time integration failed.");
+            }
         }
     }
 
     // Prepare to solve the steady problem.
     setSteadyMode();
     newton().setOptions(m_ss_jac_age);
+    m_profile.timeStepTime += double(clock() - t0)/CLOCKS_PER_SEC;
 
     // return the value of the last stepsize, which may be smaller
     // than the initial stepsize
@@ -9,12 +9,201 @@
 #include "cantera/base/xml.h"
 
 #include <fstream>
+#include <ctime>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace {
+
+// Binary checkpoint format used by Sim1D::saveCheckpoint. All counts are
+// stored as unsigned ints and all values as doubles, in native byte order.
+//
+//   header:   magic (8 bytes), byte order mark, format version
+//   domains:  number of domains, followed for each domain by
+//             id, domain type, number of points, number of components,
+//             component names, grid, solution, named arrays
+//   settings: named arrays holding the Sim1D time stepping parameters
+//
+// Strings are stored as a length followed by the characters, and a set of
+// named arrays as a count followed by (name, length, values) records.
+const char checkpointMagic[8] = {'C','T','C','H','K','P','T','1'};
+const unsigned int checkpointByteOrder = 0x01020304;
+const unsigned int checkpointVersion = 1;
+
+typedef std::map<std::string, vector_fp> CheckpointData;
+
+class CheckpointWriter
+{
+public:
+    explicit CheckpointWriter(const std::string& fname) :
+        m_fname(fname),
+        m_s(fname.c_str(), std::ios::out | std::ios::binary | std::ios::trunc) {
+        if (!m_s) {
+            throw CanteraError("Sim1D::saveCheckpoint",
+                               "could not open output file " + fname);
+        }
+    }
+
+    void writeBytes(const void* p, size_t n) {
+        m_s.write(static_cast<const char*>(p), n);
+    }
+    void writeCount(size_t n) {
+        unsigned int m = static_cast<unsigned int>(n);
+        writeBytes(&m, sizeof(m));
+    }
+    void writeString(const std::string& str) {
+        writeCount(str.size());
+        writeBytes(str.data(), str.size());
+    }
+    void writeDoubles(const doublereal* x, size_t n) {
+        writeBytes(x, n*sizeof(doublereal));
+    }
+    void writeData(const CheckpointData& data) {
+        writeCount(data.size());
+        for (CheckpointData::const_iterator iter = data.begin();
+             iter != data.end(); ++iter) {
+            writeString(iter->first);
+            writeCount(iter->second.size());
+            writeDoubles(DATA_PTR(iter->second), iter->second.size());
+        }
+    }
+    void close() {
+        m_s.close();
+        if (m_s.fail()) {
+            throw CanteraError("Sim1D::saveCheckpoint",
+                               "error writing file " + m_fname);
+        }
+    }
+
+private:
+    std::string m_fname;
+    std::ofstream m_s;
+};
+
+//! Read-only view of a checkpoint file. The file is memory mapped where
+//! possible; otherwise, it is read into an internal buffer. All reads are
+//! bounds-checked, and values are copied with memcpy since they are not
+//! necessarily aligned within the file.
+class CheckpointReader
+{
+public:
+    explicit CheckpointReader(const std::string& fname) :
+        m_fname(fname), m_data(0), m_size(0), m_pos(0), m_mapped(false) {
+#ifndef _WIN32
+        int fd = open(fname.c_str(), O_RDONLY);
+        if (fd < 0) {
+            throw CanteraError("Sim1D::restoreCheckpoint",
+                               "could not open input file " + fname);
+        }
+        struct stat st;
+        if (fstat(fd, &st) == 0 && st.st_size > 0) {
+            void* p = mmap(0, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p != MAP_FAILED) {
+                m_data = static_cast<const char*>(p);
+                m_size = st.st_size;
+                m_mapped = true;
+            }
+        }
+        ::close(fd);
+        if (m_mapped) {
+            return;
+        }
+#endif
+        std::ifstream s(fname.c_str(), std::ios::in | std::ios::binary);
+        if (!s) {
+            throw CanteraError("Sim1D::restoreCheckpoint",
+                               "could not open input file " + fname);
+        }
+        m_buf.assign(std::istreambuf_iterator<char>(s),
+                     std::istreambuf_iterator<char>());
+        m_data = DATA_PTR(m_buf);
+        m_size = m_buf.size();
+    }
+
+    ~CheckpointReader() {
+#ifndef _WIN32
+        if (m_mapped) {
+            munmap(const_cast<char*>(m_data), m_size);
+        }
+#endif
+    }
+
+    void readBytes(void* p, size_t n) {
+        if (n > m_size - m_pos) {
+            throw CanteraError("Sim1D::restoreCheckpoint",
+                               "unexpected end of file in " + m_fname);
+        }
+        if (n) {
+            memcpy(p, m_data + m_pos, n);
+        }
+        m_pos += n;
+    }
+    size_t readCount() {
+        unsigned int m;
+        readBytes(&m, sizeof(m));
+        return m;
+    }
+    std::string readString() {
+        size_t n = readCount();
+        if (n > m_size - m_pos) {
+            throw CanteraError("Sim1D::restoreCheckpoint",
+                               "unexpected end of file in " + m_fname);
+        }
+        std::string str(m_data + m_pos, n);
+        m_pos += n;
+        return str;
+    }
+    void readDoubles(vector_fp& x, size_t n) {
+        if (n > (m_size - m_pos) / sizeof(doublereal)) {
+            throw CanteraError("Sim1D::restoreCheckpoint",
+                               "unexpected end of file in " + m_fname);
+        }
+        x.resize(n);
+        readBytes(DATA_PTR(x), n*sizeof(doublereal));
+    }
+    void readData(CheckpointData& data) {
+        size_t n = readCount();
+        for (size_t i = 0; i < n; i++) {
+            std::string name = readString();
+            readDoubles(data[name], readCount());
+        }
+    }
+
+private:
+    std::string m_fname;
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+    bool m_mapped;
+    std::vector<char> m_buf;
+
+    // not copyable
+    CheckpointReader(const CheckpointReader&);
+    CheckpointReader& operator=(const CheckpointReader&);
+};
+
+//! Contents of a single domain read from a checkpoint file
+struct CheckpointDomain {
+    std::string id;
+    size_t points;
+    vector_fp grid;
+    vector_fp soln;
+    CheckpointData data;
+};
+
+}
+
 Sim1D::Sim1D(vector<Domain1D*>& domains) :
     OneDim(domains)
 {
@@ -146,6 +335,157 @@ void Sim1D::restore(const std::string& fname, const std::string& id,
     finalize();
 }
 
+void Sim1D::saveCheckpoint(const std::string& fname)
+{
+    CheckpointWriter w(fname);
+    w.writeBytes(checkpointMagic, sizeof(checkpointMagic));
+    w.writeBytes(&checkpointByteOrder, sizeof(checkpointByteOrder));
+    w.writeBytes(&checkpointVersion, sizeof(checkpointVersion));
+
+    w.writeCount(m_nd);
+    for (size_t n = 0; n < m_nd; n++) {
+        Domain1D& d = domain(n);
+        size_t nc = d.nComponents();
+        size_t np = d.nPoints();
+        w.writeString(d.id());
+        w.writeCount(d.domainType());
+        w.writeCount(np);
+        w.writeCount(nc);
+        for (size_t i = 0; i < nc; i++) {
+            w.writeString(d.componentName(i));
+        }
+        for (size_t j = 0; j < np; j++) {
+            doublereal z = d.grid(j);
+            w.writeDoubles(&z, 1);
+        }
+        w.writeDoubles(DATA_PTR(m_x) + start(n), nc*np);
+        CheckpointData data;
+        d.getCheckpointData(data);
+        w.writeData(data);
+    }
+
+    CheckpointData settings;
+    settings["timestep"] = vector_fp(1, m_tstep);
+    settings["steps"].assign(m_steps.begin(), m_steps.end());
+    vector_fp& limits = settings["timestep_limits"];
+    limits.push_back(m_tmin);
+    limits.push_back(m_tmax);
+    limits.push_back(m_tfactor);
+    vector_fp& age = settings["jacobian_age"];
+    age.push_back(m_ss_jac_age);
+    age.push_back(m_ts_jac_age);
+    w.writeData(settings);
+    w.close();
+}
+
+void Sim1D::restoreCheckpoint(const std::string& fname, int loglevel)
+{
+    CheckpointReader r(fname);
+    char magic[sizeof(checkpointMagic)];
+    unsigned int bom, version;
+    r.readBytes(magic, sizeof(magic));
+    if (memcmp(magic, checkpointMagic, sizeof(magic)) != 0) {
+        throw CanteraError("Sim1D::restoreCheckpoint",
+                           fname + " is not a Sim1D checkpoint file");
+    }
+    r.readBytes(&bom, sizeof(bom));
+    r.readBytes(&version, sizeof(version));
+    if (bom != checkpointByteOrder) {
+        throw CanteraError("Sim1D::restoreCheckpoint", "checkpoint file " +
+                           fname + " was written on a machine with a "
+                           "different byte order");
+    }
+    if (version != checkpointVersion) {
+        throw CanteraError("Sim1D::restoreCheckpoint", "unsupported "
+                           "checkpoint version " + int2str(int(version)));
+    }
+
+    size_t nd = r.readCount();
+    if (nd != m_nd) {
+        throw CanteraError("Sim1D::restoreCheckpoint", "Checkpoint does not "
+                           "contain the correct number of domains. Found " +
+                           int2str(nd) + ", expected " + int2str(m_nd) + ".");
+    }
+
+    // Read the data for all domains and check their structure before
+    // modifying any of the domains
+    std::vector<CheckpointDomain> doms(m_nd);
+    size_t sz = 0;
+    for (size_t n = 0; n < m_nd; n++) {
+        Domain1D& d = domain(n);
+        CheckpointDomain& cd = doms[n];
+        cd.id = r.readString();
+        if (loglevel > 0 && cd.id != d.id()) {
+            writelog("Warning: domain names do not match: '" + cd.id +
+                     "' and '" + d.id() + "'\n");
+        }
+        int type = static_cast<int>(r.readCount());
+        if (type != d.domainType()) {
+            throw CanteraError("Sim1D::restoreCheckpoint", "Domain " +
+                               int2str(n) + " has type " + int2str(type) +
+                               " in the checkpoint, but " +
+                               int2str(d.domainType()) + " in the simulation.");
+        }
+        cd.points = r.readCount();
+        size_t nc = r.readCount();
+        if (nc != d.nComponents()) {
+            throw CanteraError("Sim1D::restoreCheckpoint", "Domain '" +
+                               d.id() + "' has " + int2str(nc) +
+                               " components in the checkpoint, but " +
+                               int2str(d.nComponents()) + " in the simulation.");
+        }
+        for (size_t i = 0; i < nc; i++) {
+            std::string name = r.readString();
+            if (name != d.componentName(i)) {
+                throw CanteraError("Sim1D::restoreCheckpoint", "Component " +
+                                   int2str(i) + " of domain '" + d.id() +
+                                   "' is '" + name + "' in the checkpoint, "
+                                   "but '" + d.componentName(i) +
+                                   "' in the simulation.");
+            }
+        }
+        r.readDoubles(cd.grid, cd.points);
+        r.readDoubles(cd.soln, nc*cd.points);
+        r.readData(cd.data);
+        sz += nc*cd.points;
+    }
+    CheckpointData settings;
+    r.readData(settings);
+
+    for (size_t n = 0; n < m_nd; n++) {
+        domain(n).setupGrid(doms[n].points, DATA_PTR(doms[n].grid));
+    }
+    m_x.resize(sz);
+    m_xnew.resize(sz);
+    resize();
+    for (size_t n = 0; n < m_nd; n++) {
+        copy(doms[n].soln.begin(), doms[n].soln.end(), m_x.begin() + start(n));
+        domain(n).setCheckpointData(doms[n].data);
+    }
+
+    CheckpointData::const_iterator iter;
+    iter = settings.find("timestep");
+    if (iter != settings.end() && iter->second.size() == 1) {
+        m_tstep = iter->second[0];
+    }
+    iter = settings.find("steps");
+    if (iter != settings.end() && !iter->second.empty()) {
+        m_steps.assign(iter->second.begin(), iter->second.end());
+    }
+    iter = settings.find("timestep_limits");
+    if (iter != settings.end() && iter->second.size() == 3) {
+        m_tmin = iter->second[0];
+        m_tmax = iter->second[1];
+        m_tfactor = iter->second[2];
+    }
+    iter = settings.find("jacobian_age");
+    if (iter != settings.end() && iter->second.size() == 2) {
+        setJacAge(static_cast<int>(iter->second[0]),
+                  static_cast<int>(iter->second[1]));
+    }
+    finalize();
+}
+
 void Sim1D::setFlatProfile(size_t dom, size_t comp, doublereal v)
 {
     size_t np = domain(dom).nPoints();
@@ -324,6 +664,7 @@ void Sim1D::solve(int loglevel, bool refine_grid)
 
 int Sim1D::refine(int loglevel)
 {
+    clock_t t0 = clock();
     int ianalyze, np = 0;
     vector_fp znew, xnew;
     doublereal xmid, zmid;
@@ -337,6 +678,7 @@ int Sim1D::refine(int loglevel)
         ianalyze = r.analyze(d.grid().size(),
                              DATA_PTR(d.grid()), DATA_PTR(m_x) + start(n));
         if (ianalyze < 0) {
+            m_profile.regridTime += double(clock() - t0)/CLOCKS_PER_SEC;
             return ianalyze;
         }
 
@@ -344,7 +686,6 @@ int Sim1D::refine(int loglevel)
             r.show();
         }
 
-        np += r.nNewPoints();
         size_t comp = d.nComponents();
 
         // loop over points in the current grid
@@ -381,6 +722,7 @@ int Sim1D::refine(int loglevel)
                 }
             } else {
                 writelog("refine: discarding point at "+fp2str(d.grid(m))+"\n", loglevel);
+                np++;
             }
         }
         dsize.push_back(znew.size() - nstart);
@@ -408,6 +750,8 @@ int Sim1D::refine(int loglevel)
 
     resize();
     finalize();
+    m_profile.nRegrid++;
+    m_profile.regridTime += double(clock() - t0)/CLOCKS_PER_SEC;
     return np;
 }
 
@@ -538,6 +882,19 @@ void Sim1D::setGridMin(int dom, double gridmin)
     }
 }
 
+void Sim1D::setCoarsenThreshold(int dom, double coarsen)
+{
+    if (dom >= 0) {
+        Refiner& r = domain(dom).refiner();
+        r.setCoarsenThreshold(coarsen);
+    } else {
+        for (size_t n = 0; n < m_nd; n++) {
+            Refiner& r = domain(n).refiner();
+            r.setCoarsenThreshold(coarsen);
+        }
+    }
+}
+
 void Sim1D::setMaxGridPoints(int dom, int npoints)
 {
     if (dom >= 0) {
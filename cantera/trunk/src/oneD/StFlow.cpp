@@ -4,11 +4,13 @@
 // Copyright 2002  California Institute of Technology
 
 #include "cantera/oneD/StFlow.h"
+#include "cantera/oneD/OneDim.h"
 #include "cantera/base/ctml.h"
 #include "cantera/transport/TransportBase.h"
 #include "cantera/numerics/funcs.h"
 
 #include <cstdio>
+#include <ctime>
 
 using namespace ctml;
 using namespace std;
@@ -16,6 +18,10 @@ using namespace std;
 namespace Cantera
 {
 
+//! Number of intervals for which multicomponent diffusion coefficients
+//! are stored at one time
+static const size_t c_multidiff_cache = 4;
+
 StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     Domain1D(nsp+4, points),
     m_press(-1.0),
@@ -61,7 +67,6 @@ StFlow::StFlow(IdealGasPhase* ph, size_t nsp, size_t points) :
     m_do_energy.resize(m_points,false);
 
     m_diff.resize(m_nsp*m_points);
-    m_multidiff.resize(m_nsp*m_nsp*m_points);
     m_flux.resize(m_nsp,m_points);
     m_wdot.resize(m_nsp,m_points, 0.0);
     m_ybar.resize(m_nsp);
@@ -116,8 +121,11 @@ void StFlow::resize(size_t ncomponents, size_t points)
     if (m_transport_option ==  c_Mixav_Transport) {
         m_diff.resize(m_nsp*m_points);
     } else {
-        m_multidiff.resize(m_nsp*m_nsp*m_points);
+        m_multidiff.resize(c_multidiff_cache*m_nsp*m_nsp);
+        m_multidiff_interval.assign(c_multidiff_cache, npos);
         m_diff.resize(m_nsp*m_points);
+        m_tmid.resize(m_points);
+        m_ymid.resize(m_nsp, m_points);
         m_dthermal.resize(m_nsp, m_points, 0.0);
     }
     m_flux.resize(m_nsp,m_points);
@@ -156,8 +164,11 @@ void StFlow::setTransport(Transport& trans, bool withSoret)
     int model = m_trans->model();
     if (model == cMulticomponent || model == CK_Multicomponent) {
         m_transport_option = c_Multi_Transport;
-        m_multidiff.resize(m_nsp*m_nsp*m_points);
+        m_multidiff.resize(c_multidiff_cache*m_nsp*m_nsp);
+        m_multidiff_interval.assign(c_multidiff_cache, npos);
         m_diff.resize(m_nsp*m_points);
+        m_tmid.resize(m_points);
+        m_ymid.resize(m_nsp, m_points);
         m_dthermal.resize(m_nsp, m_points, 0.0);
     } else if (model == cMixtureAveraged || model == CK_MixtureAveraged) {
         m_transport_option = c_Mixav_Transport;
@@ -266,7 +277,10 @@ void StFlow::eval(size_t jg, doublereal* xg,
     //              update properties
     //-----------------------------------------------------
 
+    clock_t t0 = clock();
     updateThermo(x, j0, j1);
+    clock_t t1 = clock();
+
     // update transport properties only if a Jacobian is not being evaluated
     if (jg == npos) {
         updateTransport(x, j0, j1);
@@ -275,6 +289,19 @@ void StFlow::eval(size_t jg, doublereal* xg,
     // update the species diffusive mass fluxes whether or not a
     // Jacobian is being evaluated
     updateDiffFluxes(x, j0, j1);
+    clock_t t2 = clock();
+
+    // update the net production rates at the interior points
+    for (j = std::max<size_t>(jmin, 1); j <= std::min(jmax, m_points-2); j++) {
+        getWdot(x,j);
+    }
+
+    if (m_container) {
+        OneDimProfile& profile = m_container->profile();
+        profile.thermoTime += double(t1 - t0)/CLOCKS_PER_SEC;
+        profile.transportTime += double(t2 - t1)/CLOCKS_PER_SEC;
+        profile.kineticsTime += double(clock() - t2)/CLOCKS_PER_SEC;
+    }
 
 
     //----------------------------------------------------
@@ -412,8 +439,6 @@ void StFlow::eval(size_t jg, doublereal* xg,
             //   = M_k\omega_k
             //
             //-------------------------------------------------
-            getWdot(x,j);
-
             doublereal convec, diffus;
             for (k = 0; k < m_nsp; k++) {
                 convec = rho_u(x,j)*dYdz(x,k,j);
@@ -485,12 +510,16 @@ void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
             m_tcon[j] = m_trans->thermalConductivity();
         }
     } else if (m_transport_option == c_Multi_Transport) {
+        // The midpoint states are changing, so any cached diffusion
+        // coefficients are no longer valid
+        m_multidiff_interval.assign(c_multidiff_cache, npos);
         for (size_t j = j0; j < j1; j++) {
             setGasAtMidpoint(x,j);
             doublereal wtm = m_thermo->meanMolecularWeight();
             doublereal rho = m_thermo->density();
             m_visc[j] = (m_dovisc ? m_trans->viscosity() : 0.0);
-            m_trans->getMultiDiffCoeffs(m_nsp, &m_multidiff[mindex(0,0,j)]);
+            m_tmid[j] = m_thermo->temperature();
+            copy(m_ybar.begin(), m_ybar.end(), m_ymid.ptrColumn(j));
 
             // Use m_diff as storage for the factor outside the summation
             for (size_t k = 0; k < m_nsp; k++) {
@@ -505,6 +534,20 @@ void StFlow::updateTransport(doublereal* x, size_t j0, size_t j1)
     }
 }
 
+const doublereal* StFlow::multiDiffCoeffs(size_t j)
+{
+    size_t slot = j % c_multidiff_cache;
+    doublereal* d = &m_multidiff[slot*m_nsp*m_nsp];
+    if (m_multidiff_interval[slot] != j) {
+        m_thermo->setTemperature(m_tmid[j]);
+        m_thermo->setMassFractions_NoNorm(m_ymid.ptrColumn(j));
+        m_thermo->setPressure(m_press);
+        m_trans->getMultiDiffCoeffs(m_nsp, d);
+        m_multidiff_interval[slot] = j;
+    }
+    return d;
+}
+
 void StFlow::showSolution(const doublereal* x)
 {
     size_t nn = m_nv/5;
@@ -595,11 +638,12 @@ void StFlow::updateDiffFluxes(const doublereal* x, size_t j0, size_t j1)
     case c_Multi_Transport:
         for (j = j0; j < j1; j++) {
             dz = z(j+1) - z(j);
+            const doublereal* d = multiDiffCoeffs(j);
 
             for (k = 0; k < m_nsp; k++) {
                 doublereal sum = 0.0;
                 for (size_t m = 0; m < m_nsp; m++) {
-                    sum += m_wt[m] * m_multidiff[mindex(k,m,j)] * (X(x,m,j+1)-X(x,m,j));
+                    sum += m_wt[m] * d[k + m*m_nsp] * (X(x,m,j+1)-X(x,m,j));
                 }
                 m_flux(k,j) = sum * m_diff[k+j*m_nsp] / dz;
             }
@@ -830,6 +874,61 @@ void StFlow::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     }
 }
 
+void StFlow::getCheckpointData(std::map<std::string, vector_fp>& data) const
+{
+    Domain1D::getCheckpointData(data);
+    data["pressure"] = vector_fp(1, m_press);
+
+    vector_fp& energy = data["energy_enabled"];
+    energy.resize(m_points);
+    for (size_t j = 0; j < m_points; j++) {
+        energy[j] = m_do_energy[j];
+    }
+    vector_fp& species = data["species_enabled"];
+    species.resize(m_nsp);
+    for (size_t k = 0; k < m_nsp; k++) {
+        species[k] = m_do_species[k];
+    }
+    data["fixed_temp_z"] = m_zfix;
+    data["fixed_temp_T"] = m_tfix;
+}
+
+void StFlow::setCheckpointData(const std::map<std::string, vector_fp>& data)
+{
+    Domain1D::setCheckpointData(data);
+    std::map<std::string, vector_fp>::const_iterator iter;
+    iter = data.find("pressure");
+    if (iter != data.end() && iter->second.size() == 1) {
+        setPressure(iter->second[0]);
+    }
+    iter = data.find("energy_enabled");
+    if (iter != data.end()) {
+        if (iter->second.size() != m_points) {
+            throw CanteraError("StFlow::setCheckpointData",
+                               "energy_enabled is length " +
+                               int2str(iter->second.size()) +
+                               " but should be length " + int2str(m_points));
+        }
+        for (size_t j = 0; j < m_points; j++) {
+            m_do_energy[j] = (iter->second[j] != 0.0);
+        }
+    }
+    iter = data.find("species_enabled");
+    if (iter != data.end() && iter->second.size() == m_nsp) {
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_do_species[k] = (iter->second[k] != 0.0);
+        }
+    }
+    std::map<std::string, vector_fp>::const_iterator zfix, tfix;
+    zfix = data.find("fixed_temp_z");
+    tfix = data.find("fixed_temp_T");
+    if (zfix != data.end() && tfix != data.end() &&
+        zfix->second.size() == tfix->second.size()) {
+        m_zfix = zfix->second;
+        m_tfix = tfix->second;
+    }
+}
+
 XML_Node& StFlow::save(XML_Node& o, const doublereal* const sol)
 {
     size_t k;
@@ -1039,6 +1138,27 @@ void FreeFlame::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     getOptionalFloat(dom, "z_fixed", m_zfixed);
 }
 
+void FreeFlame::getCheckpointData(std::map<std::string, vector_fp>& data) const
+{
+    StFlow::getCheckpointData(data);
+    data["t_fixed"] = vector_fp(1, m_tfixed);
+    data["z_fixed"] = vector_fp(1, m_zfixed);
+}
+
+void FreeFlame::setCheckpointData(const std::map<std::string, vector_fp>& data)
+{
+    StFlow::setCheckpointData(data);
+    std::map<std::string, vector_fp>::const_iterator iter;
+    iter = data.find("t_fixed");
+    if (iter != data.end() && iter->second.size() == 1) {
+        m_tfixed = iter->second[0];
+    }
+    iter = data.find("z_fixed");
+    if (iter != data.end() && iter->second.size() == 1) {
+        m_zfixed = iter->second[0];
+    }
+}
+
 XML_Node& FreeFlame::save(XML_Node& o, const doublereal* const sol)
 {
     XML_Node& flow = StFlow::save(o, sol);
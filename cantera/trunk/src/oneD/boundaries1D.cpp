@@ -256,6 +256,37 @@ void Inlet1D::restore(const XML_Node& dom, doublereal* soln, int loglevel)
     resize(2,1);
 }
 
+void Inlet1D::getCheckpointData(std::map<std::string, vector_fp>& data) const
+{
+    Domain1D::getCheckpointData(data);
+    data["mdot"] = vector_fp(1, m_mdot);
+    data["temperature"] = vector_fp(1, m_temp);
+    data["spread_rate"] = vector_fp(1, m_V0);
+    data["mass_fractions"] = m_yin;
+}
+
+void Inlet1D::setCheckpointData(const std::map<std::string, vector_fp>& data)
+{
+    Domain1D::setCheckpointData(data);
+    std::map<std::string, vector_fp>::const_iterator iter;
+    iter = data.find("mdot");
+    if (iter != data.end() && iter->second.size() == 1) {
+        m_mdot = iter->second[0];
+    }
+    iter = data.find("temperature");
+    if (iter != data.end() && iter->second.size() == 1) {
+        m_temp = iter->second[0];
+    }
+    iter = data.find("spread_rate");
+    if (iter != data.end() && iter->second.size() == 1) {
+        m_V0 = iter->second[0];
+    }
+    iter = data.find("mass_fractions");
+    if (iter != data.end() && iter->second.size() == m_nsp) {
+        m_yin = iter->second;
+    }
+}
+
 //--------------------------------------------------
 //      Empty1D
 //--------------------------------------------------
@@ -8,7 +8,7 @@ namespace Cantera
 {
 Refiner::Refiner(Domain1D& domain) :
     m_ratio(10.0), m_slope(0.8), m_curve(0.8), m_prune(-0.001),
-    m_min_range(0.01), m_domain(&domain), m_npmax(3000),
+    m_coarsen(-1.0), m_min_range(0.01), m_domain(&domain), m_npmax(3000),
     m_gridmin(1e-10)
 {
     m_nv = m_domain->nComponents();
@@ -42,6 +42,16 @@ void Refiner::setCriteria(doublereal ratio, doublereal slope,
     m_prune = prune;
 }
 
+void Refiner::setCoarsenThreshold(double coarsen)
+{
+    if (coarsen >= 1.0) {
+        throw CanteraError("Refiner::setCoarsenThreshold",
+            "'coarsen' must be less than 1.0 (" + fp2str(coarsen) +
+            " was specified).");
+    }
+    m_coarsen = coarsen;
+}
+
 int Refiner::analyze(size_t n, const doublereal* z,
                      const doublereal* x)
 {
@@ -57,6 +67,7 @@ int Refiner::analyze(size_t n, const doublereal* z,
     m_loc.clear();
     m_c.clear();
     m_keep.clear();
+    m_remove.clear();
 
     m_keep[0] = 1;
     m_keep[n-1] = 1;
@@ -198,9 +209,108 @@ int Refiner::analyze(size_t n, const doublereal* z,
         }
     }
 
+    if (m_coarsen > 0.0) {
+        coarsen(n, z, x);
+    }
+
     return int(m_loc.size());
 }
 
+void Refiner::coarsen(size_t n, const doublereal* z, const doublereal* x)
+{
+    // Need at least two intervals on either side of a point to evaluate the
+    // change in slope across the merged interval.
+    if (n < 5) {
+        return;
+    }
+
+    // candidate[j] is true if point j may be removed
+    std::vector<bool> candidate(n, true);
+    candidate[0] = false;
+    candidate[1] = false;
+    candidate[n-2] = false;
+    candidate[n-1] = false;
+
+    vector_fp dz(n-1);
+    for (size_t j = 0; j < n-1; j++) {
+        dz[j] = z[j+1] - z[j];
+    }
+
+    FreeFlame* fflame = dynamic_cast<FreeFlame*>(m_domain);
+
+    for (size_t j = 2; j < n-2; j++) {
+        // Don't remove points bounding an interval that is being refined, or
+        // points already required to satisfy the grid ratio criterion or to
+        // hold the fixed temperature point.
+        if (m_loc.count(j-1) || m_loc.count(j) ||
+            (fflame && z[j] == fflame->m_zfixed)) {
+            candidate[j] = false;
+            continue;
+        }
+
+        // Removing the point must not make the merged interval too large
+        // compared to its neighbors.
+        doublereal dzm = z[j+1] - z[j-1];
+        if (dzm > m_coarsen * m_ratio * dz[j-2] ||
+            dzm > m_coarsen * m_ratio * dz[j+1]) {
+            candidate[j] = false;
+        }
+    }
+
+    vector_fp v(n), s(n-1);
+    for (size_t i = 0; i < m_nv; i++) {
+        if (!m_active[i]) {
+            continue;
+        }
+        for (size_t j = 0; j < n; j++) {
+            v[j] = value(x, i, j);
+        }
+        for (size_t j = 0; j < n-1; j++) {
+            s[j] = (v[j+1] - v[j]) / dz[j];
+        }
+
+        // Use the same scales as the refinement criteria in analyze()
+        doublereal vmin = *min_element(v.begin(), v.end());
+        doublereal vmax = *max_element(v.begin(), v.end());
+        doublereal smin = *min_element(s.begin(), s.end());
+        doublereal smax = *max_element(s.begin(), s.end());
+        doublereal aa = std::max(fabs(vmax), fabs(vmin));
+        doublereal ss = std::max(fabs(smax), fabs(smin));
+        bool checkValue = (vmax - vmin) > m_min_range*aa;
+        bool checkSlope = (smax - smin) > m_min_range*ss;
+        doublereal dmaxValue = m_coarsen * (m_slope*(vmax - vmin) + m_thresh);
+        doublereal dmaxSlope = m_coarsen * m_curve * (smax - smin);
+
+        for (size_t j = 2; j < n-2; j++) {
+            if (!candidate[j]) {
+                continue;
+            }
+            if (checkValue && fabs(v[j+1] - v[j-1]) > dmaxValue) {
+                candidate[j] = false;
+                continue;
+            }
+            if (checkSlope) {
+                // slope across the merged interval
+                doublereal sm = (v[j+1] - v[j-1]) / (z[j+1] - z[j-1]);
+                if (fabs(s[j] - s[j-1]) > dmaxSlope + m_thresh/dz[j-1] ||
+                    fabs(sm - s[j-2]) > dmaxSlope + m_thresh/dz[j-2] ||
+                    fabs(s[j+1] - sm) > dmaxSlope + m_thresh/dz[j+1]) {
+                    candidate[j] = false;
+                }
+            }
+        }
+    }
+
+    // Don't remove adjacent points in a single pass, since the criteria above
+    // assume that the neighbors of each removed point are retained.
+    for (size_t j = 2; j < n-2; j++) {
+        if (candidate[j] && m_keep[j] != -1 && m_keep[j-1] != -1 &&
+            m_keep[j+1] != -1 && !m_remove.count(j-1)) {
+            m_remove.insert(j);
+        }
+    }
+}
+
 double Refiner::value(const double* x, size_t i, size_t j)
 {
     return x[m_domain->index(i,j)];
@@ -228,6 +338,10 @@ void Refiner::show()
     } else if (m_domain->nPoints() > 1) {
         writelog("no new points needed in "+m_domain->id()+"\n");
     }
+    if (!m_remove.empty()) {
+        writelog("Coarsening grid in " + m_domain->id() +
+                 ": removing " + int2str(m_remove.size()) + " points.\n");
+    }
 }
 
 int Refiner::getNewGrid(int n, const doublereal* z,
@@ -1260,6 +1260,11 @@ double DebyeHuckel::_lnactivityWaterHelgesonFixedForm() const
 
 void DebyeHuckel::s_update_lnMolalityActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double z_k, zs_k1, zs_k2;
     /*
      * Update the internally stored vector of molalities
@@ -1511,6 +1516,11 @@ void DebyeHuckel::s_update_lnMolalityActCoeff() const
 
 void DebyeHuckel::s_update_dlnMolalityActCoeff_dT() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
     // First we store dAdT explicitly here
     double dAdT =  dA_DebyedT_TP();
@@ -1637,6 +1647,11 @@ void DebyeHuckel::s_update_dlnMolalityActCoeff_dT() const
 
 void DebyeHuckel::s_update_d2lnMolalityActCoeff_dT2() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
     double dAdT =  dA_DebyedT_TP();
     double d2AdT2 = d2A_DebyedT2_TP();
@@ -1758,6 +1773,11 @@ void DebyeHuckel::s_update_d2lnMolalityActCoeff_dT2() const
 
 void DebyeHuckel::s_update_dlnMolalityActCoeff_dP() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double z_k, coeff, tmp, y, yp1, sigma, tmpLn;
     int est;
     double dAdP =  dA_DebyedP_TP();
@@ -1791,7 +1811,7 @@ void DebyeHuckel::s_update_dlnMolalityActCoeff_dP() const
         for (size_t k = 0; k < m_kk; k++) {
             est = m_electrolyteSpeciesType[k];
             if (est == cEST_nonpolarNeutral) {
-                m_lnActCoeffMolal[k] = 0.0;
+                m_dlnActCoeffMolaldP[k] = 0.0;
             } else {
                 z_k = m_speciesCharge[k];
                 m_dlnActCoeffMolaldP[k] =
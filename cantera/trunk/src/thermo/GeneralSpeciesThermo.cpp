@@ -8,13 +8,83 @@
 
 #include "cantera/thermo/GeneralSpeciesThermo.h"
 #include "cantera/thermo/SpeciesThermoFactory.h"
+#include "cantera/thermo/NasaPoly2.h"
+#include "cantera/thermo/Nasa9PolyMultiTempRegion.h"
 
 namespace Cantera
 {
+
+namespace {
+
+//! Get the regions and coefficients of a species with a NASA polynomial
+//! parameterization, in the form used by PackedNasaPoly::addSpecies().
+//! Returns the number of coefficients per region, or 0 if *sp* is not one of
+//! the NASA polynomial classes.
+size_t getNasaParameters(const SpeciesThermoInterpType* sp, size_t& nreg,
+                         vector_fp& bounds, vector_fp& coeffs)
+{
+    size_t n;
+    int type;
+    doublereal tlow, thigh, pref;
+    bounds.clear();
+    if (sp->reportType() == NASA1) {
+        const NasaPoly1* p = dynamic_cast<const NasaPoly1*>(sp);
+        if (p) {
+            nreg = 1;
+            coeffs.resize(7);
+            p->reportParameters(n, type, tlow, thigh, pref, &coeffs[0]);
+            return 7;
+        }
+    } else if (sp->reportType() == NASA2) {
+        const NasaPoly2* p = dynamic_cast<const NasaPoly2*>(sp);
+        if (p) {
+            nreg = 2;
+            bounds.resize(1);
+            coeffs.resize(14);
+            p->getParameters(bounds[0], &coeffs[0], &coeffs[7]);
+            return 7;
+        }
+    } else if (sp->reportType() == NASA9) {
+        const Nasa9Poly1* p = dynamic_cast<const Nasa9Poly1*>(sp);
+        if (p) {
+            // c = [1, Tmin, Tmax, a0, ..., a8]
+            doublereal c[12];
+            p->reportParameters(n, type, tlow, thigh, pref, c);
+            nreg = 1;
+            coeffs.assign(c + 3, c + 12);
+            return 9;
+        }
+    } else if (sp->reportType() == NASA9MULTITEMP) {
+        const Nasa9PolyMultiTempRegion* p =
+            dynamic_cast<const Nasa9PolyMultiTempRegion*>(sp);
+        if (p) {
+            // c = [nreg, (Tmin, Tmax, a0, ..., a8) for each region]
+            nreg = p->nTemperatureRegions();
+            vector_fp c(1 + 11*nreg);
+            p->reportParameters(n, type, tlow, thigh, pref, &c[0]);
+            coeffs.clear();
+            for (size_t r = 0; r < nreg; r++) {
+                if (r > 0) {
+                    bounds.push_back(c[1 + 11*r]);
+                }
+                coeffs.insert(coeffs.end(), c.begin() + 3 + 11*r,
+                              c.begin() + 12 + 11*r);
+            }
+            return 9;
+        }
+    }
+    return 0;
+}
+
+}
+
 GeneralSpeciesThermo::GeneralSpeciesThermo() :
     m_tlow_max(0.0),
     m_thigh_min(1.0E30),
-    m_p0(OneAtm)
+    m_p0(OneAtm),
+    m_nasa7(7),
+    m_nasa9(9),
+    m_packedValid(false)
 {
 }
 
@@ -24,7 +94,10 @@ GeneralSpeciesThermo::GeneralSpeciesThermo(const GeneralSpeciesThermo& b) :
     m_speciesLoc(b.m_speciesLoc),
     m_tlow_max(b.m_tlow_max),
     m_thigh_min(b.m_thigh_min),
-    m_p0(b.m_p0)
+    m_p0(b.m_p0),
+    m_nasa7(7),
+    m_nasa9(9),
+    m_packedValid(false)
 {
     clear();
     // Copy SpeciesThermoInterpTypes from 'b'
@@ -59,6 +132,8 @@ GeneralSpeciesThermo::operator=(const GeneralSpeciesThermo& b)
 
     m_tpoly = b.m_tpoly;
     m_speciesLoc = b.m_speciesLoc;
+    m_packedValid = false;
+    m_revision++;
     m_tlow_max = b.m_tlow_max;
     m_thigh_min = b.m_thigh_min;
     m_p0 = b.m_p0;
@@ -87,6 +162,52 @@ void GeneralSpeciesThermo::clear()
         }
     }
     m_sp.clear();
+    m_packedValid = false;
+    m_revision++;
+}
+
+void GeneralSpeciesThermo::packNasa() const
+{
+    m_nasa7.clear();
+    m_nasa9.clear();
+    m_packedTypes.clear();
+    size_t nreg;
+    vector_fp bounds, coeffs;
+
+    // Only types for which every species can be packed are skipped by the
+    // general loop in update()
+    for (STIT_map::const_iterator iter = m_sp.begin();
+         iter != m_sp.end();
+         iter++) {
+        bool packed = true;
+        for (size_t k = 0; k < iter->second.size(); k++) {
+            if (!getNasaParameters(iter->second[k], nreg, bounds, coeffs)) {
+                packed = false;
+                break;
+            }
+        }
+        if (packed) {
+            m_packedTypes.insert(iter->first);
+        }
+    }
+
+    // Add the species in order of increasing index, so that they are stored
+    // contiguously if possible
+    for (std::map<size_t, std::pair<int, size_t> >::const_iterator
+         iter = m_speciesLoc.begin();
+         iter != m_speciesLoc.end();
+         iter++) {
+        if (m_packedTypes.find(iter->second.first) == m_packedTypes.end()) {
+            continue;
+        }
+        const SpeciesThermoInterpType* sp = provideSTIT(iter->first);
+        if (getNasaParameters(sp, nreg, bounds, coeffs) == 7) {
+            m_nasa7.addSpecies(iter->first, nreg, DATA_PTR(bounds), &coeffs[0]);
+        } else {
+            m_nasa9.addSpecies(iter->first, nreg, DATA_PTR(bounds), &coeffs[0]);
+        }
+    }
+    m_packedValid = true;
 }
 
 void GeneralSpeciesThermo::install(const std::string& name,
@@ -125,6 +246,8 @@ void GeneralSpeciesThermo::install_STIT(SpeciesThermoInterpType* stit_ptr)
     int type = stit_ptr->reportType();
     m_speciesLoc[index] = std::make_pair(type, m_sp[type].size());
     m_sp[type].push_back(stit_ptr);
+    m_packedValid = false;
+    m_revision++;
     if (m_sp[type].size() == 1) {
         m_tpoly[type].resize(stit_ptr->temperaturePolySize());
     }
@@ -154,9 +277,15 @@ void GeneralSpeciesThermo::update_one(size_t k, doublereal t, doublereal* cp_R,
 void GeneralSpeciesThermo::update(doublereal t, doublereal* cp_R,
                                   doublereal* h_RT, doublereal* s_R) const
 {
+    if (!m_packedValid) {
+        packNasa();
+    }
     STIT_map::const_iterator iter = m_sp.begin();
     tpoly_map::iterator jter = m_tpoly.begin();
     for (; iter != m_sp.end(); iter++, jter++) {
+        if (m_packedTypes.find(iter->first) != m_packedTypes.end()) {
+            continue;
+        }
         const std::vector<SpeciesThermoInterpType*>& species = iter->second;
         double* tpoly = &jter->second[0];
         species[0]->updateTemperaturePoly(t, tpoly);
@@ -164,6 +293,62 @@ void GeneralSpeciesThermo::update(doublereal t, doublereal* cp_R,
             species[k]->updateProperties(tpoly, cp_R, h_RT, s_R);
         }
     }
+    m_nasa7.update(t, cp_R, h_RT, s_R);
+    m_nasa9.update(t, cp_R, h_RT, s_R);
+}
+
+bool GeneralSpeciesThermo::getMixtureCoeffs(const doublereal* x,
+                                            vector_fp& coeffs) const
+{
+    if (!m_packedValid) {
+        packNasa();
+    }
+    if (m_nasa7.nSpecies() + m_nasa9.nSpecies() != m_speciesLoc.size()) {
+        return false;
+    }
+    size_t n7 = m_nasa7.nMixtureCoeffs();
+    coeffs.resize(n7 + m_nasa9.nMixtureCoeffs());
+    m_nasa7.getMixtureCoeffs(x, DATA_PTR(coeffs));
+    m_nasa9.getMixtureCoeffs(x, DATA_PTR(coeffs) + n7);
+    return true;
+}
+
+void GeneralSpeciesThermo::evalMixture(const vector_fp& coeffs, doublereal T,
+                                       doublereal& cp_R,
+                                       doublereal& h_RT) const
+{
+    cp_R = 0.0;
+    h_RT = 0.0;
+    size_t n7 = m_nasa7.nMixtureCoeffs();
+    m_nasa7.evalMixture(DATA_PTR(coeffs), T, cp_R, h_RT);
+    m_nasa9.evalMixture(DATA_PTR(coeffs) + n7, T, cp_R, h_RT);
+}
+
+void GeneralSpeciesThermo::updateMany(size_t nStates, const doublereal* T,
+                                      size_t ld, doublereal* cp_R,
+                                      doublereal* h_RT, doublereal* s_R) const
+{
+    if (!m_packedValid) {
+        packNasa();
+    }
+    STIT_map::const_iterator iter = m_sp.begin();
+    tpoly_map::iterator jter = m_tpoly.begin();
+    for (; iter != m_sp.end(); iter++, jter++) {
+        if (m_packedTypes.find(iter->first) != m_packedTypes.end()) {
+            continue;
+        }
+        const std::vector<SpeciesThermoInterpType*>& species = iter->second;
+        double* tpoly = &jter->second[0];
+        for (size_t i = 0; i < nStates; i++) {
+            species[0]->updateTemperaturePoly(T[i], tpoly);
+            for (size_t k = 0; k < species.size(); k++) {
+                species[k]->updateProperties(tpoly, cp_R + i*ld,
+                                             h_RT + i*ld, s_R + i*ld);
+            }
+        }
+    }
+    m_nasa7.updateMany(nStates, T, ld, cp_R, h_RT, s_R);
+    m_nasa9.updateMany(nStates, T, ld, cp_R, h_RT, s_R);
 }
 
 int GeneralSpeciesThermo::reportType(size_t index) const
@@ -228,6 +413,9 @@ doublereal GeneralSpeciesThermo::refPressure(size_t k) const
 
 SpeciesThermoInterpType* GeneralSpeciesThermo::provideSTIT(size_t k)
 {
+    // The caller may modify the parameterization
+    m_packedValid = false;
+    m_revision++;
     try {
         const std::pair<int, size_t>& loc = getValue(m_speciesLoc, k);
         return getValue(m_sp, loc.first)[loc.second];
@@ -322,6 +322,10 @@ HMWSoln& HMWSoln::operator=(const HMWSoln& b)
         m_molalitiesCropped    = b.m_molalitiesCropped;
         m_molalitiesAreCropped = b.m_molalitiesAreCropped;
         m_CounterIJ            = b.m_CounterIJ;
+        m_CationAnionPairs     = b.m_CationAnionPairs;
+        m_LikeChargePairs      = b.m_LikeChargePairs;
+        m_PsiNonzero           = b.m_PsiNonzero;
+        m_PsiSum_k             = b.m_PsiSum_k;
 
         m_gfunc_IJ            = b.m_gfunc_IJ;
         m_g2func_IJ           = b.m_g2func_IJ;
@@ -1123,11 +1127,13 @@ void HMWSoln::initLengths()
     m_CMX_IJ_P.resize(maxCounterIJlen, 0.0);
 
     m_gamma_tmp.resize(m_kk, 0.0);
+    m_PsiSum_k.resize(m_kk, 0.0);
 
     IMS_lnActCoeffMolal_.resize(m_kk, 0.0);
     CROP_speciesCropped_.resize(m_kk, 0);
 
     counterIJ_setup();
+    initInteractionLists();
 }
 
 void HMWSoln::s_update_lnMolalityActCoeff() const
@@ -1399,6 +1405,87 @@ void HMWSoln::counterIJ_setup(void) const
     }
 }
 
+void HMWSoln::initInteractionLists()
+{
+    m_CationAnionPairs.clear();
+    m_LikeChargePairs.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = i+1; j < m_kk; j++) {
+            if (charge(i)*charge(j) < 0.0) {
+                m_CationAnionPairs.push_back(std::make_pair(i, j));
+            } else if (charge(i)*charge(j) > 0.0) {
+                m_LikeChargePairs.push_back(std::make_pair(i, j));
+            }
+        }
+    }
+
+    m_PsiNonzero.clear();
+    for (size_t i = 1; i < m_kk; i++) {
+        for (size_t j = 1; j < m_kk; j++) {
+            for (size_t k = 1; k < m_kk; k++) {
+                size_t n = k + j * m_kk + i * m_kk * m_kk;
+                const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+                for (size_t m = 0; m < m_Psi_ijk_coeff.nRows(); m++) {
+                    if (Psi_coeff[m] != 0.0) {
+                        m_PsiNonzero.push_back(n);
+                        break;
+                    }
+                }
+            }
+        }
+    }
+}
+
+double HMWSoln::s_updatePitzer_psiSums(const double* psi, double* lnac) const
+{
+    const double* molality = DATA_PTR(m_molalitiesCropped);
+    std::fill(lnac, lnac + m_kk, 0.0);
+    double osmoticSum = 0.0;
+    for (size_t m = 0; m < m_PsiNonzero.size(); m++) {
+        size_t n = m_PsiNonzero[m];
+        size_t i = n / (m_kk * m_kk);
+        size_t j = (n / m_kk) % m_kk;
+        size_t k = n % m_kk;
+        double mmpsi = molality[j] * molality[k] * psi[n];
+        if (charge(i) > 0.0) {
+            if (charge(j) < 0.0 && charge(k) < 0.0 && k > j) {
+                // cation i with a non-duplicate pair of anions j, k
+                lnac[i] += mmpsi;
+            } else if (charge(j) > 0.0 && charge(k) < 0.0) {
+                // cations i, j with the anion k
+                lnac[i] += mmpsi;
+                if (j > i) {
+                    osmoticSum += molality[i] * mmpsi;
+                }
+            }
+        } else if (charge(i) < 0.0) {
+            if (charge(j) > 0.0 && charge(k) > 0.0 && k > j) {
+                // anion i with a non-duplicate pair of cations j, k
+                lnac[i] += mmpsi;
+            } else if (charge(j) < 0.0 && charge(k) > 0.0) {
+                // anions i, j with the cation k
+                lnac[i] += mmpsi;
+                if (j > i) {
+                    osmoticSum += molality[i] * mmpsi;
+                }
+            }
+        } else if (charge(j) > 0.0 && charge(k) < 0.0) {
+            // zeta term for the neutral i, the cation j and the anion k
+            lnac[i] += mmpsi;
+            lnac[j] += molality[i] * molality[k] * psi[n];
+            lnac[k] += molality[i] * molality[j] * psi[n];
+            osmoticSum += molality[i] * mmpsi;
+        }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sn = speciesName(i) + "," + speciesName(j) + "," +
+                             speciesName(k) + ":";
+            printf("      Psi term on %-24s            psi_ijk = %10.5f\n",
+                   sn.c_str(), psi[n]);
+        }
+    }
+    return osmoticSum;
+}
+
 void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 {
     double T = temperature();
@@ -1621,52 +1708,40 @@ void HMWSoln::s_updatePitzer_CoeffWRTemp(int doDerivs) const
 
     switch(m_formPitzerTemp) {
     case PITZER_TEMP_CONSTANT:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0];
-              }
-          }
+      for (size_t m = 0; m < m_PsiNonzero.size(); m++) {
+          size_t n = m_PsiNonzero[m];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0];
       }
       break;
     case PITZER_TEMP_LINEAR:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
-                  m_Psi_ijk_L[n]    = Psi_coeff[1];
-                  m_Psi_ijk_LL[n]   = 0.0;
-              }
-          }
+      for (size_t m = 0; m < m_PsiNonzero.size(); m++) {
+          size_t n = m_PsiNonzero[m];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n]      = Psi_coeff[0] + Psi_coeff[1]*tlin;
+          m_Psi_ijk_L[n]    = Psi_coeff[1];
+          m_Psi_ijk_LL[n]   = 0.0;
       }
       break;
     case PITZER_TEMP_COMPLEX1:
-      for (size_t i = 1; i < m_kk; i++) {
-          for (size_t j = 1; j < m_kk; j++) {
-              for (size_t k = 1; k < m_kk; k++) {
-                  size_t n = i * m_kk *m_kk + j * m_kk + k ;
-                  const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
-                  m_Psi_ijk[n] = Psi_coeff[0]
-                                 + Psi_coeff[1]*tlin
-                                 + Psi_coeff[2]*tquad
-                                 + Psi_coeff[3]*tinv
-                                 + Psi_coeff[4]*tln;
-
-                  m_Psi_ijk_L[n] = Psi_coeff[1]
-                                   + Psi_coeff[2]*twoT
-                                   - Psi_coeff[3]*invT2
-                                   + Psi_coeff[4]*invT;
-
-                  m_Psi_ijk_LL[n] =
-                      Psi_coeff[2]*2.0
-                      + Psi_coeff[3]*twoinvT3
-                      - Psi_coeff[4]*invT2;
-              }
-          }
+      for (size_t m = 0; m < m_PsiNonzero.size(); m++) {
+          size_t n = m_PsiNonzero[m];
+          const double* Psi_coeff = m_Psi_ijk_coeff.ptrColumn(n);
+          m_Psi_ijk[n] = Psi_coeff[0]
+                         + Psi_coeff[1]*tlin
+                         + Psi_coeff[2]*tquad
+                         + Psi_coeff[3]*tinv
+                         + Psi_coeff[4]*tln;
+
+          m_Psi_ijk_L[n] = Psi_coeff[1]
+                           + Psi_coeff[2]*twoT
+                           - Psi_coeff[3]*invT2
+                           + Psi_coeff[4]*invT;
+
+          m_Psi_ijk_LL[n] =
+              Psi_coeff[2]*2.0
+              + Psi_coeff[3]*twoinvT3
+              - Psi_coeff[4]*invT2;
       }
       break;
     }
@@ -1804,53 +1879,40 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0 *
+                               (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -1863,47 +1925,32 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX[counterIJ]  = beta0MX[counterIJ]
-                                  + beta1MX[counterIJ] * gfunc[counterIJ]
-                                  + beta2MX[counterIJ] * g2func[counterIJ];
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        BMX[counterIJ]  = beta0MX[counterIJ]
+                          + beta1MX[counterIJ] * gfunc[counterIJ]
+                          + beta2MX[counterIJ] * g2func[counterIJ];
 
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX[counterIJ], beta0MX[counterIJ],
-                           beta1MX[counterIJ], beta2MX[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
-                                           beta2MX[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX[counterIJ] = 0.0;
-                }
-                BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
-            } else {
-                BMX[counterIJ]      = 0.0;
-                BprimeMX[counterIJ] = 0.0;
-                BphiMX[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ]);
-            }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX[counterIJ], beta0MX[counterIJ],
+                   beta1MX[counterIJ], beta2MX[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX[counterIJ] = (beta1MX[counterIJ] * hfunc[counterIJ]/Is +
+                                   beta2MX[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX[counterIJ] = 0.0;
+        }
+        BphiMX[counterIJ]   = BMX[counterIJ] + Is*BprimeMX[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX[counterIJ], BprimeMX[counterIJ], BphiMX[counterIJ]);
         }
     }
 
@@ -1915,29 +1962,17 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX[counterIJ] = CphiMX[counterIJ]/
-                                 (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        CMX[counterIJ] = CphiMX[counterIJ]/
+                         (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX[counterIJ]);
         }
     }
 
@@ -1950,35 +1985,21 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                int z1 = (int) fabs(charge(i));
-                int z2 = (int) fabs(charge(j));
-                Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
-                Phiprime[counterIJ] = etheta_prime[z1][z2];
-                Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        int z1 = (int) fabs(charge(i));
+        int z2 = (int) fabs(charge(j));
+        Phi[counterIJ] = thetaij[counterIJ] + etheta[z1][z2];
+        Phiprime[counterIJ] = etheta_prime[z1][z2];
+        Phiphi[counterIJ] = Phi[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi[counterIJ], Phiprime[counterIJ], Phiphi[counterIJ]);
         }
     }
 
@@ -1995,36 +2016,39 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of F = %10.6f \n", F);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                F = F + molality[i]*molality[j] * BprimeMX[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign
-             */
-            if (charge(i)*charge(j) > 0) {
-                F = F + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" F = %10.6f \n", F);
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        F = F + molality[i]*molality[j] * BprimeMX[counterIJ];
+    }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        F = F + molality[i]*molality[j] * Phiprime[counterIJ];
+    }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" F = %10.6f \n", F);
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" Step 8: Summing in All Contributions to Activity Coefficients \n");
     }
 
+    /*
+     * The ternary CMX terms are the same for all the ions, apart from
+     * the factor |z_i|. The psi and zeta terms are evaluated only for
+     * the ternary interactions with nonzero parameters.
+     */
+    double sumCMX = 0.0;
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sumCMX += molality[i]*molality[j]*CMX[counterIJ];
+    }
+    double psiOsmotic = s_updatePitzer_psiSums(psi_ijk, DATA_PTR(m_PsiSum_k));
+
     for (size_t i = 1; i < m_kk; i++) {
 
         /*
@@ -2044,8 +2068,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
             }
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -2065,27 +2089,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         printf("                                                   m_j Z CMX = %10.5f\n",
                                molality[j]* molarcharge*CMX[counterIJ]);
                     }
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    if (psi_ijk[n] != 0.0) {
-                                        std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                        printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                               molality[j]*molality[k]*psi_ijk[n]);
-                                    }
-                                }
-                            }
-                        }
-                    }
                 }
 
 
@@ -2101,35 +2104,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                             }
                         }
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -2144,25 +2118,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                    molality[j]*2.0*m_Lambda_nj(j,i));
                         }
                     }
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta;
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s         m_n m_a zeta_nMa = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
             }
             /*
@@ -2195,8 +2150,8 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
             }
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -2218,22 +2173,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         printf("                                                   m_j Z CMX = %10.5f\n",
                                molality[j]* molarcharge*CMX[counterIJ]);
                     }
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    if (psi_ijk[n] != 0.0) {
-                                        std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                        printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                               molality[j]*molality[k]*psi_ijk[n]);
-                                    }
-                                }
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -2251,35 +2190,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                             }
                         }
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Psi term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX[counterIJ2]);
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if ((molality[j]*molality[k]*CMX[counterIJ2]) != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Tern CMX term on %-16s abs(z_i) m_j m_k CMX = %10.5f\n", snj.c_str(),
-                                           fabs(charge(i))* molality[j]*molality[k]*CMX[counterIJ2]);
-                                }
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -2294,26 +2204,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                    molality[j]*2.0*m_Lambda_nj(j,i));
                         }
                     }
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta;
-                                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s         m_n m_c zeta_ncX = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
                 }
             }
             m_lnActCoeffMolal_Unscaled[i] = zsqF + sum1 + sum2 + sum3 + sum4 + sum5;
@@ -2335,7 +2225,7 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                 printf("  Contributions to ln(ActCoeff_%s):\n", sni.c_str());
             }
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum_k[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 = sum1 + molality[j]*2.0*m_Lambda_nj(i,j);
                 if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2345,24 +2235,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                                molality[j]*2.0*m_Lambda_nj(i,j));
                     }
                 }
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk[n];
-                            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                                if (psi_ijk[n] != 0.0) {
-                                    std::string snj = speciesName(j) + "," + speciesName(k) + ":";
-                                    printf("      Zeta term on %-16s           m_j m_k psi_ijk = %10.5f\n", snj.c_str(),
-                                           molality[j]*molality[k]*psi_ijk[n]);
-                                }
-                            }
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i]* molality[i] * m_Mu_nnn[i];
             if (DEBUG_MODE_ENABLED && m_debugCalc) {
@@ -2395,7 +2267,7 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
     double sum4 = 0.0;
     double sum5 = 0.0;
     double sum6 = 0.0;
-    double sum7 = 0.0;
+    double sum7 = psiOsmotic;
     /*
      * term1 is the DH term in the osmotic coefficient expression
      * b = 1.2 sqrt(kg/gmol) <- arbitrarily set in all Pitzer
@@ -2405,80 +2277,26 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
      */
     double term1 = -Aphi * pow(Is,1.5) / (1.0 + 1.2 * sqrt(Is));
 
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX[counterIJ] + molarcharge*CMX[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk[n];
-                        }
-                    }
-                }
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sum1 = sum1 + molality[i]*molality[j]*
+               (BphiMX[counterIJ] + molarcharge*CMX[counterIJ]);
+    }
 
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_lnMolalityActCoeff",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk[n];
-                        }
-                    }
-                }
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        if (charge(i) > 0.0) {
+            sum2 = sum2 + molality[i]*molality[j]*Phiphi[counterIJ];
+        } else {
+            sum3 = sum3 + molality[i]*molality[j]*Phiphi[counterIJ];
         }
+    }
 
+    for (size_t j = 1; j < m_kk; j++) {
         /*
          * Loop Over Neutral Species
          */
@@ -2497,19 +2315,6 @@ void HMWSoln::s_updatePitzer_lnMolalityActCoeff() const
                         sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta = psi_ijk[n];
-                            if (zeta != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta;
-                            }
-                        }
-                    }
-                }
             }
             sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn[j];
         }
@@ -2720,52 +2525,40 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0 *
-                                       (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ]     =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0 *
+                               (1.0-(1.0 + x1 + 0.5 * x1 *x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_L[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_L[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -2779,45 +2572,31 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_L[counterIJ]  = beta0MX_L[counterIJ]
-                                    + beta1MX_L[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_L[counterIJ] * gfunc[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
-                           beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_L[counterIJ] = 0.0;
-                }
-                BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
-            } else {
-                BMX_L[counterIJ]      = 0.0;
-                BprimeMX_L[counterIJ] = 0.0;
-                BphiMX_L[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        BMX_L[counterIJ]  = beta0MX_L[counterIJ]
+                            + beta1MX_L[counterIJ] * gfunc[counterIJ]
+                            + beta2MX_L[counterIJ] * gfunc[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_L[counterIJ], beta0MX_L[counterIJ],
+                   beta1MX_L[counterIJ],  beta2MX_L[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_L[counterIJ] = (beta1MX_L[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_L[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_L[counterIJ] = 0.0;
+        }
+        BphiMX_L[counterIJ] = BMX_L[counterIJ] + Is*BprimeMX_L[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_L[counterIJ], BprimeMX_L[counterIJ], BphiMX_L[counterIJ]);
         }
     }
 
@@ -2829,29 +2608,17 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_L[counterIJ] = CphiMX_L[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_L[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        CMX_L[counterIJ] = CphiMX_L[counterIJ]/
+                           (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_L[counterIJ]);
         }
     }
 
@@ -2864,33 +2631,19 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_L[counterIJ] = thetaij_L[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_L[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_L[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        Phi_L[counterIJ] = thetaij_L[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_L[counterIJ] = Phi_L[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_L[counterIJ], Phiprime[counterIJ], Phiphi_L[counterIJ]);
         }
     }
 
@@ -2907,36 +2660,39 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of dFdT = %10.6f \n", dFdT);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdT = %10.6f \n", dFdT);
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        dFdT = dFdT + molality[i]*molality[j] * BprimeMX_L[counterIJ];
+    }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        dFdT = dFdT + molality[i]*molality[j] * Phiprime[counterIJ];
+    }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" dFdT = %10.6f \n", dFdT);
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" Step 8: \n");
     }
 
+    /*
+     * The ternary CMX terms are the same for all the ions, apart from
+     * the factor |z_i|. The psi and zeta terms are evaluated only for
+     * the ternary interactions with nonzero parameters.
+     */
+    double sumCMX = 0.0;
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sumCMX += molality[i]*molality[j]*CMX_L[counterIJ];
+    }
+    double psiOsmotic = s_updatePitzer_psiSums(psi_ijk_L, DATA_PTR(m_PsiSum_k));
+
     for (size_t i = 1; i < m_kk; i++) {
         /*
          * -------- SUBSECTION FOR CALCULATING THE dACTCOEFFdT FOR CATIONS -----
@@ -2947,8 +2703,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
             double zsqdFdT = charge(i)*charge(i)*dFdT;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -2961,20 +2717,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     // sum over all anions
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                            }
-                        }
-                    }
                 }
 
 
@@ -2983,21 +2725,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_L[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -3006,20 +2733,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 if (charge(j) == 0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
                 }
-                /*
-                 * Zeta interaction term
-                 */
-                for (size_t k = 1; k < m_kk; k++) {
-                    if (charge(k) < 0.0) {
-                        size_t izeta = j;
-                        size_t jzeta = i;
-                        n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                        double zeta_L = psi_ijk_L[n];
-                        if (zeta_L != 0.0) {
-                            sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-                        }
-                    }
-                }
             }
             /*
              * Add all of the contributions up to yield the log of the
@@ -3046,8 +2759,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
             double zsqdFdT = charge(i)*charge(i)*dFdT;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -3062,15 +2775,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                 if (charge(j) > 0) {
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -3081,21 +2785,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_L[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_L[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_L[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -3103,18 +2792,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                  */
                 if (charge(j) == 0.0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_L(j,i);
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_L = psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
                 }
             }
             m_dlnActCoeffMolaldT_Unscaled[i] =
@@ -3135,20 +2812,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
          */
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum_k[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_L(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_L[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_L[i];
             m_dlnActCoeffMolaldT_Unscaled[i] = sum1 + sum2 + sum3;
@@ -3174,7 +2840,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
     double sum4 = 0.0;
     double sum5 = 0.0;
     double sum6 = 0.0;
-    double sum7 = 0.0;
+    double sum7 = psiOsmotic;
     /*
      * term1 is the temperature derivative of the
      * DH term in the osmotic coefficient expression
@@ -3185,80 +2851,26 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
      */
     double term1 = -dAphidT * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
 
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sum1 = sum1 + molality[i]*molality[j]*
+               (BphiMX_L[counterIJ] + molarcharge*CMX_L[counterIJ]);
+    }
 
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_L[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_L[n];
-                        }
-                    }
-                }
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        if (charge(i) > 0.0) {
+            sum2 = sum2 + molality[i]*molality[j]*Phiphi_L[counterIJ];
+        } else {
+            sum3 = sum3 + molality[i]*molality[j]*Phiphi_L[counterIJ];
         }
+    }
 
+    for (size_t j = 1; j < m_kk; j++) {
         /*
          * Loop Over Neutral Species
          */
@@ -3277,19 +2889,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dT() const
                         sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_L(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_L = psi_ijk_L[n];
-                            if (zeta_L != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_L;
-                            }
-                        }
-                    }
-                }
             }
             sum7 += molality[j]*molality[j]*molality[j]*m_Mu_nnn_L[j];
         }
@@ -3490,52 +3089,40 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of gfunc(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 *x1);
+            hfunc[counterIJ] = -2.0*
+                               (1.0-(1.0 + x1 + 0.5*x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_LL[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_LL[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
     /*
      * ------- SUBSECTION TO CALCULATE BMX_L, BprimeMX_LL, BphiMX_L ----------
@@ -3548,45 +3135,31 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
-                                     + beta1MX_LL[counterIJ] * gfunc[counterIJ]
-                                     + beta2MX_LL[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
-                           beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
-                                              beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_LL[counterIJ] = 0.0;
-                }
-                BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
-            } else {
-                BMX_LL[counterIJ]      = 0.0;
-                BprimeMX_LL[counterIJ] = 0.0;
-                BphiMX_LL[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        BMX_LL[counterIJ]  = beta0MX_LL[counterIJ]
+                             + beta1MX_LL[counterIJ] * gfunc[counterIJ]
+                             + beta2MX_LL[counterIJ] * g2func[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_LL[counterIJ], beta0MX_LL[counterIJ],
+                   beta1MX_LL[counterIJ], beta2MX_LL[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_LL[counterIJ] = (beta1MX_LL[counterIJ] * hfunc[counterIJ]/Is +
+                                      beta2MX_LL[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_LL[counterIJ] = 0.0;
+        }
+        BphiMX_LL[counterIJ] = BMX_LL[counterIJ] + Is*BprimeMX_LL[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_LL[counterIJ], BprimeMX_LL[counterIJ], BphiMX_LL[counterIJ]);
         }
     }
 
@@ -3598,29 +3171,17 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
-                                    (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_LL[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        CMX_LL[counterIJ] = CphiMX_LL[counterIJ]/
+                            (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_LL[counterIJ]);
         }
     }
 
@@ -3633,33 +3194,19 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_LL[counterIJ] = thetaij_LL[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
-            } else {
-                Phi_LL[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_LL[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        Phi_LL[counterIJ] = thetaij_LL[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_LL[counterIJ] = Phi_LL[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_LL[counterIJ], Phiprime[counterIJ], Phiphi_LL[counterIJ]);
         }
     }
 
@@ -3675,36 +3222,39 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of d2FdT2 = %10.6f \n", d2FdT2);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" d2FdT2 = %10.6f \n", d2FdT2);
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        d2FdT2 = d2FdT2 + molality[i]*molality[j] * BprimeMX_LL[counterIJ];
+    }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        d2FdT2 = d2FdT2 + molality[i]*molality[j] * Phiprime[counterIJ];
+    }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" d2FdT2 = %10.6f \n", d2FdT2);
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" Step 8: \n");
     }
 
+    /*
+     * The ternary CMX terms are the same for all the ions, apart from
+     * the factor |z_i|. The psi and zeta terms are evaluated only for
+     * the ternary interactions with nonzero parameters.
+     */
+    double sumCMX = 0.0;
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sumCMX += molality[i]*molality[j]*CMX_LL[counterIJ];
+    }
+    double psiOsmotic = s_updatePitzer_psiSums(psi_ijk_LL, DATA_PTR(m_PsiSum_k));
+
     for (size_t i = 1; i < m_kk; i++) {
 
         /*
@@ -3716,8 +3266,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
             double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -3730,20 +3280,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     // sum over all anions
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            }
-                        }
-                    }
                 }
 
 
@@ -3752,21 +3288,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_LL[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -3774,20 +3295,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                  */
                 if (charge(j) == 0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
                 }
             }
             /*
@@ -3815,8 +3322,8 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
             double zsqd2FdT2 = charge(i)*charge(i)*d2FdT2;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -3831,15 +3338,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                 if (charge(j) > 0) {
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -3850,21 +3348,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_LL[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_LL[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_LL[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -3872,21 +3355,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                  */
                 if (charge(j) == 0.0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_LL(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
                 }
             }
             m_d2lnActCoeffMolaldT2_Unscaled[i] =
@@ -3906,20 +3374,9 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
          */
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum_k[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 = sum1 + molality[j]*2.0*m_Lambda_nj_LL(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_LL[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_LL[i];
             m_d2lnActCoeffMolaldT2_Unscaled[i] = sum1 + sum2 + sum3;
@@ -3944,7 +3401,7 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
     double sum4 = 0.0;
     double sum5 = 0.0;
     double sum6 = 0.0;
-    double sum7 = 0.0;
+    double sum7 = psiOsmotic;
     /*
      * term1 is the temperature derivative of the
      * DH term in the osmotic coefficient expression
@@ -3955,80 +3412,26 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
      */
     double term1 = -d2AphidT2 * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
 
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sum1 = sum1 + molality[i]*molality[j]*
+               (BphiMX_LL[counterIJ] + molarcharge*CMX_LL[counterIJ]);
+    }
 
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_LL[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_LL[n];
-                        }
-                    }
-                }
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        if (charge(i) > 0.0) {
+            sum2 = sum2 + molality[i]*molality[j]*Phiphi_LL[counterIJ];
+        } else {
+            sum3 = sum3 + molality[i]*molality[j]*Phiphi_LL[counterIJ];
         }
+    }
 
+    for (size_t j = 1; j < m_kk; j++) {
         /*
          * Loop Over Neutral Species
          */
@@ -4047,19 +3450,6 @@ void HMWSoln::s_updatePitzer_d2lnMolalityActCoeff_dT2() const
                         sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_LL(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_LL = psi_ijk_LL[n];
-                            if (zeta_LL != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_LL;
-                            }
-                        }
-                    }
-                }
             }
 
             sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_LL[j];
@@ -4255,52 +3645,40 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
      *   In the original literature, hfunc, was called gprime. However,
      *   it's not the derivative of g(x), so I renamed it.
      */
-    for (size_t i = 1; i < (m_kk - 1); i++) {
-        for (size_t j = (i+1); j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * Only loop over oppositely charge species
-             */
-            if (charge(i)*charge(j) < 0) {
-                /*
-                 * x is a reduced function variable
-                 */
-                double x1 = sqrtIs * alpha1MX[counterIJ];
-                if (x1 > 1.0E-100) {
-                    gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
-                    hfunc[counterIJ] = -2.0*
-                                       (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
-                } else {
-                    gfunc[counterIJ] = 0.0;
-                    hfunc[counterIJ] = 0.0;
-                }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        /*
+         * x is a reduced function variable
+         */
+        double x1 = sqrtIs * alpha1MX[counterIJ];
+        if (x1 > 1.0E-100) {
+            gfunc[counterIJ] =  2.0*(1.0-(1.0 + x1) * exp(-x1)) / (x1 * x1);
+            hfunc[counterIJ] = -2.0*
+                               (1.0-(1.0 + x1 + 0.5 * x1 * x1) * exp(-x1)) / (x1 * x1);
+        } else {
+            gfunc[counterIJ] = 0.0;
+            hfunc[counterIJ] = 0.0;
+        }
 
-                if (beta2MX_P[counterIJ] != 0.0) {
-                    double x2 = sqrtIs * alpha2MX[counterIJ];
-                    if (x2 > 1.0E-100) {
-                        g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
-                        h2func[counterIJ] = -2.0 *
-                                            (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
-                    } else {
-                        g2func[counterIJ] = 0.0;
-                        h2func[counterIJ] = 0.0;
-                    }
-                }
+        if (beta2MX_P[counterIJ] != 0.0) {
+            double x2 = sqrtIs * alpha2MX[counterIJ];
+            if (x2 > 1.0E-100) {
+                g2func[counterIJ] =  2.0*(1.0-(1.0 + x2) * exp(-x2)) / (x2 * x2);
+                h2func[counterIJ] = -2.0 *
+                                    (1.0-(1.0 + x2 + 0.5 * x2 * x2) * exp(-x2)) / (x2 * x2);
             } else {
-                gfunc[counterIJ] = 0.0;
-                hfunc[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
-                       gfunc[counterIJ], hfunc[counterIJ]);
+                g2func[counterIJ] = 0.0;
+                h2func[counterIJ] = 0.0;
             }
         }
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %9.5f %9.5f \n", sni.c_str(), snj.c_str(),
+                   gfunc[counterIJ], hfunc[counterIJ]);
+        }
     }
 
     /*
@@ -4314,45 +3692,31 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                "BprimeMX    BphiMX   \n");
     }
 
-    for (size_t i = 1; i < m_kk - 1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                BMX_P[counterIJ]  = beta0MX_P[counterIJ]
-                                    + beta1MX_P[counterIJ] * gfunc[counterIJ]
-                                    + beta2MX_P[counterIJ] * g2func[counterIJ];
-                if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                    printf("%d %g: %g %g %g %g\n",
-                           (int) counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
-                           beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
-                }
-                if (Is > 1.0E-150) {
-                    BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
-                                             beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
-                } else {
-                    BprimeMX_P[counterIJ] = 0.0;
-                }
-                BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
-            } else {
-                BMX_P[counterIJ]      = 0.0;
-                BprimeMX_P[counterIJ] = 0.0;
-                BphiMX_P[counterIJ]     = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
-                       sni.c_str(), snj.c_str(),
-                       BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        BMX_P[counterIJ]  = beta0MX_P[counterIJ]
+                            + beta1MX_P[counterIJ] * gfunc[counterIJ]
+                            + beta2MX_P[counterIJ] * g2func[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            printf("%d %g: %g %g %g %g\n",
+                   (int) counterIJ,  BMX_P[counterIJ], beta0MX_P[counterIJ],
+                   beta1MX_P[counterIJ], beta2MX_P[counterIJ], gfunc[counterIJ]);
+        }
+        if (Is > 1.0E-150) {
+            BprimeMX_P[counterIJ] = (beta1MX_P[counterIJ] * hfunc[counterIJ]/Is +
+                                     beta2MX_P[counterIJ] * h2func[counterIJ]/Is);
+        } else {
+            BprimeMX_P[counterIJ] = 0.0;
+        }
+        BphiMX_P[counterIJ] = BMX_P[counterIJ] + Is*BprimeMX_P[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f %11.7f %11.7f \n",
+                   sni.c_str(), snj.c_str(),
+                   BMX_P[counterIJ], BprimeMX_P[counterIJ], BphiMX_P[counterIJ]);
         }
     }
 
@@ -4363,29 +3727,17 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         printf(" Step 5: \n");
         printf(" Species          Species            CMX \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0.0) {
-                CMX_P[counterIJ] = CphiMX_P[counterIJ]/
-                                   (2.0* sqrt(fabs(charge(i)*charge(j))));
-            } else {
-                CMX_P[counterIJ] = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
-                       CMX_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        CMX_P[counterIJ] = CphiMX_P[counterIJ]/
+                           (2.0* sqrt(fabs(charge(i)*charge(j))));
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %11.7f \n", sni.c_str(), snj.c_str(),
+                   CMX_P[counterIJ]);
         }
     }
 
@@ -4398,33 +3750,19 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
         printf(" Species          Species            Phi_ij "
                " Phiprime_ij  Phi^phi_ij \n");
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) > 0) {
-                Phi_P[counterIJ] = thetaij_P[counterIJ];
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
-            } else {
-                Phi_P[counterIJ]      = 0.0;
-                Phiprime[counterIJ] = 0.0;
-                Phiphi_P[counterIJ]   = 0.0;
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                std::string sni = speciesName(i);
-                std::string snj = speciesName(j);
-                printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
-                       sni.c_str(), snj.c_str(),
-                       Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ]);
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        Phi_P[counterIJ] = thetaij_P[counterIJ];
+        Phiprime[counterIJ] = 0.0;
+        Phiphi_P[counterIJ] = Phi_P[counterIJ] + Is * Phiprime[counterIJ];
+        if (DEBUG_MODE_ENABLED && m_debugCalc) {
+            std::string sni = speciesName(i);
+            std::string snj = speciesName(j);
+            printf(" %-16s %-16s %10.6f %10.6f %10.6f \n",
+                   sni.c_str(), snj.c_str(),
+                   Phi_P[counterIJ], Phiprime[counterIJ], Phiphi_P[counterIJ]);
         }
     }
 
@@ -4441,36 +3779,39 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" initial value of dFdP = %10.6f \n", dFdP);
     }
-    for (size_t i = 1; i < m_kk-1; i++) {
-        for (size_t j = i+1; j < m_kk; j++) {
-            /*
-             * Find the counterIJ for the symmetric binary interaction
-             */
-            size_t n = m_kk*i + j;
-            size_t counterIJ = m_CounterIJ[n];
-            /*
-             * both species have a non-zero charge, and one is positive
-             * and the other is negative
-             */
-            if (charge(i)*charge(j) < 0) {
-                dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
-            }
-            /*
-             * Both species have a non-zero charge, and they
-             * have the same sign, e.g., both positive or both negative.
-             */
-            if (charge(i)*charge(j) > 0) {
-                dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
-            }
-            if (DEBUG_MODE_ENABLED && m_debugCalc) {
-                printf(" dFdP = %10.6f \n", dFdP);
-            }
-        }
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        dFdP = dFdP + molality[i]*molality[j] * BprimeMX_P[counterIJ];
+    }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        dFdP = dFdP + molality[i]*molality[j] * Phiprime[counterIJ];
+    }
+    if (DEBUG_MODE_ENABLED && m_debugCalc) {
+        printf(" dFdP = %10.6f \n", dFdP);
     }
     if (DEBUG_MODE_ENABLED && m_debugCalc) {
         printf(" Step 8: \n");
     }
 
+    /*
+     * The ternary CMX terms are the same for all the ions, apart from
+     * the factor |z_i|. The psi and zeta terms are evaluated only for
+     * the ternary interactions with nonzero parameters.
+     */
+    double sumCMX = 0.0;
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sumCMX += molality[i]*molality[j]*CMX_P[counterIJ];
+    }
+    double psiOsmotic = s_updatePitzer_psiSums(psi_ijk_P, DATA_PTR(m_PsiSum_k));
+
     for (size_t i = 1; i < m_kk; i++) {
 
         /*
@@ -4481,8 +3822,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
             double zsqdFdP = charge(i)*charge(i)*dFdP;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -4495,20 +3836,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     // sum over all anions
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        /*
-                         * This term is the ternary interaction involving the
-                         * non-duplicate sum over double anions, j, k, with
-                         * respect to the cation, i.
-                         */
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all anions
-                            if (charge(k) < 0.0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                            }
-                        }
-                    }
                 }
 
 
@@ -4517,21 +3844,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            // two inner sums over anions
-
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the j,k interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 + (fabs(charge(i))*
-                                           molality[j]*molality[k]*CMX_P[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -4539,20 +3851,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                  */
                 if (charge(j) == 0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + k;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
                 }
             }
 
@@ -4581,8 +3879,8 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
             double zsqdFdP = charge(i)*charge(i)*dFdP;
             double sum1 = 0.0;
             double sum2 = 0.0;
-            double sum3 = 0.0;
-            double sum4 = 0.0;
+            double sum3 = m_PsiSum_k[i];
+            double sum4 = fabs(charge(i)) * sumCMX;
             double sum5 = 0.0;
             for (size_t j = 1; j < m_kk; j++) {
                 /*
@@ -4597,15 +3895,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                 if (charge(j) > 0) {
                     sum1 = sum1 + molality[j]*
                            (2.0*BMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                    if (j < m_kk-1) {
-                        for (size_t k = j+1; k < m_kk; k++) {
-                            // an inner sum over all cations
-                            if (charge(k) > 0) {
-                                n = k + j * m_kk + i * m_kk * m_kk;
-                                sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                            }
-                        }
-                    }
                 }
 
                 /*
@@ -4616,21 +3905,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                     if (j != i) {
                         sum2 = sum2 + molality[j]*(2.0*Phi_P[counterIJ]);
                     }
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            // two inner sums over cations
-                            n = k + j * m_kk + i * m_kk * m_kk;
-                            sum2 = sum2 + molality[j]*molality[k]*psi_ijk_P[n];
-                            /*
-                             * Find the counterIJ for the symmetric binary interaction
-                             */
-                            n = m_kk*j + k;
-                            size_t counterIJ2 = m_CounterIJ[n];
-                            sum4 = sum4 +
-                                   (fabs(charge(i))*
-                                    molality[j]*molality[k]*CMX_P[counterIJ2]);
-                        }
-                    }
                 }
 
                 /*
@@ -4638,21 +3912,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                  */
                 if (charge(j) == 0.0) {
                     sum5 = sum5 + molality[j]*2.0*m_Lambda_nj_P(j,i);
-                    /*
-                     * Zeta interaction term
-                     */
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) > 0.0) {
-                            size_t izeta = j;
-                            size_t jzeta = k;
-                            size_t kzeta = i;
-                            n = izeta * m_kk * m_kk + jzeta * m_kk + kzeta;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum5 = sum5 + molality[j]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
                 }
             }
             m_dlnActCoeffMolaldP_Unscaled[i] =
@@ -4671,20 +3930,9 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
          */
         if (charge(i) == 0.0) {
             double sum1 = 0.0;
-            double sum3 = 0.0;
+            double sum3 = m_PsiSum_k[i];
             for (size_t j = 1; j < m_kk; j++) {
                 sum1 +=  molality[j]*2.0*m_Lambda_nj_P(i,j);
-                /*
-                 * Zeta term -> we piggyback on the psi term
-                 */
-                if (charge(j) > 0.0) {
-                    for (size_t k = 1; k < m_kk; k++) {
-                        if (charge(k) < 0.0) {
-                            size_t n = k + j * m_kk + i * m_kk * m_kk;
-                            sum3 = sum3 + molality[j]*molality[k]*psi_ijk_P[n];
-                        }
-                    }
-                }
             }
             double sum2 = 3.0 * molality[i] * molality[i] * m_Mu_nnn_P[i];
             m_dlnActCoeffMolaldP_Unscaled[i] = sum1 + sum2 + sum3;
@@ -4709,7 +3957,7 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
     double sum4 = 0.0;
     double sum5 = 0.0;
     double sum6 = 0.0;
-    double sum7 = 0.0;
+    double sum7 = psiOsmotic;
     /*
      * term1 is the temperature derivative of the
      * DH term in the osmotic coefficient expression
@@ -4720,81 +3968,26 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
      */
     double term1 = -dAphidP * Is * sqrt(Is) / (1.0 + 1.2 * sqrt(Is));
 
-    for (size_t j = 1; j < m_kk; j++) {
-        /*
-         * Loop Over Cations
-         */
-        if (charge(j) > 0.0) {
-            for (size_t k = 1; k < m_kk; k++) {
-                if (charge(k) < 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum1 = sum1 + molality[j]*molality[k]*
-                           (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
-                }
-            }
-
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == (m_kk-1)) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 1 in Step 9 of hmw_act");
-                }
-                if (charge(k) > 0.0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between 2 cations.
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-                    sum2 = sum2 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) < 0.0) {
-                            // species m is an anion
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum2 = sum2 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
-        }
-
+    for (size_t p = 0; p < m_CationAnionPairs.size(); p++) {
+        size_t i = m_CationAnionPairs[p].first;
+        size_t j = m_CationAnionPairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        sum1 = sum1 + molality[i]*molality[j]*
+               (BphiMX_P[counterIJ] + molarcharge*CMX_P[counterIJ]);
+    }
 
-        /*
-         * Loop Over Anions
-         */
-        if (charge(j) < 0) {
-            for (size_t k = j+1; k < m_kk; k++) {
-                if (j == m_kk-1) {
-                    // we should never reach this step
-                    throw CanteraError("HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP",
-                                       "logic error 2 in Step 9 of hmw_act");
-                }
-                if (charge(k) < 0) {
-                    /*
-                     * Find the counterIJ for the symmetric j,k binary interaction
-                     * between two anions
-                     */
-                    size_t n = m_kk*j + k;
-                    size_t counterIJ = m_CounterIJ[n];
-
-                    sum3 = sum3 + molality[j]*molality[k]*Phiphi_P[counterIJ];
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            n = m + k * m_kk + j * m_kk * m_kk;
-                            sum3 = sum3 +
-                                   molality[j]*molality[k]*molality[m]*psi_ijk_P[n];
-                        }
-                    }
-                }
-            }
+    for (size_t p = 0; p < m_LikeChargePairs.size(); p++) {
+        size_t i = m_LikeChargePairs[p].first;
+        size_t j = m_LikeChargePairs[p].second;
+        size_t counterIJ = m_CounterIJ[m_kk*i + j];
+        if (charge(i) > 0.0) {
+            sum2 = sum2 + molality[i]*molality[j]*Phiphi_P[counterIJ];
+        } else {
+            sum3 = sum3 + molality[i]*molality[j]*Phiphi_P[counterIJ];
         }
+    }
 
+    for (size_t j = 1; j < m_kk; j++) {
         /*
          * Loop Over Neutral Species
          */
@@ -4813,19 +4006,6 @@ void HMWSoln::s_updatePitzer_dlnMolalityActCoeff_dP() const
                         sum6 = sum6 + 0.5 * molality[j]*molality[k]*m_Lambda_nj_P(j,k);
                     }
                 }
-                if (charge(k) < 0.0) {
-                    size_t izeta = j;
-                    for (size_t m = 1; m < m_kk; m++) {
-                        if (charge(m) > 0.0) {
-                            size_t jzeta = m;
-                            size_t n = k + jzeta * m_kk + izeta * m_kk * m_kk;
-                            double zeta_P = psi_ijk_P[n];
-                            if (zeta_P != 0.0) {
-                                sum7 += molality[izeta]*molality[jzeta]*molality[k]*zeta_P;
-                            }
-                        }
-                    }
-                }
             }
 
             sum7 += molality[j] * molality[j] * molality[j] * m_Mu_nnn_P[j];
@@ -1505,6 +1505,12 @@ void HMWSoln::initThermoXML(XML_Node& phaseNode, const std::string& id_)
 
     }
 
+    /*
+     * Now that all of the parameters are known, set up the lists of the
+     * interactions to be evaluated.
+     */
+    initInteractionLists();
+
     /*
      * Fill in the vector specifying the electrolyte species
      * type
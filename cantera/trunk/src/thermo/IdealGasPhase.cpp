@@ -7,6 +7,7 @@
 
 #include "cantera/thermo/IdealGasPhase.h"
 #include "cantera/base/vec_functions.h"
+#include "cantera/base/stringUtils.h"
 
 using namespace std;
 
@@ -56,6 +57,8 @@ IdealGasPhase& IdealGasPhase::operator=(const IdealGasPhase& right)
         m_s0_R = right.m_s0_R;
         m_expg0_RT = right.m_expg0_RT;
         m_pp = right.m_pp;
+        m_mixYw = right.m_mixYw;
+        m_mixCoeffs = right.m_mixCoeffs;
     }
     return *this;
 }
@@ -82,6 +85,67 @@ doublereal IdealGasPhase::cv_mole() const
     return cp_mole() - GasConstant;
 }
 
+void IdealGasPhase::getMassProperties(size_t nStates, const doublereal* T,
+                                      const doublereal* P, const doublereal* Y,
+                                      doublereal* cp, doublereal* h,
+                                      doublereal* s, doublereal* g) const
+{
+    // Number of states for which the species properties are stored at once
+    const size_t chunk = 64;
+    size_t nsp = m_kk;
+    vector_fp cp_R(chunk * nsp), h_RT(chunk * nsp), s_R(chunk * nsp);
+    vector_fp yw(nsp);
+    const vector_fp& mw = molecularWeights();
+    doublereal logPref = std::log(m_spthermo->refPressure());
+    doublereal logP = (P) ? 0.0 : std::log(pressure());
+    const doublereal* y = massFractions();
+    for (size_t i0 = 0; i0 < nStates; i0 += chunk) {
+        size_t n = std::min(chunk, nStates - i0);
+        m_spthermo->updateMany(n, T + i0, nsp, &cp_R[0], &h_RT[0], &s_R[0]);
+        for (size_t i = 0; i < n; i++) {
+            size_t ii = i0 + i;
+            if (Y) {
+                y = Y + ii*nsp;
+            }
+            // Moles of each species per unit mass
+            doublereal sumyw = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                yw[k] = y[k] / mw[k];
+                sumyw += yw[k];
+            }
+            const doublereal* cpi = &cp_R[i*nsp];
+            const doublereal* hi = &h_RT[i*nsp];
+            doublereal cpsum = 0.0, hsum = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                cpsum += yw[k] * cpi[k];
+                hsum += yw[k] * hi[k];
+            }
+            cp[ii] = GasConstant * cpsum;
+            h[ii] = GasConstant * T[ii] * hsum;
+            if (s || g) {
+                const doublereal* si = &s_R[i*nsp];
+                doublereal ssum = 0.0;
+                doublereal logsum = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    ssum += yw[k] * si[k];
+                    logsum += yw[k] * std::log(yw[k] / sumyw + Tiny);
+                }
+                if (P) {
+                    logP = std::log(P[ii]);
+                }
+                doublereal sm = GasConstant * (ssum - logsum
+                                               - sumyw * (logP - logPref));
+                if (s) {
+                    s[ii] = sm;
+                }
+                if (g) {
+                    g[ii] = h[ii] - T[ii] * sm;
+                }
+            }
+        }
+    }
+}
+
 doublereal IdealGasPhase::cv_tr(doublereal atomicity) const
 {
     warn_deprecated("IdealGasPhase::cv_tr", "To be removed after Cantera 2.2.");
@@ -140,6 +204,153 @@ doublereal IdealGasPhase::cv_vib(const int k, const doublereal T) const
 
 }
 
+// Setting the State -----------------------------------------------
+
+void IdealGasPhase::setState_TPX(doublereal t, doublereal p, const doublereal* x)
+{
+    setMoleFractions(x);
+    setTemperature(t);
+    setDensity(p * meanMolecularWeight() / (GasConstant * t));
+}
+
+void IdealGasPhase::setState_TPY(doublereal t, doublereal p, const doublereal* y)
+{
+    setMassFractions(y);
+    setTemperature(t);
+    setDensity(p * meanMolecularWeight() / (GasConstant * t));
+}
+
+void IdealGasPhase::setState_HP(doublereal h, doublereal p, doublereal tol)
+{
+    _updateMixtureCoeffs();
+    doublereal T = temperature();
+    if (p > 0.0 && solveTemperature(h, m_mixYw, m_mixCoeffs, false, T)) {
+        setState_TP(T, p);
+    } else {
+        ThermoPhase::setState_HP(h, p, tol);
+    }
+}
+
+void IdealGasPhase::setState_UV(doublereal u, doublereal v, doublereal tol)
+{
+    _updateMixtureCoeffs();
+    doublereal T = temperature();
+    if (v > 0.0 && solveTemperature(u, m_mixYw, m_mixCoeffs, true, T)) {
+        setTemperature(T);
+        setDensity(1.0 / v);
+    } else {
+        ThermoPhase::setState_UV(u, v, tol);
+    }
+}
+
+void IdealGasPhase::getTemperatures_HY(size_t nStates, const doublereal* h,
+                                       const doublereal* Y,
+                                       doublereal* T) const
+{
+    getTemperatures(nStates, h, Y, false, T);
+}
+
+void IdealGasPhase::getTemperatures_UY(size_t nStates, const doublereal* u,
+                                       const doublereal* Y,
+                                       doublereal* T) const
+{
+    getTemperatures(nStates, u, Y, true, T);
+}
+
+void IdealGasPhase::getTemperatures(size_t nStates, const doublereal* e,
+                                    const doublereal* Y, bool doUV,
+                                    doublereal* T) const
+{
+    const vector_fp& mw = molecularWeights();
+    vector_fp yw, coeffs;
+    if (!Y) {
+        _updateMixtureCoeffs();
+        yw = m_mixYw;
+        coeffs = m_mixCoeffs;
+    }
+    for (size_t i = 0; i < nStates; i++) {
+        if (Y) {
+            yw.resize(m_kk);
+            for (size_t k = 0; k < m_kk; k++) {
+                yw[k] = Y[i*m_kk + k] / mw[k];
+            }
+            if (!m_spthermo->getMixtureCoeffs(&yw[0], coeffs)) {
+                coeffs.clear();
+            }
+        }
+        if (!solveTemperature(e[i], yw, coeffs, doUV, T[i])) {
+            throw CanteraError("IdealGasPhase::getTemperatures",
+                               "No convergence for state " + int2str(i) +
+                               (doUV ? ": u = " : ": h = ") + fp2str(e[i]));
+        }
+    }
+}
+
+bool IdealGasPhase::solveTemperature(doublereal target, const vector_fp& yw,
+                                     const vector_fp& coeffs, bool doUV,
+                                     doublereal& T) const
+{
+    vector_fp cp_R, h_RT, s_R;
+    if (coeffs.empty()) {
+        cp_R.resize(m_kk);
+        h_RT.resize(m_kk);
+        s_R.resize(m_kk);
+    }
+    doublereal sumyw = accumulate(yw.begin(), yw.end(), 0.0);
+
+    // Bounds on the solution, from the sign of the residual at the previous
+    // iterates
+    doublereal Tlo = 0.0;
+    doublereal Thi = BigNumber;
+    doublereal dTold = BigNumber;
+    if (!(T > 0.0 && T < BigNumber)) {
+        T = 300.0;
+    }
+    for (int n = 0; n < 100; n++) {
+        doublereal cpsum, hsum;
+        if (coeffs.empty()) {
+            m_spthermo->update(T, &cp_R[0], &h_RT[0], &s_R[0]);
+            cpsum = dot(yw.begin(), yw.end(), cp_R.begin());
+            hsum = dot(yw.begin(), yw.end(), h_RT.begin());
+        } else {
+            m_spthermo->evalMixture(coeffs, T, cpsum, hsum);
+        }
+        if (doUV) {
+            // u = h - RT/W and cv = cp - R/W
+            cpsum -= sumyw;
+            hsum -= sumyw;
+        }
+        doublereal f = GasConstant * T * hsum - target;
+        doublereal dfdT = GasConstant * cpsum;
+        if (!(dfdT > 0.0)) {
+            return false;
+        } else if (f > 0.0) {
+            Thi = T;
+        } else if (f < 0.0) {
+            Tlo = T;
+        } else {
+            return true;
+        }
+
+        // Newton step, replaced by bisection if it leaves the bounds or if
+        // the steps are not decreasing quickly enough, e.g. near a
+        // discontinuity in the enthalpy at a region boundary
+        doublereal Tnew = T - f / dfdT;
+        if (!(Tnew > Tlo && Tnew < Thi) || fabs(Tnew - T) > 0.5 * dTold) {
+            Tnew = (Thi < BigNumber) ? 0.5 * (Tlo + Thi) : 2.0 * T;
+        }
+        dTold = fabs(Tnew - T);
+        bool converged = (fabs(Tnew - T) <= 1e-12 * T);
+        T = Tnew;
+        if (converged) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Chemical Potentials and Activities -----------------------------
+
 doublereal IdealGasPhase::standardConcentration(size_t k) const
 {
     return pressure() / (GasConstant * temperature());
@@ -367,17 +578,36 @@ void IdealGasPhase::setToEquilState(const doublereal* mu_RT)
     setState_PX(pres, &m_pp[0]);
 }
 
+void IdealGasPhase::_updateMixtureCoeffs() const
+{
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    // The coefficients also depend on the species data, which may be changed
+    // e.g. by modifyOneHf298SS()
+    if (!cached.validate(double(m_spthermo->revision()), stateMFNumber()) ||
+        m_mixYw.size() != m_kk) {
+        m_mixYw.resize(m_kk);
+        const vector_fp& mw = molecularWeights();
+        const doublereal* y = massFractions();
+        for (size_t k = 0; k < m_kk; k++) {
+            m_mixYw[k] = y[k] / mw[k];
+        }
+        if (!m_spthermo->getMixtureCoeffs(&m_mixYw[0], m_mixCoeffs)) {
+            m_mixCoeffs.clear();
+        }
+    }
+}
+
 void IdealGasPhase::_updateThermo() const
 {
     static const int cacheId = m_cache.getId();
     CachedScalar cached = m_cache.getScalar(cacheId);
     doublereal tnow = temperature();
 
-    // If the temperature has changed since the last time these
-    // properties were computed, recompute them.
-    if (cached.state1 != tnow) {
+    // If the temperature or the species data have changed since the last
+    // time these properties were computed, recompute them.
+    if (!cached.validate(tnow, double(m_spthermo->revision()))) {
         m_spthermo->update(tnow, &m_cp0_R[0], &m_h0_RT[0], &m_s0_R[0]);
-        cached.state1 = tnow;
 
         // update the species Gibbs functions
         for (size_t k = 0; k < m_kk; k++) {
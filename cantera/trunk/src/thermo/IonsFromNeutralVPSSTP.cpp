@@ -1018,6 +1018,11 @@ void IonsFromNeutralVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string
 
 void IonsFromNeutralVPSSTP::s_update_lnActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     size_t icat, jNeut;
     /*
      * Get the activity coefficiens of the neutral molecules
@@ -485,6 +485,7 @@ void LatticeSolidPhase::modifyOneHf298SS(const size_t k, const doublereal Hf298N
         }
     }
     m_tlast += 0.0001234;
+    invalidateCache();
     _updateThermo();
 }
 
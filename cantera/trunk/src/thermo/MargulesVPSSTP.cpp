@@ -408,6 +408,11 @@ void MargulesVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string& id_)
 
 void MargulesVPSSTP::s_update_lnActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double T = temperature();
     double invRT = 1.0 / (GasConstant*T);
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
@@ -431,6 +436,11 @@ void MargulesVPSSTP::s_update_lnActCoeff() const
 
 void MargulesVPSSTP::s_update_dlnActCoeff_dT() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     doublereal invT = 1.0 / temperature();
     doublereal invRTT = 1.0 / (GasConstant)*invT*invT;
     dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
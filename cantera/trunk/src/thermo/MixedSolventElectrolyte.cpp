@@ -411,6 +411,11 @@ void MixedSolventElectrolyte::initThermoXML(XML_Node& phaseNode, const std::stri
 
 void MixedSolventElectrolyte::s_update_lnActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     double T = temperature();
     double RT = GasConstant*T;
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
@@ -436,6 +441,11 @@ void MixedSolventElectrolyte::s_update_lnActCoeff() const
 
 void MixedSolventElectrolyte::s_update_dlnActCoeff_dT() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     doublereal T = temperature();
     doublereal RTT = GasConstant*T*T;
     dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
@@ -127,6 +127,7 @@ void MixtureFugacityTP::modifyOneHf298SS(const size_t k, const doublereal Hf298N
 {
     m_spthermo->modifyOneHf298(k, Hf298New);
     m_Tlast_ref += 0.0001234;
+    invalidateCache();
 }
 
 void MixtureFugacityTP::getEntropy_R(doublereal* sr) const
@@ -0,0 +1,424 @@
+/**
+ *  @file PackedNasaPoly.cpp
+ *  Definitions for an evaluator of the NASA polynomials of many species at
+ *  once (see \ref mgrsrefcalc and class
+ *  \link Cantera::PackedNasaPoly PackedNasaPoly\endlink).
+ */
+
+#include "cantera/thermo/PackedNasaPoly.h"
+#include "cantera/base/ctexceptions.h"
+#include "cantera/base/stringUtils.h"
+
+#include <map>
+
+namespace Cantera
+{
+
+namespace {
+
+//! Number of species evaluated together. The results for a block are stored
+//! in local arrays, so that the compiler can vectorize the loops without
+//! checking whether the output arrays overlap the coefficients.
+const size_t BlockSize = 64;
+
+//! Evaluate the 7-coefficient NASA polynomials for *n* species, where
+//! coefficient j of species k is a[j*stride + k].
+void evalNasa7(size_t n, const doublereal* a, size_t stride,
+               const doublereal* tt, doublereal* cp, doublereal* h,
+               doublereal* s)
+{
+    const doublereal* a0 = a;
+    const doublereal* a1 = a0 + stride;
+    const doublereal* a2 = a1 + stride;
+    const doublereal* a3 = a2 + stride;
+    const doublereal* a4 = a3 + stride;
+    const doublereal* a5 = a4 + stride;
+    const doublereal* a6 = a5 + stride;
+    doublereal T = tt[0];
+    doublereal tt1 = tt[1];
+    doublereal tt2 = tt[2];
+    doublereal tt3 = tt[3];
+    doublereal tt4 = tt[4];
+    doublereal logT = tt[6];
+    for (size_t k = 0; k < n; k++) {
+        doublereal ct0 = a0[k];
+        doublereal ct1 = a1[k] * T;
+        doublereal ct2 = a2[k] * tt1;
+        doublereal ct3 = a3[k] * tt2;
+        doublereal ct4 = a4[k] * tt3;
+        cp[k] = ct0 + ct1 + ct2 + ct3 + ct4;
+        h[k] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+               + a5[k]*tt4;
+        s[k] = ct0*logT + ct1 + 0.5*ct2 + 1.0/3.0*ct3
+               + 0.25*ct4 + a6[k];
+    }
+}
+
+//! Evaluate the 9-coefficient NASA polynomials for *n* species, where
+//! coefficient j of species k is a[j*stride + k].
+void evalNasa9(size_t n, const doublereal* a, size_t stride,
+               const doublereal* tt, doublereal* cp, doublereal* h,
+               doublereal* s)
+{
+    const doublereal* a0 = a;
+    const doublereal* a1 = a0 + stride;
+    const doublereal* a2 = a1 + stride;
+    const doublereal* a3 = a2 + stride;
+    const doublereal* a4 = a3 + stride;
+    const doublereal* a5 = a4 + stride;
+    const doublereal* a6 = a5 + stride;
+    const doublereal* a7 = a6 + stride;
+    const doublereal* a8 = a7 + stride;
+    doublereal T = tt[0];
+    doublereal tt1 = tt[1];
+    doublereal tt2 = tt[2];
+    doublereal tt3 = tt[3];
+    doublereal tt4 = tt[4];
+    doublereal tt5 = tt[5];
+    doublereal logT = tt[6];
+    for (size_t k = 0; k < n; k++) {
+        doublereal ct0 = a0[k] * tt5;
+        doublereal ct1 = a1[k] * tt4;
+        doublereal ct2 = a2[k];
+        doublereal ct3 = a3[k] * T;
+        doublereal ct4 = a4[k] * tt1;
+        doublereal ct5 = a5[k] * tt2;
+        doublereal ct6 = a6[k] * tt3;
+        cp[k] = ct0 + ct1 + ct2 + ct3 + ct4 + ct5 + ct6;
+        h[k] = -ct0 + logT*ct1 + ct2 + 0.5*ct3 + 1.0/3.0*ct4
+               + 0.25*ct5 + 0.2*ct6 + a7[k]*tt4;
+        s[k] = -0.5*ct0 - ct1 + logT*ct2 + ct3 + 0.5*ct4
+               + 1.0/3.0*ct5 + 0.25*ct6 + a8[k];
+    }
+}
+
+//! Evaluate the 7-coefficient NASA polynomials of one species at *n*
+//! temperatures, where coefficient j for temperature i is c[j*BlockSize + i]
+//! and the functions of temperature i are tt[j*BlockSize + i].
+void evalNasa7States(size_t n, const doublereal* c, const doublereal* tt,
+                     doublereal* cp, doublereal* h, doublereal* s)
+{
+    for (size_t i = 0; i < n; i++) {
+        doublereal ct0 = c[i];
+        doublereal ct1 = c[BlockSize + i] * tt[i];
+        doublereal ct2 = c[2*BlockSize + i] * tt[BlockSize + i];
+        doublereal ct3 = c[3*BlockSize + i] * tt[2*BlockSize + i];
+        doublereal ct4 = c[4*BlockSize + i] * tt[3*BlockSize + i];
+        cp[i] = ct0 + ct1 + ct2 + ct3 + ct4;
+        h[i] = ct0 + 0.5*ct1 + 1.0/3.0*ct2 + 0.25*ct3 + 0.2*ct4
+               + c[5*BlockSize + i]*tt[4*BlockSize + i];
+        s[i] = ct0*tt[6*BlockSize + i] + ct1 + 0.5*ct2 + 1.0/3.0*ct3
+               + 0.25*ct4 + c[6*BlockSize + i];
+    }
+}
+
+//! Evaluate the 9-coefficient NASA polynomials of one species at *n*
+//! temperatures, with the same layout as evalNasa7States().
+void evalNasa9States(size_t n, const doublereal* c, const doublereal* tt,
+                     doublereal* cp, doublereal* h, doublereal* s)
+{
+    for (size_t i = 0; i < n; i++) {
+        doublereal tt4 = tt[4*BlockSize + i];
+        doublereal logT = tt[6*BlockSize + i];
+        doublereal ct0 = c[i] * tt[5*BlockSize + i];
+        doublereal ct1 = c[BlockSize + i] * tt4;
+        doublereal ct2 = c[2*BlockSize + i];
+        doublereal ct3 = c[3*BlockSize + i] * tt[i];
+        doublereal ct4 = c[4*BlockSize + i] * tt[BlockSize + i];
+        doublereal ct5 = c[5*BlockSize + i] * tt[2*BlockSize + i];
+        doublereal ct6 = c[6*BlockSize + i] * tt[3*BlockSize + i];
+        cp[i] = ct0 + ct1 + ct2 + ct3 + ct4 + ct5 + ct6;
+        h[i] = -ct0 + logT*ct1 + ct2 + 0.5*ct3 + 1.0/3.0*ct4
+               + 0.25*ct5 + 0.2*ct6 + c[7*BlockSize + i]*tt4;
+        s[i] = -0.5*ct0 - ct1 + logT*ct2 + ct3 + 0.5*ct4
+               + 1.0/3.0*ct5 + 0.25*ct6 + c[8*BlockSize + i];
+    }
+}
+
+}
+
+PackedNasaPoly::PackedNasaPoly(size_t nCoeffs) :
+    m_ncoeff(nCoeffs),
+    m_strict(nCoeffs == 7),
+    m_packed(true)
+{
+    if (nCoeffs != 7 && nCoeffs != 9) {
+        throw CanteraError("PackedNasaPoly::PackedNasaPoly",
+                           "Number of coefficients must be 7 or 9, not "
+                           + int2str(nCoeffs));
+    }
+}
+
+void PackedNasaPoly::addSpecies(size_t k, size_t nRegions,
+                                const doublereal* bounds,
+                                const doublereal* coeffs)
+{
+    if (nRegions == 0) {
+        throw CanteraError("PackedNasaPoly::addSpecies",
+                           "Species " + int2str(k) + " has no regions");
+    }
+    m_index.push_back(k);
+    m_spBounds.push_back(vector_fp(bounds, bounds + nRegions - 1));
+    m_spCoeffs.push_back(vector_fp(coeffs, coeffs + nRegions * m_ncoeff));
+    m_packed = false;
+}
+
+void PackedNasaPoly::clear()
+{
+    m_index.clear();
+    m_spBounds.clear();
+    m_spCoeffs.clear();
+    m_packed = false;
+}
+
+void PackedNasaPoly::pack() const
+{
+    // Assign the species to groups, in order of increasing species index
+    std::map<size_t, size_t> order;
+    for (size_t i = 0; i < m_index.size(); i++) {
+        order[m_index[i]] = i;
+    }
+    std::map<vector_fp, size_t> groups;
+    std::vector<std::vector<size_t> > members;
+    m_groupBounds.clear();
+    m_groupIndex.clear();
+    for (std::map<size_t, size_t>::const_iterator iter = order.begin();
+         iter != order.end();
+         iter++) {
+        const vector_fp& bounds = m_spBounds[iter->second];
+        std::map<vector_fp, size_t>::const_iterator loc = groups.find(bounds);
+        size_t g;
+        if (loc == groups.end()) {
+            g = m_groupBounds.size();
+            groups[bounds] = g;
+            m_groupBounds.push_back(bounds);
+            m_groupIndex.push_back(std::vector<size_t>());
+            members.push_back(std::vector<size_t>());
+        } else {
+            g = loc->second;
+        }
+        m_groupIndex[g].push_back(iter->first);
+        members[g].push_back(iter->second);
+    }
+
+    size_t ngroups = m_groupBounds.size();
+    m_groupRuns.assign(ngroups, std::vector<size_t>(1, 0));
+    m_groupCoeffs.resize(ngroups);
+    for (size_t g = 0; g < ngroups; g++) {
+        const std::vector<size_t>& index = m_groupIndex[g];
+        size_t nsp = index.size();
+        size_t ncoeffs = (m_groupBounds[g].size() + 1) * m_ncoeff;
+        for (size_t i = 1; i < nsp; i++) {
+            if (index[i] != index[i-1] + 1) {
+                m_groupRuns[g].push_back(i);
+            }
+        }
+        m_groupRuns[g].push_back(nsp);
+        vector_fp& c = m_groupCoeffs[g];
+        c.resize(ncoeffs * nsp);
+        for (size_t i = 0; i < nsp; i++) {
+            const vector_fp& spc = m_spCoeffs[members[g][i]];
+            for (size_t j = 0; j < ncoeffs; j++) {
+                c[j*nsp + i] = spc[j];
+            }
+        }
+    }
+    m_packed = true;
+}
+
+void PackedNasaPoly::update(doublereal T, doublereal* cp_R, doublereal* h_RT,
+                            doublereal* s_R) const
+{
+    if (m_index.empty()) {
+        return;
+    }
+    if (!m_packed) {
+        pack();
+    }
+
+    // Functions of T, computed as in the single-species classes so that the
+    // results are identical
+    doublereal tt[7];
+    tt[0] = T;
+    tt[1] = T * T;
+    tt[2] = tt[1] * T;
+    tt[3] = tt[2] * T;
+    tt[4] = 1.0 / T;
+    tt[5] = tt[4] / T;
+    tt[6] = std::log(T);
+
+    doublereal cp[BlockSize], h[BlockSize], s[BlockSize];
+    for (size_t g = 0; g < m_groupBounds.size(); g++) {
+        // Find the region containing T
+        const vector_fp& bounds = m_groupBounds[g];
+        size_t r = 0;
+        while (r < bounds.size() &&
+               (m_strict ? T > bounds[r] : T >= bounds[r])) {
+            r++;
+        }
+
+        const std::vector<size_t>& index = m_groupIndex[g];
+        const std::vector<size_t>& runs = m_groupRuns[g];
+        size_t nsp = index.size();
+        const doublereal* a = &m_groupCoeffs[g][r * m_ncoeff * nsp];
+        size_t run = 0;
+        for (size_t k0 = 0; k0 < nsp; k0 += BlockSize) {
+            size_t k1 = std::min(k0 + BlockSize, nsp);
+            if (m_ncoeff == 7) {
+                evalNasa7(k1 - k0, a + k0, nsp, tt, cp, h, s);
+            } else {
+                evalNasa9(k1 - k0, a + k0, nsp, tt, cp, h, s);
+            }
+            // Copy each run of consecutive species indices in this block
+            for (size_t i = k0; i < k1; ) {
+                while (runs[run + 1] <= i) {
+                    run++;
+                }
+                size_t iend = std::min(runs[run + 1], k1);
+                std::copy(cp + i - k0, cp + iend - k0, cp_R + index[i]);
+                std::copy(h + i - k0, h + iend - k0, h_RT + index[i]);
+                std::copy(s + i - k0, s + iend - k0, s_R + index[i]);
+                i = iend;
+            }
+        }
+    }
+}
+
+void PackedNasaPoly::updateMany(size_t nStates, const doublereal* T,
+                                size_t ld, doublereal* cp_R,
+                                doublereal* h_RT, doublereal* s_R) const
+{
+    if (m_index.empty()) {
+        return;
+    }
+    if (!m_packed) {
+        pack();
+    }
+
+    doublereal tt[7*BlockSize];
+    doublereal c[9*BlockSize];
+    doublereal cp[BlockSize], h[BlockSize], s[BlockSize];
+    for (size_t i0 = 0; i0 < nStates; i0 += BlockSize) {
+        size_t n = std::min(BlockSize, nStates - i0);
+        const doublereal* Tb = T + i0;
+        for (size_t i = 0; i < n; i++) {
+            tt[i] = Tb[i];
+            tt[BlockSize + i] = Tb[i] * Tb[i];
+            tt[2*BlockSize + i] = tt[BlockSize + i] * Tb[i];
+            tt[3*BlockSize + i] = tt[2*BlockSize + i] * Tb[i];
+            tt[4*BlockSize + i] = 1.0 / Tb[i];
+            tt[5*BlockSize + i] = tt[4*BlockSize + i] / Tb[i];
+            tt[6*BlockSize + i] = std::log(Tb[i]);
+        }
+
+        for (size_t g = 0; g < m_groupBounds.size(); g++) {
+            const vector_fp& bounds = m_groupBounds[g];
+            const std::vector<size_t>& index = m_groupIndex[g];
+            size_t nsp = index.size();
+            const doublereal* a = &m_groupCoeffs[g][0];
+            for (size_t k = 0; k < nsp; k++) {
+                // Select the coefficients of the region containing each
+                // temperature
+                for (size_t j = 0; j < m_ncoeff; j++) {
+                    doublereal a0 = a[j*nsp + k];
+                    for (size_t i = 0; i < n; i++) {
+                        c[j*BlockSize + i] = a0;
+                    }
+                }
+                for (size_t r = 0; r < bounds.size(); r++) {
+                    doublereal Tb0 = bounds[r];
+                    for (size_t j = 0; j < m_ncoeff; j++) {
+                        doublereal ar = a[((r+1)*m_ncoeff + j)*nsp + k];
+                        doublereal* cj = c + j*BlockSize;
+                        if (m_strict) {
+                            for (size_t i = 0; i < n; i++) {
+                                cj[i] = (Tb[i] > Tb0) ? ar : cj[i];
+                            }
+                        } else {
+                            for (size_t i = 0; i < n; i++) {
+                                cj[i] = (Tb[i] >= Tb0) ? ar : cj[i];
+                            }
+                        }
+                    }
+                }
+
+                if (m_ncoeff == 7) {
+                    evalNasa7States(n, c, tt, cp, h, s);
+                } else {
+                    evalNasa9States(n, c, tt, cp, h, s);
+                }
+                size_t loc = i0*ld + index[k];
+                for (size_t i = 0; i < n; i++) {
+                    cp_R[loc + i*ld] = cp[i];
+                    h_RT[loc + i*ld] = h[i];
+                    s_R[loc + i*ld] = s[i];
+                }
+            }
+        }
+    }
+}
+
+size_t PackedNasaPoly::nMixtureCoeffs() const
+{
+    if (!m_packed) {
+        pack();
+    }
+    size_t n = 0;
+    for (size_t g = 0; g < m_groupBounds.size(); g++) {
+        n += (m_groupBounds[g].size() + 1) * m_ncoeff;
+    }
+    return n;
+}
+
+void PackedNasaPoly::getMixtureCoeffs(const doublereal* x,
+                                      doublereal* coeffs) const
+{
+    if (!m_packed) {
+        pack();
+    }
+    doublereal* c = coeffs;
+    for (size_t g = 0; g < m_groupBounds.size(); g++) {
+        const std::vector<size_t>& index = m_groupIndex[g];
+        size_t nsp = index.size();
+        size_t ncoeffs = (m_groupBounds[g].size() + 1) * m_ncoeff;
+        const doublereal* a = &m_groupCoeffs[g][0];
+        for (size_t j = 0; j < ncoeffs; j++) {
+            doublereal sum = 0.0;
+            for (size_t i = 0; i < nsp; i++) {
+                sum += x[index[i]] * a[j*nsp + i];
+            }
+            c[j] = sum;
+        }
+        c += ncoeffs;
+    }
+}
+
+void PackedNasaPoly::evalMixture(const doublereal* coeffs, doublereal T,
+                                 doublereal& cp_R, doublereal& h_RT) const
+{
+    const doublereal* c = coeffs;
+    for (size_t g = 0; g < m_groupBounds.size(); g++) {
+        const vector_fp& bounds = m_groupBounds[g];
+        size_t r = 0;
+        while (r < bounds.size() &&
+               (m_strict ? T > bounds[r] : T >= bounds[r])) {
+            r++;
+        }
+        const doublereal* a = c + r * m_ncoeff;
+        if (m_ncoeff == 7) {
+            cp_R += a[0] + T*(a[1] + T*(a[2] + T*(a[3] + T*a[4])));
+            h_RT += a[0] + T*(0.5*a[1] + T*(1.0/3.0*a[2] + T*(0.25*a[3]
+                    + T*0.2*a[4]))) + a[5]/T;
+        } else {
+            doublereal rt = 1.0 / T;
+            cp_R += rt*(rt*a[0] + a[1]) + a[2]
+                    + T*(a[3] + T*(a[4] + T*(a[5] + T*a[6])));
+            h_RT += rt*(-rt*a[0] + std::log(T)*a[1] + a[7]) + a[2]
+                    + T*(0.5*a[3] + T*(1.0/3.0*a[4] + T*(0.25*a[5]
+                    + T*0.2*a[6])));
+        }
+        c += (bounds.size() + 1) * m_ncoeff;
+    }
+}
+
+}
@@ -0,0 +1,1107 @@
+/**
+ *  @file PengRobinsonMFTP.cpp
+ * Definition file for a derived class of ThermoPhase that implements the
+ * Peng-Robinson equation of state for a mixture of real fluids (see \ref
+ * thermoprops and class \link Cantera::PengRobinsonMFTP PengRobinsonMFTP\endlink).
+ */
+
+#include "cantera/thermo/PengRobinsonMFTP.h"
+
+#include "cantera/thermo/mix_defs.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/base/stringUtils.h"
+#include "cantera/base/ctml.h"
+
+using namespace std;
+
+namespace Cantera
+{
+
+const doublereal PengRobinsonMFTP::omega_a = 4.5723552892138218E-01;
+const doublereal PengRobinsonMFTP::omega_b = 7.7796073903888455E-02;
+const doublereal PengRobinsonMFTP::omega_vc = 3.0740130869870386E-01;
+
+//! sqrt(2)
+static const doublereal Sqrt2 = 1.4142135623730951;
+
+//! Real cube root
+static inline doublereal cubeRoot(doublereal x)
+{
+    return (x < 0.0) ? -pow(-x, 1.0/3.0) : pow(x, 1.0/3.0);
+}
+
+//! The logarithmic term of the departure functions,
+//! log((V + (1+sqrt(2))b) / (V + (1-sqrt(2))b))
+static inline doublereal logTerm(doublereal V, doublereal b)
+{
+    return log((V + (1.0 + Sqrt2) * b) / (V + (1.0 - Sqrt2) * b));
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP() :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_mixTemp(-1.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(const std::string& infile, std::string id_) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_mixTemp(-1.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+    XML_Node* root = get_XML_File(infile);
+    if (id_ == "-") {
+        id_ = "";
+    }
+    XML_Node* xphase = get_XML_NameID("phase", std::string("#")+id_, root);
+    if (!xphase) {
+        throw CanteraError("newPhase",
+                           "Couldn't find phase named \"" + id_ + "\" in file, " + infile);
+    }
+    importPhase(*xphase, this);
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(XML_Node& phaseRefRoot, const std::string& id_) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_mixTemp(-1.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    Vroot_[0] = 0.0;
+    Vroot_[1] = 0.0;
+    Vroot_[2] = 0.0;
+    XML_Node* xphase = get_XML_NameID("phase", std::string("#")+id_, &phaseRefRoot);
+    if (!xphase) {
+        throw CanteraError("PengRobinsonMFTP::PengRobinsonMFTP()",
+                           "Couldn't find phase named \"" + id_ + "\" in XML node");
+    }
+    importPhase(*xphase, this);
+}
+
+PengRobinsonMFTP::PengRobinsonMFTP(const PengRobinsonMFTP& b) :
+    m_b_current(0.0),
+    m_a_current(0.0),
+    m_mixTemp(-1.0),
+    m_dadt_current(0.0),
+    m_d2adt2_current(0.0),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
+    NSolns_(0),
+    dpdV_(0.0),
+    dpdT_(0.0)
+{
+    *this = b;
+}
+
+PengRobinsonMFTP& PengRobinsonMFTP::operator=(const PengRobinsonMFTP& b)
+{
+    if (&b != this) {
+        MixtureFugacityTP::operator=(b);
+        m_b_current = b.m_b_current;
+        m_a_current = b.m_a_current;
+        m_tc_Species = b.m_tc_Species;
+        m_pc_Species = b.m_pc_Species;
+        m_omega_Species = b.m_omega_Species;
+        m_kappa = b.m_kappa;
+        m_b_Species = b.m_b_Species;
+        m_sqrtAlpha0 = b.m_sqrtAlpha0;
+        m_sqrtAlpha1 = b.m_sqrtAlpha1;
+        m_pairI = b.m_pairI;
+        m_pairJ = b.m_pairJ;
+        m_pairKij = b.m_pairKij;
+        m_mixTemp = b.m_mixTemp;
+        m_mixMoleFractions = b.m_mixMoleFractions;
+        m_dadt_current = b.m_dadt_current;
+        m_d2adt2_current = b.m_d2adt2_current;
+        m_sqrtAlpha = b.m_sqrtAlpha;
+        m_dsqrtAlpha = b.m_dsqrtAlpha;
+        m_critMoleFractions = b.m_critMoleFractions;
+        m_tc_mix = b.m_tc_mix;
+        m_pc_mix = b.m_pc_mix;
+        m_vc_mix = b.m_vc_mix;
+        NSolns_ = b.NSolns_;
+        Vroot_[0] = b.Vroot_[0];
+        Vroot_[1] = b.Vroot_[1];
+        Vroot_[2] = b.Vroot_[2];
+        m_pp = b.m_pp;
+        m_tmpV = b.m_tmpV;
+        m_partialMolarVolumes = b.m_partialMolarVolumes;
+        dpdV_ = b.dpdV_;
+        dpdT_ = b.dpdT_;
+        dpdni_ = b.dpdni_;
+    }
+    return *this;
+}
+
+ThermoPhase* PengRobinsonMFTP::duplMyselfAsThermoPhase() const
+{
+    return new PengRobinsonMFTP(*this);
+}
+
+int PengRobinsonMFTP::eosType() const
+{
+    return cPengRobinsonMFTP;
+}
+
+/*
+ * ------------Molar Thermodynamic Properties -------------------------
+ */
+
+doublereal PengRobinsonMFTP::enthalpy_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal h_ideal = _RT() * mean_X(m_h0_RT);
+    doublereal h_nonideal = hresid();
+    return h_ideal + h_nonideal;
+}
+
+doublereal PengRobinsonMFTP::entropy_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal sr_ideal =  GasConstant * (mean_X(m_s0_R)
+                                          - sum_xlogx() - std::log(pressure()/m_spthermo->refPressure()));
+    doublereal sr_nonideal = sresid();
+    return sr_ideal + sr_nonideal;
+}
+
+doublereal PengRobinsonMFTP::cp_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal TKelvin = temperature();
+    doublereal mv = molarVolume();
+    pressureDerivatives();
+    doublereal cvres = TKelvin * d2a_dt2() * logTerm(mv, m_b_current)
+                       / (2.0 * Sqrt2 * m_b_current);
+    return GasConstant * mean_X(m_cp0_R) + cvres
+           - TKelvin * dpdT_ * dpdT_ / dpdV_ - GasConstant;
+}
+
+doublereal PengRobinsonMFTP::cv_mole() const
+{
+    _updateReferenceStateThermo();
+    doublereal TKelvin = temperature();
+    doublereal mv = molarVolume();
+    doublereal cvres = TKelvin * d2a_dt2() * logTerm(mv, m_b_current)
+                       / (2.0 * Sqrt2 * m_b_current);
+    return GasConstant * (mean_X(m_cp0_R) - 1.0) + cvres;
+}
+
+void PengRobinsonMFTP::getMassProperties(size_t nStates, const doublereal* T,
+        const doublereal* P, const doublereal* Y, doublereal* rho,
+        doublereal* cp, doublereal* h, doublereal* s) const
+{
+    // Number of states for which the species properties are stored at once
+    const size_t chunk = 64;
+    size_t nsp = m_kk;
+    vector_fp cp_R(chunk * nsp), h_RT(chunk * nsp), s_R(chunk * nsp);
+    const vector_fp& mw = molecularWeights();
+    doublereal logPref = log(refPressure());
+
+    vector_fp x(moleFractions_);
+    doublereal b = dot(x.begin(), x.end(), m_b_Species.begin());
+    doublereal mmw = meanMolecularWeight();
+    doublereal pres = pressure();
+    doublereal a, dadt, d2adt2;
+    double Vroot[3];
+
+    for (size_t i0 = 0; i0 < nStates; i0 += chunk) {
+        size_t n = std::min(chunk, nStates - i0);
+        m_spthermo->updateMany(n, T + i0, nsp, &cp_R[0], &h_RT[0], &s_R[0]);
+        for (size_t i = 0; i < n; i++) {
+            size_t ii = i0 + i;
+            if (Y) {
+                const doublereal* y = Y + ii*nsp;
+                doublereal sumyw = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    x[k] = y[k] / mw[k];
+                    sumyw += x[k];
+                }
+                mmw = 1.0 / sumyw;
+                b = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    x[k] *= mmw;
+                    b += x[k] * m_b_Species[k];
+                }
+            }
+            if (P) {
+                pres = P[ii];
+            }
+            doublereal TKelvin = T[ii];
+            doublereal RT = GasConstant * TKelvin;
+            mixtureA(TKelvin, &x[0], a, dadt, d2adt2);
+
+            // Choose the root with the lower Gibbs function, using the
+            // fugacity coefficient of the mixture
+            int nsol = cubicSolve(TKelvin, pres, a, b, Vroot);
+            if (nsol == 0) {
+                throw CanteraError("PengRobinsonMFTP::getMassProperties",
+                                   "no solution of the equation of state at T = "
+                                   + fp2str(TKelvin) + ", P = " + fp2str(pres));
+            }
+            doublereal V = Vroot[0];
+            if (nsol > 1) {
+                doublereal lnphiMin = 0.0;
+                for (int iv = 0; iv < nsol; iv += nsol - 1) {
+                    doublereal Vi = Vroot[iv];
+                    doublereal lnphi = pres * Vi / RT - 1.0 - log(pres * (Vi - b) / RT)
+                        - a / (2.0 * Sqrt2 * b * RT) * logTerm(Vi, b);
+                    if (iv == 0 || lnphi < lnphiMin) {
+                        lnphiMin = lnphi;
+                        V = Vi;
+                    }
+                }
+            }
+
+            doublereal hres, sres, cpres;
+            residualProperties(TKelvin, pres, V, a, dadt, d2adt2, b, hres, sres, cpres);
+            const doublereal* cpi = &cp_R[i*nsp];
+            const doublereal* hi = &h_RT[i*nsp];
+            doublereal cpsum = 0.0, hsum = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                cpsum += x[k] * cpi[k];
+                hsum += x[k] * hi[k];
+            }
+            rho[ii] = mmw / V;
+            cp[ii] = (GasConstant * cpsum + cpres) / mmw;
+            h[ii] = (RT * hsum + hres) / mmw;
+            if (s) {
+                const doublereal* si = &s_R[i*nsp];
+                doublereal ssum = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    ssum += x[k] * (si[k] - log(x[k] + Tiny));
+                }
+                s[ii] = (GasConstant * (ssum - (log(pres) - logPref)) + sres) / mmw;
+            }
+        }
+    }
+}
+
+doublereal PengRobinsonMFTP::pressure() const
+{
+    return m_Pcurrent;
+}
+
+void PengRobinsonMFTP::setTemperature(const doublereal temp)
+{
+    Phase::setTemperature(temp);
+    _updateReferenceStateThermo();
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMassFractions(const doublereal* const y)
+{
+    MixtureFugacityTP::setMassFractions(y);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMassFractions_NoNorm(const doublereal* const y)
+{
+    MixtureFugacityTP::setMassFractions_NoNorm(y);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMoleFractions(const doublereal* const x)
+{
+    MixtureFugacityTP::setMoleFractions(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setMoleFractions_NoNorm(const doublereal* const x)
+{
+    MixtureFugacityTP::setMoleFractions_NoNorm(x);
+    updateAB();
+}
+
+void PengRobinsonMFTP::setConcentrations(const doublereal* const c)
+{
+    MixtureFugacityTP::setConcentrations(c);
+    updateAB();
+}
+
+void PengRobinsonMFTP::getActivityConcentrations(doublereal* c) const
+{
+    getPartialMolarVolumes(DATA_PTR(m_partialMolarVolumes));
+    for (size_t k = 0; k < m_kk; k++) {
+        c[k] = moleFraction(k) / m_partialMolarVolumes[k];
+    }
+}
+
+doublereal PengRobinsonMFTP::standardConcentration(size_t k) const
+{
+    getStandardVolumes(DATA_PTR(m_tmpV));
+    return 1.0 / m_tmpV[k];
+}
+
+void PengRobinsonMFTP::getUnitsStandardConc(double* uA, int, int sizeUA) const
+{
+    for (int i = 0; i < sizeUA; i++) {
+        uA[i] = 0.0;
+    }
+    if (sizeUA > 0) {
+        uA[0] = 1.0;
+    }
+    if (sizeUA > 1) {
+        uA[1] = -static_cast<int>(nDim());
+    }
+}
+
+void PengRobinsonMFTP::getActivityCoefficients(doublereal* ac) const
+{
+    doublereal rt = GasConstant * temperature();
+    doublereal mv = molarVolume();
+    doublereal pres = pressure();
+    doublereal b = m_b_current;
+    doublereal zz = pres * mv / rt;
+    doublereal lnzb = log(pres * (mv - b) / rt);
+    doublereal fac = m_a_current / (2.0 * Sqrt2 * b * rt) * logTerm(mv, b);
+
+    speciesMixingTerms(DATA_PTR(m_pp));
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal bRatio = m_b_Species[k] / b;
+        ac[k] = exp(bRatio * (zz - 1.0) - lnzb
+                    - fac * (2.0 * m_pp[k] / m_a_current - bRatio));
+    }
+}
+
+/*
+ * ---- Partial Molar Properties of the Solution -----------------
+ */
+
+void PengRobinsonMFTP::getChemPotentials_RT(doublereal* muRT) const
+{
+    getChemPotentials(muRT);
+    doublereal invRT = 1.0 / _RT();
+    for (size_t k = 0; k < m_kk; k++) {
+        muRT[k] *= invRT;
+    }
+}
+
+void PengRobinsonMFTP::getChemPotentials(doublereal* mu) const
+{
+    getGibbs_ref(mu);
+    doublereal rt = GasConstant * temperature();
+    getActivityCoefficients(DATA_PTR(m_tmpV));
+    doublereal logP = log(pressure() / refPressure());
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal xx = std::max(SmallNumber, moleFraction(k));
+        mu[k] += rt * (log(xx) + logP + log(m_tmpV[k]));
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarEnthalpies(doublereal* hbar) const
+{
+    // Reference state contributions
+    getEnthalpy_RT_ref(hbar);
+    doublereal TKelvin = temperature();
+    doublereal rt = GasConstant * TKelvin;
+    scale(hbar, hbar+m_kk, hbar, rt);
+
+    doublereal mv = molarVolume();
+    doublereal a = m_a_current;
+    doublereal b = m_b_current;
+    doublereal dadt = da_dt();
+    doublereal vmb = mv - b;
+    doublereal D = mv * mv + 2.0 * b * mv - b * b;
+    doublereal L = logTerm(mv, b) / (2.0 * Sqrt2 * b);
+    doublereal fac = TKelvin * dadt - a;
+
+    speciesMixingTerms(DATA_PTR(m_pp), DATA_PTR(m_tmpV));
+    pressureDerivatives();
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal bk = m_b_Species[k];
+        dpdni_[k] = rt / vmb + rt * bk / (vmb * vmb) - 2.0 * m_pp[k] / D
+                    + 2.0 * a * bk * vmb / (D * D);
+        // Derivative of the residual internal energy with respect to the
+        // number of moles of species k, at constant T and total volume
+        doublereal dUres = L * (2.0 * (TKelvin * m_tmpV[k] - m_pp[k]) - fac * bk / b)
+                           + fac * bk * mv / (b * D);
+        hbar[k] += dUres - rt - TKelvin * dpdT_ * dpdni_[k] / dpdV_;
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarEntropies(doublereal* sbar) const
+{
+    getPartialMolarEnthalpies(sbar);
+    vector_fp mu(m_kk);
+    getChemPotentials(DATA_PTR(mu));
+    doublereal invT = 1.0 / temperature();
+    for (size_t k = 0; k < m_kk; k++) {
+        sbar[k] = (sbar[k] - mu[k]) * invT;
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarIntEnergies(doublereal* ubar) const
+{
+    getPartialMolarEnthalpies(ubar);
+    getPartialMolarVolumes(DATA_PTR(m_partialMolarVolumes));
+    doublereal pres = pressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        ubar[k] -= pres * m_partialMolarVolumes[k];
+    }
+}
+
+void PengRobinsonMFTP::getPartialMolarCp(doublereal* cpbar) const
+{
+    getCp_R(cpbar);
+    scale(cpbar, cpbar+m_kk, cpbar, GasConstant);
+}
+
+void PengRobinsonMFTP::getPartialMolarVolumes(doublereal* vbar) const
+{
+    doublereal rt = GasConstant * temperature();
+    doublereal mv = molarVolume();
+    doublereal a = m_a_current;
+    doublereal b = m_b_current;
+    doublereal vmb = mv - b;
+    doublereal D = mv * mv + 2.0 * b * mv - b * b;
+    doublereal pres;
+    doublereal dpdV = dpdVCalc(temperature(), mv, pres);
+
+    speciesMixingTerms(DATA_PTR(m_pp));
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal bk = m_b_Species[k];
+        doublereal dpdn = rt / vmb + rt * bk / (vmb * vmb) - 2.0 * m_pp[k] / D
+                          + 2.0 * a * bk * vmb / (D * D);
+        vbar[k] = - dpdn / dpdV;
+    }
+}
+
+doublereal PengRobinsonMFTP::critTemperature() const
+{
+    updateCriticalConditions();
+    return m_tc_mix;
+}
+
+doublereal PengRobinsonMFTP::critPressure() const
+{
+    updateCriticalConditions();
+    return m_pc_mix;
+}
+
+doublereal PengRobinsonMFTP::critVolume() const
+{
+    updateCriticalConditions();
+    return m_vc_mix;
+}
+
+doublereal PengRobinsonMFTP::critCompressibility() const
+{
+    return omega_vc;
+}
+
+doublereal PengRobinsonMFTP::critDensity() const
+{
+    updateCriticalConditions();
+    return meanMolecularWeight() / m_vc_mix;
+}
+
+void PengRobinsonMFTP::setParametersFromXML(const XML_Node& thermoNode)
+{
+    MixtureFugacityTP::setParametersFromXML(thermoNode);
+}
+
+void PengRobinsonMFTP::initThermo()
+{
+    initLengths();
+    MixtureFugacityTP::initThermo();
+}
+
+void PengRobinsonMFTP::setToEquilState(const doublereal* mu_RT)
+{
+    double tmp, tmp2;
+    _updateReferenceStateThermo();
+    getGibbs_RT_ref(DATA_PTR(m_tmpV));
+
+    /*
+     * Within the method, we protect against inf results if the
+     * exponent is too high.
+     *
+     * If it is too low, we set the partial pressure to zero. This capability
+     * is needed by the elemental potential method.
+     */
+    doublereal pres = 0.0;
+    double m_p0 = refPressure();
+    for (size_t k = 0; k < m_kk; k++) {
+        tmp = -m_tmpV[k] + mu_RT[k];
+        if (tmp < -600.) {
+            m_pp[k] = 0.0;
+        } else if (tmp > 500.0) {
+            tmp2 = tmp / 500.;
+            tmp2 *= tmp2;
+            m_pp[k] = m_p0 * exp(500.) * tmp2;
+        } else {
+            m_pp[k] = m_p0 * exp(tmp);
+        }
+        pres += m_pp[k];
+    }
+    // set state
+    setState_PX(pres, &m_pp[0]);
+}
+
+void PengRobinsonMFTP::initLengths()
+{
+    m_tc_Species.resize(m_kk, 0.0);
+    m_pc_Species.resize(m_kk, 0.0);
+    m_omega_Species.resize(m_kk, 0.0);
+    m_kappa.resize(m_kk, 0.0);
+    m_b_Species.resize(m_kk, 0.0);
+    m_sqrtAlpha0.resize(m_kk, 0.0);
+    m_sqrtAlpha1.resize(m_kk, 0.0);
+    m_sqrtAlpha.resize(m_kk, 0.0);
+    m_dsqrtAlpha.resize(m_kk, 0.0);
+
+    m_pp.resize(m_kk, 0.0);
+    m_tmpV.resize(m_kk, 0.0);
+    m_partialMolarVolumes.resize(m_kk, 0.0);
+    dpdni_.resize(m_kk, 0.0);
+}
+
+void PengRobinsonMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
+{
+    PengRobinsonMFTP::initLengths();
+
+    if (phaseNode.hasChild("thermo")) {
+        XML_Node& thermoNode = phaseNode.child("thermo");
+        std::string model = thermoNode["model"];
+        if (model != "PengRobinson" && model != "PengRobinsonMFTP") {
+            throw CanteraError("PengRobinsonMFTP::initThermoXML",
+                               "Unknown thermo model : " + model);
+        }
+
+        if (thermoNode.hasChild("activityCoefficients")) {
+            XML_Node& acNode = thermoNode.child("activityCoefficients");
+            for (size_t i = 0; i < acNode.nChildren(); i++) {
+                XML_Node& xmlACChild = acNode.child(i);
+                string nodeName = lowercase(xmlACChild.name());
+                if (nodeName == "purefluidparameters") {
+                    readXMLPureFluid(xmlACChild);
+                } else if (nodeName == "crossfluidparameters") {
+                    readXMLCrossFluid(xmlACChild);
+                }
+            }
+        }
+    }
+
+    calcSpeciesParameters();
+    MixtureFugacityTP::initThermoXML(phaseNode, id);
+}
+
+void PengRobinsonMFTP::readXMLPureFluid(XML_Node& pureFluidParam)
+{
+    string iName = pureFluidParam.attrib("species");
+    if (iName == "") {
+        throw CanteraError("PengRobinsonMFTP::readXMLPureFluid", "no species attribute");
+    }
+    // It's not an error for the species not to be in the phase
+    size_t iSpecies = speciesIndex(iName);
+    if (iSpecies == npos) {
+        return;
+    }
+    m_tc_Species[iSpecies] = ctml::getFloat(pureFluidParam, "Tc", "temperature");
+    m_pc_Species[iSpecies] = ctml::getFloat(pureFluidParam, "Pc", "pressure");
+    m_omega_Species[iSpecies] = ctml::getFloat(pureFluidParam, "acentric_factor");
+}
+
+void PengRobinsonMFTP::readXMLCrossFluid(XML_Node& crossFluidParam)
+{
+    string iName = crossFluidParam.attrib("species1");
+    string jName = crossFluidParam.attrib("species2");
+    if (iName == "" || jName == "") {
+        throw CanteraError("PengRobinsonMFTP::readXMLCrossFluid",
+                           "missing species1 or species2 attribute");
+    }
+    size_t iSpecies = speciesIndex(iName);
+    size_t jSpecies = speciesIndex(jName);
+    if (iSpecies == npos || jSpecies == npos) {
+        return;
+    }
+    setBinaryInteraction(iSpecies, jSpecies, ctml::getFloat(crossFluidParam, "k_ij"));
+}
+
+void PengRobinsonMFTP::setBinaryInteraction(size_t i, size_t j, doublereal kij)
+{
+    if (i >= m_kk || j >= m_kk || i == j) {
+        throw CanteraError("PengRobinsonMFTP::setBinaryInteraction",
+                           "invalid pair of species: " + int2str(i) + ", " + int2str(j));
+    }
+    if (i > j) {
+        std::swap(i, j);
+    }
+    size_t n = 0;
+    while (n < m_pairKij.size() && (m_pairI[n] != i || m_pairJ[n] != j)) {
+        n++;
+    }
+    if (n == m_pairKij.size()) {
+        if (kij == 0.0) {
+            return;
+        }
+        m_pairI.push_back(i);
+        m_pairJ.push_back(j);
+        m_pairKij.push_back(kij);
+    } else if (kij == 0.0) {
+        m_pairI.erase(m_pairI.begin() + n);
+        m_pairJ.erase(m_pairJ.begin() + n);
+        m_pairKij.erase(m_pairKij.begin() + n);
+    } else {
+        m_pairKij[n] = kij;
+    }
+    m_mixTemp = -1.0;
+    m_critMoleFractions.clear();
+}
+
+void PengRobinsonMFTP::calcSpeciesParameters()
+{
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal tc = m_tc_Species[k];
+        doublereal pc = m_pc_Species[k];
+        if (tc <= 0.0 || pc <= 0.0) {
+            throw CanteraError("PengRobinsonMFTP::calcSpeciesParameters",
+                               "missing or invalid critical properties for species "
+                               + speciesName(k));
+        }
+        doublereal w = m_omega_Species[k];
+        if (w <= 0.491) {
+            m_kappa[k] = 0.37464 + 1.54226 * w - 0.26992 * w * w;
+        } else {
+            m_kappa[k] = 0.379642 + 1.48503 * w - 0.164423 * w * w + 0.016666 * w * w * w;
+        }
+        doublereal sqrta = sqrt(omega_a / pc) * GasConstant * tc;
+        m_b_Species[k] = omega_b * GasConstant * tc / pc;
+        // sqrt(a_k alpha_k) = sqrt(a_k) (1 + kappa_k (1 - sqrt(T/Tc_k)))
+        m_sqrtAlpha0[k] = sqrta * (1.0 + m_kappa[k]);
+        m_sqrtAlpha1[k] = - sqrta * m_kappa[k] / sqrt(tc);
+    }
+    m_mixTemp = -1.0;
+    m_mixMoleFractions.clear();
+    m_critMoleFractions.clear();
+}
+
+doublereal PengRobinsonMFTP::sresid() const
+{
+    doublereal T = temperature();
+    doublereal mv = molarVolume();
+    doublereal b = m_b_current;
+    return GasConstant * log(pressure() * (mv - b) / (GasConstant * T))
+           + da_dt() * logTerm(mv, b) / (2.0 * Sqrt2 * b);
+}
+
+doublereal PengRobinsonMFTP::hresid() const
+{
+    doublereal T = temperature();
+    doublereal mv = molarVolume();
+    doublereal b = m_b_current;
+    return pressure() * mv - GasConstant * T
+           + (T * da_dt() - m_a_current) * logTerm(mv, b) / (2.0 * Sqrt2 * b);
+}
+
+void PengRobinsonMFTP::residualProperties(doublereal T, doublereal P,
+        doublereal V, doublereal a, doublereal dadt, doublereal d2adt2,
+        doublereal b, doublereal& hres, doublereal& sres, doublereal& cpres) const
+{
+    doublereal RT = GasConstant * T;
+    doublereal L = logTerm(V, b) / (2.0 * Sqrt2 * b);
+    hres = P * V - RT + (T * dadt - a) * L;
+    sres = GasConstant * log(P * (V - b) / RT) + dadt * L;
+
+    doublereal vmb = V - b;
+    doublereal D = V * V + 2.0 * b * V - b * b;
+    doublereal dpdV = - RT / (vmb * vmb) + 2.0 * a * (V + b) / (D * D);
+    doublereal dpdT = GasConstant / vmb - dadt / D;
+    cpres = T * d2adt2 * L - T * dpdT * dpdT / dpdV - GasConstant;
+}
+
+doublereal PengRobinsonMFTP::liquidVolEst(doublereal TKelvin, doublereal& presGuess) const
+{
+    doublereal atmp, btmp;
+    calculateAB(TKelvin, atmp, btmp);
+    doublereal vc = critVolume();
+    doublereal pres = std::max(psatEst(TKelvin), presGuess);
+    double Vroot[3];
+
+    for (int m = 0; m < 100; m++) {
+        int nsol = cubicSolve(TKelvin, pres, atmp, btmp, Vroot);
+        if (nsol > 1 || (nsol == 1 && Vroot[0] < vc)) {
+            presGuess = pres;
+            return Vroot[0];
+        }
+        pres *= 1.04;
+    }
+    return -1.0;
+}
+
+doublereal PengRobinsonMFTP::densityCalc(doublereal TKelvin, doublereal presPa,
+        int phaseRequested, doublereal rhoguess)
+{
+    // Set the temperature so that m_a_current is correct
+    setTemperature(TKelvin);
+    doublereal tcrit = critTemperature();
+    doublereal mmw = meanMolecularWeight();
+    if (rhoguess == -1.0) {
+        rhoguess = presPa * mmw / (GasConstant * TKelvin);
+        if (phaseRequested >= FLUID_LIQUID_0 && TKelvin < tcrit) {
+            double lqvol = liquidVolEst(TKelvin, presPa);
+            if (lqvol > 0.0) {
+                rhoguess = mmw / lqvol;
+            }
+        }
+    }
+    doublereal volguess = mmw / rhoguess;
+
+    NSolns_ = cubicSolve(TKelvin, presPa, m_a_current, m_b_current, Vroot_);
+    doublereal molarVol;
+    if (NSolns_ > 1) {
+        doublereal vLiq = Vroot_[0];
+        doublereal vGas = Vroot_[NSolns_ - 1];
+        if (phaseRequested >= FLUID_LIQUID_0) {
+            molarVol = vLiq;
+        } else if (phaseRequested == FLUID_GAS || phaseRequested == FLUID_SUPERCRIT) {
+            molarVol = vGas;
+        } else {
+            doublereal vMid = (NSolns_ == 3) ? Vroot_[1] : 0.5 * (vLiq + vGas);
+            molarVol = (volguess > vMid) ? vGas : vLiq;
+        }
+    } else if (NSolns_ == 1) {
+        molarVol = Vroot_[0];
+        if (TKelvin < tcrit) {
+            bool liquidLike = molarVol < critVolume();
+            if (liquidLike && phaseRequested == FLUID_GAS) {
+                return -2.0;
+            } else if (!liquidLike && phaseRequested >= FLUID_LIQUID_0) {
+                return -2.0;
+            }
+        }
+    } else {
+        return -1.0;
+    }
+    return mmw / molarVol;
+}
+
+//! Find the molar volume between vlo and vhi where dP/dV = 0, by bisection
+static doublereal spinodalVolume(const PengRobinsonMFTP& phase, doublereal T,
+                                 doublereal vlo, doublereal vhi)
+{
+    doublereal p;
+    doublereal flo = phase.dpdVCalc(T, vlo, p);
+    for (int n = 0; n < 200; n++) {
+        doublereal vmid = 0.5 * (vlo + vhi);
+        doublereal fmid = phase.dpdVCalc(T, vmid, p);
+        if ((fmid < 0.0) == (flo < 0.0)) {
+            vlo = vmid;
+            flo = fmid;
+        } else {
+            vhi = vmid;
+        }
+        if (vhi - vlo < 1.0E-13 * vhi) {
+            break;
+        }
+    }
+    return 0.5 * (vlo + vhi);
+}
+
+doublereal PengRobinsonMFTP::densSpinodalLiquid() const
+{
+    if (NSolns_ != 3) {
+        return critDensity();
+    }
+    return meanMolecularWeight() / spinodalVolume(*this, temperature(), Vroot_[0], Vroot_[1]);
+}
+
+doublereal PengRobinsonMFTP::densSpinodalGas() const
+{
+    if (NSolns_ != 3) {
+        return critDensity();
+    }
+    return meanMolecularWeight() / spinodalVolume(*this, temperature(), Vroot_[1], Vroot_[2]);
+}
+
+doublereal PengRobinsonMFTP::pressureCalc(doublereal TKelvin, doublereal molarVol) const
+{
+    doublereal b = m_b_current;
+    return GasConstant * TKelvin / (molarVol - b)
+           - m_a_current / (molarVol * molarVol + 2.0 * b * molarVol - b * b);
+}
+
+doublereal PengRobinsonMFTP::dpdVCalc(doublereal TKelvin, doublereal molarVol, doublereal& presCalc) const
+{
+    doublereal b = m_b_current;
+    doublereal vmb = molarVol - b;
+    doublereal D = molarVol * molarVol + 2.0 * b * molarVol - b * b;
+    presCalc = GasConstant * TKelvin / vmb - m_a_current / D;
+    return - GasConstant * TKelvin / (vmb * vmb)
+           + 2.0 * m_a_current * (molarVol + b) / (D * D);
+}
+
+void PengRobinsonMFTP::pressureDerivatives() const
+{
+    doublereal TKelvin = temperature();
+    doublereal mv = molarVolume();
+    doublereal pres;
+    dpdV_ = dpdVCalc(TKelvin, mv, pres);
+    doublereal b = m_b_current;
+    doublereal D = mv * mv + 2.0 * b * mv - b * b;
+    dpdT_ = GasConstant / (mv - b) - da_dt() / D;
+}
+
+void PengRobinsonMFTP::updateMixingExpressions()
+{
+    updateAB();
+}
+
+void PengRobinsonMFTP::updateAB()
+{
+    updateMixingCoeffs();
+}
+
+void PengRobinsonMFTP::updateMixingCoeffs() const
+{
+    doublereal T = temperature();
+    if (T == m_mixTemp && m_mixMoleFractions == moleFractions_) {
+        return;
+    }
+    mixtureA(T, DATA_PTR(moleFractions_), m_a_current, m_dadt_current,
+             m_d2adt2_current, DATA_PTR(m_sqrtAlpha), DATA_PTR(m_dsqrtAlpha));
+    m_b_current = dot(moleFractions_.begin(), moleFractions_.end(),
+                      m_b_Species.begin());
+    m_mixTemp = T;
+    m_mixMoleFractions = moleFractions_;
+}
+
+void PengRobinsonMFTP::mixtureA(doublereal T, const doublereal* x,
+                                doublereal& a, doublereal& dadt, doublereal& d2adt2,
+                                doublereal* sqrtAlpha, doublereal* dsqrtAlpha) const
+{
+    // sqrt(a_k alpha_k) is linear in sqrt(T). Its square root in the mixing
+    // rule is taken as positive, which changes the sign of the derivative
+    // at temperatures far above Tc_k. The second derivative of each term is
+    // -d/dT / (2T).
+    doublereal sqt = sqrt(T);
+    doublereal halfInvSqt = 0.5 / sqt;
+    doublereal sum = 0.0, dsum = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal r = m_sqrtAlpha0[k] + m_sqrtAlpha1[k] * sqt;
+        doublereal dr = m_sqrtAlpha1[k] * halfInvSqt;
+        if (r < 0.0) {
+            r = -r;
+            dr = -dr;
+        }
+        if (sqrtAlpha) {
+            sqrtAlpha[k] = r;
+            dsqrtAlpha[k] = dr;
+        }
+        sum += x[k] * r;
+        dsum += x[k] * dr;
+    }
+    a = sum * sum;
+    dadt = 2.0 * sum * dsum;
+    d2adt2 = 2.0 * dsum * dsum - sum * dsum / T;
+
+    // Corrections for the pairs with nonzero binary interaction parameters
+    for (size_t n = 0; n < m_pairKij.size(); n++) {
+        size_t i = m_pairI[n];
+        size_t j = m_pairJ[n];
+        doublereal w = 2.0 * m_pairKij[n] * x[i] * x[j];
+        if (w == 0.0) {
+            continue;
+        }
+        doublereal ri = m_sqrtAlpha0[i] + m_sqrtAlpha1[i] * sqt;
+        doublereal dri = m_sqrtAlpha1[i] * halfInvSqt;
+        if (ri < 0.0) {
+            ri = -ri;
+            dri = -dri;
+        }
+        doublereal rj = m_sqrtAlpha0[j] + m_sqrtAlpha1[j] * sqt;
+        doublereal drj = m_sqrtAlpha1[j] * halfInvSqt;
+        if (rj < 0.0) {
+            rj = -rj;
+            drj = -drj;
+        }
+        doublereal dq = dri * rj + ri * drj;
+        a -= w * ri * rj;
+        dadt -= w * dq;
+        d2adt2 -= w * (2.0 * dri * drj - 0.5 * dq / T);
+    }
+}
+
+void PengRobinsonMFTP::speciesMixingTerms(doublereal* pp, doublereal* dpp) const
+{
+    updateMixingCoeffs();
+    const vector_fp& x = moleFractions_;
+    doublereal sum = dot(x.begin(), x.end(), m_sqrtAlpha.begin());
+    doublereal dsum = dot(x.begin(), x.end(), m_dsqrtAlpha.begin());
+    for (size_t k = 0; k < m_kk; k++) {
+        pp[k] = m_sqrtAlpha[k] * sum;
+        if (dpp) {
+            dpp[k] = m_dsqrtAlpha[k] * sum + m_sqrtAlpha[k] * dsum;
+        }
+    }
+    for (size_t n = 0; n < m_pairKij.size(); n++) {
+        size_t i = m_pairI[n];
+        size_t j = m_pairJ[n];
+        doublereal kij = m_pairKij[n];
+        doublereal q = m_sqrtAlpha[i] * m_sqrtAlpha[j];
+        pp[i] -= kij * x[j] * q;
+        pp[j] -= kij * x[i] * q;
+        if (dpp) {
+            doublereal dq = m_dsqrtAlpha[i] * m_sqrtAlpha[j]
+                            + m_sqrtAlpha[i] * m_dsqrtAlpha[j];
+            dpp[i] -= kij * x[j] * dq;
+            dpp[j] -= kij * x[i] * dq;
+        }
+    }
+}
+
+void PengRobinsonMFTP::updateCriticalConditions() const
+{
+    if (m_critMoleFractions == moleFractions_) {
+        return;
+    }
+    const vector_fp& x = moleFractions_;
+    doublereal b = dot(x.begin(), x.end(), m_b_Species.begin());
+    doublereal tc = dot(x.begin(), x.end(), m_tc_Species.begin());
+    doublereal c = omega_a / omega_b * GasConstant * b;
+    doublereal a, dadt, d2adt2;
+
+    // Solve a(Tc) = (omega_a / omega_b) R b Tc
+    bool converged = false;
+    for (int n = 0; n < 100; n++) {
+        mixtureA(tc, DATA_PTR(x), a, dadt, d2adt2);
+        doublereal dtc = - (a - c * tc) / (dadt - c);
+        dtc = std::max(std::min(dtc, 0.5 * tc), -0.5 * tc);
+        tc += dtc;
+        if (fabs(dtc) < 1.0E-12 * tc) {
+            converged = true;
+            break;
+        }
+    }
+    if (!converged) {
+        throw CanteraError("PengRobinsonMFTP::updateCriticalConditions",
+                           "no convergence for the critical temperature");
+    }
+    m_tc_mix = tc;
+    m_pc_mix = omega_b * GasConstant * tc / b;
+    m_vc_mix = omega_vc * GasConstant * tc / m_pc_mix;
+    m_critMoleFractions = moleFractions_;
+}
+
+void PengRobinsonMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
+{
+    doublereal dadt, d2adt2;
+    mixtureA(temp, DATA_PTR(moleFractions_), aCalc, dadt, d2adt2);
+    bCalc = dot(moleFractions_.begin(), moleFractions_.end(), m_b_Species.begin());
+}
+
+doublereal PengRobinsonMFTP::da_dt() const
+{
+    updateMixingCoeffs();
+    return m_dadt_current;
+}
+
+doublereal PengRobinsonMFTP::d2a_dt2() const
+{
+    updateMixingCoeffs();
+    return m_d2adt2_current;
+}
+
+int PengRobinsonMFTP::cubicSolve(double TKelvin, double pres, doublereal a,
+                                 doublereal b, doublereal Vroot[3]) const
+{
+    Vroot[0] = 0.0;
+    Vroot[1] = 0.0;
+    Vroot[2] = 0.0;
+    if (TKelvin <= 0.0) {
+        throw CanteraError("PengRobinsonMFTP::cubicSolve()", "neg temperature");
+    }
+    doublereal RT = GasConstant * TKelvin;
+    doublereal A = a * pres / (RT * RT);
+    doublereal B = b * pres / RT;
+
+    // Z^3 + c2 Z^2 + c1 Z + c0 = 0
+    doublereal c2 = B - 1.0;
+    doublereal c1 = A - 3.0 * B * B - 2.0 * B;
+    doublereal c0 = B * B * B + B * B - A * B;
+
+    // Reduce to y^3 + p y + q = 0 with Z = y - c2/3
+    doublereal shift = c2 / 3.0;
+    doublereal p = c1 - c2 * shift;
+    doublereal q = 2.0 * shift * shift * shift - shift * c1 + c0;
+    doublereal disc = 0.25 * q * q + p * p * p / 27.0;
+
+    doublereal z[3];
+    int nRoots;
+    if (disc > 0.0 || p >= 0.0) {
+        // One real root (Cardano)
+        doublereal sd = sqrt(std::max(disc, 0.0));
+        z[0] = cubeRoot(-0.5 * q + sd) + cubeRoot(-0.5 * q - sd) - shift;
+        nRoots = 1;
+    } else {
+        // Three real roots (trigonometric form), in increasing order
+        doublereal m = 2.0 * sqrt(-p / 3.0);
+        doublereal arg = std::max(std::min(3.0 * q / (p * m), 1.0), -1.0);
+        doublereal theta = acos(arg) / 3.0;
+        doublereal oo = 2.0 * Pi / 3.0;
+        z[0] = m * cos(theta + oo) - shift;
+        z[1] = m * cos(theta + 2.0 * oo) - shift;
+        z[2] = m * cos(theta) - shift;
+        if (z[0] > z[1]) {
+            std::swap(z[0], z[1]);
+        }
+        nRoots = 3;
+    }
+
+    // Refine the roots with Newton iterations, since the closed-form
+    // expressions lose accuracy to roundoff when the roots are very
+    // different in magnitude.
+    int nValid = 0;
+    for (int i = 0; i < nRoots; i++) {
+        doublereal zz = z[i];
+        for (int n = 0; n < 20; n++) {
+            doublereal f = ((zz + c2) * zz + c1) * zz + c0;
+            doublereal df = (3.0 * zz + 2.0 * c2) * zz + c1;
+            if (df == 0.0) {
+                break;
+            }
+            doublereal dz = f / df;
+            zz -= dz;
+            if (fabs(dz) <= 1.0E-15 * fabs(zz)) {
+                break;
+            }
+        }
+        // Only roots with V > b are physical
+        if (zz > B && (nValid == 0 || zz > Vroot[nValid-1] * pres / RT)) {
+            Vroot[nValid++] = zz * RT / pres;
+        }
+    }
+    return nValid;
+}
+
+}
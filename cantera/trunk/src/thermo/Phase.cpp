@@ -68,7 +68,9 @@ Phase& Phase::operator=(const Phase& right)
     m_y = right.m_y;
     m_molwts = right.m_molwts;
     m_rmolwts = right.m_rmolwts;
+    m_sparseWork.assign(m_kk, 0.0);
     m_stateNum = -1;
+    m_cache.clear();
 
     m_speciesNames = right.m_speciesNames;
     m_speciesComp = right.m_speciesComp;
@@ -345,19 +347,17 @@ void Phase::setMoleFractions(const doublereal* const x)
         sum += m_molwts[k] * xk;
     }
     /*
-     * Set m_ym_ to the normalized mole fractions divided by the normalized mean molecular weight:
+     * Set m_ym_ to the normalized mole fractions divided by the normalized
+     * mean molecular weight, and m_y to the normalized mass fractions, in the
+     * same pass:
      *         m_ym_k = X_k / (sum_k X_k M_k)
+     *         m_y_k  = X_k M_k / (sum_k X_k M_k)
      */
     const doublereal invSum = 1.0/sum;
     for (size_t k=0; k < m_kk; k++) {
-        m_ym[k] = m_y[k]*invSum;
-    }
-    /*
-     * Now set m_y to the normalized mass fractions
-     *          m_y =  X_k M_k / (sum_k X_k M_k)
-     */
-    for (size_t k=0; k < m_kk; k++) {
-        m_y[k] = m_ym[k] * m_molwts[k];
+        doublereal ymk = m_y[k]*invSum;
+        m_ym[k] = ymk;
+        m_y[k] = ymk * m_molwts[k];
     }
     /*
      * Calculate the normalized molecular weight
@@ -369,9 +369,12 @@ void Phase::setMoleFractions(const doublereal* const x)
 void Phase::setMoleFractions_NoNorm(const doublereal* const x)
 {
     m_mmw = dot(x, x + m_kk, m_molwts.begin());
-    transform(x, x + m_kk, m_ym.begin(), timesConstant<double>(1.0/m_mmw));
-    transform(m_ym.begin(), m_ym.begin() + m_kk, m_molwts.begin(),
-              m_y.begin(), multiplies<double>());
+    const doublereal rmmw = 1.0/m_mmw;
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal ymk = x[k] * rmmw;
+        m_ym[k] = ymk;
+        m_y[k] = ymk * m_molwts[k];
+    }
     m_stateNum++;
 }
 
@@ -391,25 +394,36 @@ void Phase::setMoleFractionsByName(const std::string& x)
 
 void Phase::setMassFractions(const doublereal* const y)
 {
+    doublereal norm = 0.0;
     for (size_t k = 0; k < m_kk; k++) {
-        m_y[k] = std::max(y[k], 0.0); // Ignore negative mass fractions
+        double yk = std::max(y[k], 0.0); // Ignore negative mass fractions
+        m_y[k] = yk;
+        norm += yk;
     }
-    doublereal norm = accumulate(m_y.begin(), m_y.end(), 0.0);
-    scale(m_y.begin(), m_y.end(), m_y.begin(), 1.0/norm);
-
-    transform(m_y.begin(), m_y.end(), m_rmolwts.begin(),
-              m_ym.begin(), multiplies<double>());
-    m_mmw = 1.0 / accumulate(m_ym.begin(), m_ym.end(), 0.0);
+    // Normalize the mass fractions and compute m_ym and the mean molecular
+    // weight in a single pass
+    const doublereal invNorm = 1.0/norm;
+    doublereal sum = 0.0;
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal yk = m_y[k] * invNorm;
+        m_y[k] = yk;
+        doublereal ymk = yk * m_rmolwts[k];
+        m_ym[k] = ymk;
+        sum += ymk;
+    }
+    m_mmw = 1.0 / sum;
     m_stateNum++;
 }
 
 void Phase::setMassFractions_NoNorm(const doublereal* const y)
 {
     doublereal sum = 0.0;
-    copy(y, y + m_kk, m_y.begin());
-    transform(m_y.begin(), m_y.end(), m_rmolwts.begin(), m_ym.begin(),
-              multiplies<double>());
-    sum = accumulate(m_ym.begin(), m_ym.end(), 0.0);
+    for (size_t k = 0; k < m_kk; k++) {
+        m_y[k] = y[k];
+        doublereal ymk = y[k] * m_rmolwts[k];
+        m_ym[k] = ymk;
+        sum += ymk;
+    }
     m_mmw = 1.0/sum;
     m_stateNum++;
 }
@@ -428,6 +442,92 @@ void Phase::setMassFractionsByName(const std::string& y)
     setMassFractionsByName(parseCompString(y, speciesNames()));
 }
 
+SparseComposition Phase::compileComposition(const compositionMap& comp) const
+{
+    SparseComposition sc;
+    sc.nSpecies = m_kk;
+    for (size_t k = 0; k < m_kk; k++) {
+        doublereal value = getValue(comp, speciesName(k), 0.0);
+        if (value != 0.0) {
+            sc.index.push_back(k);
+            sc.value.push_back(value);
+        }
+    }
+    return sc;
+}
+
+SparseComposition Phase::compileComposition(const std::string& comp) const
+{
+    return compileComposition(parseCompString(comp, speciesNames()));
+}
+
+void Phase::setMoleFractions_Sparse(const SparseComposition& x)
+{
+    if (x.nSpecies != m_kk) {
+        throw CanteraError("Phase::setMoleFractions_Sparse",
+                           "composition was compiled for a phase with " +
+                           int2str(x.nSpecies) + " species, but this phase has " +
+                           int2str(m_kk));
+    }
+    setMoleFractions_Sparse(x.index.size(), DATA_PTR(x.index), DATA_PTR(x.value));
+}
+
+void Phase::setMoleFractions_Sparse(size_t nlist, const size_t* index,
+                                    const doublereal* x)
+{
+    for (size_t i = 0; i < nlist; i++) {
+        checkSpeciesIndex(index[i]);
+    }
+    for (size_t i = 0; i < nlist; i++) {
+        m_sparseWork[index[i]] = x[i];
+    }
+    // Use the virtual method so that derived classes see the change of state.
+    // The work array must be cleared even if this throws.
+    try {
+        setMoleFractions(&m_sparseWork[0]);
+    } catch (...) {
+        clearSparseWork(nlist, index);
+        throw;
+    }
+    clearSparseWork(nlist, index);
+}
+
+void Phase::setMassFractions_Sparse(const SparseComposition& y)
+{
+    if (y.nSpecies != m_kk) {
+        throw CanteraError("Phase::setMassFractions_Sparse",
+                           "composition was compiled for a phase with " +
+                           int2str(y.nSpecies) + " species, but this phase has " +
+                           int2str(m_kk));
+    }
+    setMassFractions_Sparse(y.index.size(), DATA_PTR(y.index), DATA_PTR(y.value));
+}
+
+void Phase::setMassFractions_Sparse(size_t nlist, const size_t* index,
+                                    const doublereal* y)
+{
+    for (size_t i = 0; i < nlist; i++) {
+        checkSpeciesIndex(index[i]);
+    }
+    for (size_t i = 0; i < nlist; i++) {
+        m_sparseWork[index[i]] = y[i];
+    }
+    try {
+        setMassFractions(&m_sparseWork[0]);
+    } catch (...) {
+        clearSparseWork(nlist, index);
+        throw;
+    }
+    clearSparseWork(nlist, index);
+}
+
+void Phase::clearSparseWork(size_t nlist, const size_t* index)
+{
+    for (size_t i = 0; i < nlist; i++) {
+        m_sparseWork[index[i]] = 0.0;
+    }
+}
+
 void Phase::setState_TRX(doublereal t, doublereal dens, const doublereal* x)
 {
     setMoleFractions(x);
@@ -908,6 +1008,7 @@ bool Phase::addSpecies(const Species& spec) {
     wt = std::max(wt, Tiny);
     m_molwts.push_back(wt);
     m_rmolwts.push_back(1.0/wt);
+    m_sparseWork.push_back(0.0);
     m_kk++;
 
     // Ensure that the Phase has a valid mass fraction vector that sums to
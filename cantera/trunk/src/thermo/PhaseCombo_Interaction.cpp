@@ -418,6 +418,11 @@ void PhaseCombo_Interaction::initThermoXML(XML_Node& phaseNode, const std::strin
 
 void PhaseCombo_Interaction::s_update_lnActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     doublereal T = temperature();
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
 
@@ -455,6 +460,11 @@ void PhaseCombo_Interaction::s_update_lnActCoeff() const
 
 void PhaseCombo_Interaction::s_update_dlnActCoeff_dT() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     doublereal T = temperature();
     dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
     d2lnActCoeffdT2_Scaled_.assign(m_kk, 0.0);
@@ -363,6 +363,11 @@ void RedlichKisterVPSSTP::initThermoXML(XML_Node& phaseNode, const std::string&
 
 void RedlichKisterVPSSTP::s_update_lnActCoeff() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     doublereal T = temperature();
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
 
@@ -428,6 +433,11 @@ void RedlichKisterVPSSTP::s_update_lnActCoeff() const
 
 void RedlichKisterVPSSTP::s_update_dlnActCoeff_dT() const
 {
+    static const int cacheId = m_cache.getId();
+    CachedScalar cached = m_cache.getScalar(cacheId);
+    if (cached.validate(temperature(), pressure(), stateMFNumber())) {
+        return;
+    }
     dlnActCoeffdT_Scaled_.assign(m_kk, 0.0);
     d2lnActCoeffdT2_Scaled_.assign(m_kk, 0.0);
 
@@ -693,6 +703,8 @@ void RedlichKisterVPSSTP::Vint(double& VintOut, double& voltsOut)
     doublereal T = temperature();
     double Volts = 0.0;
 
+    // The cached activity coefficients are overwritten here
+    invalidateCache();
     lnActCoeff_Scaled_.assign(m_kk, 0.0);
 
     for (size_t i = 0; i <  numBinaryInteractions_; i++) {
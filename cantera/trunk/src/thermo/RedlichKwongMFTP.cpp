@@ -34,6 +34,14 @@ RedlichKwongMFTP::RedlichKwongMFTP() :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTemp(-1.0),
+    m_a0_mix(0.0),
+    m_aT_mix(0.0),
+    m_b_mix(0.0),
+    m_critValid(false),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -48,6 +56,14 @@ RedlichKwongMFTP::RedlichKwongMFTP(const std::string& infile, std::string id_) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTemp(-1.0),
+    m_a0_mix(0.0),
+    m_aT_mix(0.0),
+    m_b_mix(0.0),
+    m_critValid(false),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -72,6 +88,14 @@ RedlichKwongMFTP::RedlichKwongMFTP(XML_Node& phaseRefRoot, const std::string& id
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTemp(-1.0),
+    m_a0_mix(0.0),
+    m_aT_mix(0.0),
+    m_b_mix(0.0),
+    m_critValid(false),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -91,6 +115,14 @@ RedlichKwongMFTP::RedlichKwongMFTP(int testProb) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTemp(-1.0),
+    m_a0_mix(0.0),
+    m_aT_mix(0.0),
+    m_b_mix(0.0),
+    m_critValid(false),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -119,6 +151,14 @@ RedlichKwongMFTP::RedlichKwongMFTP(const RedlichKwongMFTP& b) :
     m_formTempParam(0),
     m_b_current(0.0),
     m_a_current(0.0),
+    m_aTemp(-1.0),
+    m_a0_mix(0.0),
+    m_aT_mix(0.0),
+    m_b_mix(0.0),
+    m_critValid(false),
+    m_tc_mix(0.0),
+    m_pc_mix(0.0),
+    m_vc_mix(0.0),
     NSolns_(0),
     dpdV_(0.0),
     dpdT_(0.0)
@@ -144,6 +184,15 @@ RedlichKwongMFTP& RedlichKwongMFTP::operator=(const RedlichKwongMFTP& b)
         a_vec_Curr_ = b.a_vec_Curr_;
         b_vec_Curr_ = b.b_vec_Curr_;
         a_coeff_vec = b.a_coeff_vec;
+        m_aTemp = b.m_aTemp;
+        m_mixMoleFractions = b.m_mixMoleFractions;
+        m_a0_mix = b.m_a0_mix;
+        m_aT_mix = b.m_aT_mix;
+        m_b_mix = b.m_b_mix;
+        m_critValid = b.m_critValid;
+        m_tc_mix = b.m_tc_mix;
+        m_pc_mix = b.m_pc_mix;
+        m_vc_mix = b.m_vc_mix;
 
         m_pc_Species = b.m_pc_Species;
         m_tc_Species = b.m_tc_Species;
@@ -223,6 +272,112 @@ doublereal RedlichKwongMFTP::cv_mole() const
                         +1.0/(m_b_current * sqt) * log(vpb/mv)*(-0.5*dadt));
 }
 
+void RedlichKwongMFTP::getMassProperties(size_t nStates, const doublereal* T,
+        const doublereal* P, const doublereal* Y, doublereal* rho,
+        doublereal* cp, doublereal* h, doublereal* s) const
+{
+    // Number of states for which the species properties are stored at once
+    const size_t chunk = 64;
+    size_t nsp = m_kk;
+    vector_fp cp_R(chunk * nsp), h_RT(chunk * nsp), s_R(chunk * nsp);
+    const vector_fp& mw = molecularWeights();
+    doublereal logPref = log(refPressure());
+
+    // Mole fractions and mixing terms of the current composition
+    vector_fp x(moleFractions_);
+    updateMixingCoeffs();
+    doublereal a0 = m_a0_mix;
+    doublereal aT = m_aT_mix;
+    doublereal b = m_b_mix;
+    doublereal mmw = meanMolecularWeight();
+    doublereal pres = pressure();
+    double Vroot[3];
+
+    for (size_t i0 = 0; i0 < nStates; i0 += chunk) {
+        size_t n = std::min(chunk, nStates - i0);
+        m_spthermo->updateMany(n, T + i0, nsp, &cp_R[0], &h_RT[0], &s_R[0]);
+        for (size_t i = 0; i < n; i++) {
+            size_t ii = i0 + i;
+            if (Y) {
+                const doublereal* y = Y + ii*nsp;
+                doublereal sumyw = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    x[k] = y[k] / mw[k];
+                    sumyw += x[k];
+                }
+                mmw = 1.0 / sumyw;
+                for (size_t k = 0; k < nsp; k++) {
+                    x[k] *= mmw;
+                }
+                b = 0.0;
+                a0 = 0.0;
+                aT = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    b += x[k] * b_vec_Curr_[k];
+                    for (size_t j = 0; j < nsp; j++) {
+                        size_t counter = k * nsp + j;
+                        a0 += a_coeff_vec(0,counter) * x[k] * x[j];
+                        aT += a_coeff_vec(1,counter) * x[k] * x[j];
+                    }
+                }
+            }
+            if (P) {
+                pres = P[ii];
+            }
+            doublereal TKelvin = T[ii];
+            doublereal a = a0 + aT * TKelvin;
+
+            // Choose the root with the lower Gibbs function, using the
+            // fugacity coefficient of the mixture
+            int nsol = NicholsSolve(TKelvin, pres, a, b, Vroot);
+            if (nsol == 0) {
+                throw CanteraError("RedlichKwongMFTP::getMassProperties",
+                                   "no solution of the equation of state at T = "
+                                   + fp2str(TKelvin) + ", P = " + fp2str(pres));
+            }
+            doublereal V = Vroot[0];
+            if (nsol >= 2 || nsol == -2) {
+                doublereal lnphiMin = 0.0;
+                size_t iLast = (nsol == 3) ? 2 : 1;
+                for (size_t iv = 0; iv <= iLast; iv += iLast) {
+                    doublereal Vi = Vroot[iv];
+                    if (Vi <= b) {
+                        continue;
+                    }
+                    doublereal zz = pres * Vi / (GasConstant * TKelvin);
+                    doublereal lnphi = zz - 1.0 - log(zz * (1.0 - b / Vi))
+                        - a / (b * GasConstant * TKelvin * sqrt(TKelvin)) * log(1.0 + b / Vi);
+                    if (iv == 0 || lnphi < lnphiMin) {
+                        lnphiMin = lnphi;
+                        V = Vi;
+                    }
+                }
+            }
+
+            doublereal hres, sres, cpres;
+            residualProperties(TKelvin, pres, V, a, aT, b, hres, sres, cpres);
+            const doublereal* cpi = &cp_R[i*nsp];
+            const doublereal* hi = &h_RT[i*nsp];
+            doublereal cpsum = 0.0, hsum = 0.0;
+            for (size_t k = 0; k < nsp; k++) {
+                cpsum += x[k] * cpi[k];
+                hsum += x[k] * hi[k];
+            }
+            rho[ii] = mmw / V;
+            cp[ii] = (GasConstant * cpsum + cpres) / mmw;
+            h[ii] = (GasConstant * TKelvin * hsum + hres) / mmw;
+            if (s) {
+                const doublereal* si = &s_R[i*nsp];
+                doublereal ssum = 0.0;
+                for (size_t k = 0; k < nsp; k++) {
+                    ssum += x[k] * (si[k] - log(x[k] + Tiny));
+                }
+                s[ii] = (GasConstant * (ssum - (log(pres) - logPref)) + sres) / mmw;
+            }
+        }
+    }
+}
+
 doublereal RedlichKwongMFTP::pressure() const
 {
 #ifdef DEBUG_MODE
@@ -591,85 +746,33 @@ void RedlichKwongMFTP::getPartialMolarVolumes(doublereal* vbar) const
 
 doublereal RedlichKwongMFTP::critTemperature() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return tc;
+    updateCriticalConditions();
+    return m_tc_mix;
 }
 
 doublereal RedlichKwongMFTP::critPressure() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-
-    return pc;
+    updateCriticalConditions();
+    return m_pc_mix;
 }
 
 doublereal RedlichKwongMFTP::critVolume() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return vc;
+    updateCriticalConditions();
+    return m_vc_mix;
 }
 
 doublereal RedlichKwongMFTP::critCompressibility() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] * a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-    return pc*vc/tc/GasConstant;
+    updateCriticalConditions();
+    return m_pc_mix * m_vc_mix / m_tc_mix / GasConstant;
 }
 
 doublereal RedlichKwongMFTP::critDensity() const
 {
-    double pc, tc, vc;
-    double a0 = 0.0;
-    double aT = 0.0;
-    for (size_t i = 0; i < m_kk; i++) {
-        for (size_t j = 0; j <m_kk; j++) {
-            size_t counter = i + m_kk * j;
-            a0 += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(0, counter);
-            aT += moleFractions_[i] * moleFractions_[j] *a_coeff_vec(1, counter);
-        }
-    }
-    calcCriticalConditions(m_a_current, m_b_current, a0, aT, pc, tc, vc);
-
+    updateCriticalConditions();
     double mmw = meanMolecularWeight();
-    return mmw / vc;
+    return mmw / m_vc_mix;
 }
 
 void RedlichKwongMFTP::initThermo()
@@ -1008,6 +1111,10 @@ void RedlichKwongMFTP::initThermoXML(XML_Node& phaseNode, const std::string& id)
         calcCriticalConditions(ai, bi, a0coeff, aTcoeff, m_pc_Species[i], m_tc_Species[i], m_vc_Species[i]);
     }
 
+    // The parameters have changed, so the cached mixing terms are invalid
+    m_aTemp = -1.0;
+    m_mixMoleFractions.clear();
+
     MixtureFugacityTP::initThermoXML(phaseNode, id);
 }
 
@@ -1196,6 +1303,28 @@ doublereal RedlichKwongMFTP::hresid() const
     return GasConstant * T * (zz - 1.0) + fac * log(1.0 + hh) / (sqT * m_b_current);
 }
 
+void RedlichKwongMFTP::residualProperties(doublereal T, doublereal P,
+        doublereal V, doublereal a, doublereal dadt, doublereal b,
+        doublereal& hres, doublereal& sres, doublereal& cpres) const
+{
+    doublereal sqT = sqrt(T);
+    doublereal zz = P * V / (GasConstant * T);
+    doublereal hh = b / V;
+    doublereal logvpb = log(1.0 + hh);
+    doublereal fac = T * dadt - 1.5 * a;
+    hres = GasConstant * T * (zz - 1.0) + fac * logvpb / (sqT * b);
+    sres = GasConstant * log(zz * (1.0 - hh))
+           + logvpb * (dadt - a / (2.0 * T)) / (sqT * b);
+
+    doublereal vpb = V + b;
+    doublereal vmb = V - b;
+    doublereal dpdV = - GasConstant * T / (vmb * vmb)
+                      + a * (2 * V + b) / (sqT * V * V * vpb * vpb);
+    doublereal dpdT = GasConstant / vmb - (dadt - a / (2.0 * T)) / (sqT * V * vpb);
+    cpres = V * dpdT - GasConstant - logvpb * fac / (2.0 * b * T * sqT)
+            - 0.5 * dadt * logvpb / (b * sqT) - (V + T * dpdT / dpdV) * dpdT;
+}
+
 doublereal RedlichKwongMFTP::liquidVolEst(doublereal TKelvin, doublereal& presGuess) const
 {
     double v = m_b_current * 1.1;
@@ -1393,62 +1522,65 @@ void RedlichKwongMFTP::updateMixingExpressions()
 void RedlichKwongMFTP::updateAB()
 {
     double temp = temperature();
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+    if (temp != m_aTemp) {
+        if (m_formTempParam == 1 || m_aTemp < 0.0) {
+            for (size_t i = 0; i < m_kk; i++) {
+                for (size_t j = 0; j < m_kk; j++) {
+                    size_t counter = i * m_kk + j;
+                    a_vec_Curr_[counter] = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
+                }
             }
         }
+        m_aTemp = temp;
     }
 
-    m_b_current = 0.0;
-    m_a_current = 0.0;
+    updateMixingCoeffs();
+    m_b_current = m_b_mix;
+    m_a_current = m_a0_mix + m_aT_mix * temp;
+}
+
+void RedlichKwongMFTP::updateMixingCoeffs() const
+{
+    if (m_mixMoleFractions == moleFractions_) {
+        return;
+    }
+    m_b_mix = 0.0;
+    m_a0_mix = 0.0;
+    m_aT_mix = 0.0;
     for (size_t i = 0; i < m_kk; i++) {
-        m_b_current += moleFractions_[i] * b_vec_Curr_[i];
+        m_b_mix += moleFractions_[i] * b_vec_Curr_[i];
         for (size_t j = 0; j < m_kk; j++) {
-            m_a_current +=  a_vec_Curr_[i * m_kk + j] * moleFractions_[i] * moleFractions_[j];
+            size_t counter = i * m_kk + j;
+            double xx = moleFractions_[i] * moleFractions_[j];
+            m_a0_mix += a_coeff_vec(0,counter) * xx;
+            m_aT_mix += a_coeff_vec(1,counter) * xx;
         }
     }
+    m_mixMoleFractions = moleFractions_;
+    m_critValid = false;
 }
 
-void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
+void RedlichKwongMFTP::updateCriticalConditions() const
 {
-    bCalc = 0.0;
-    aCalc = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter) + a_coeff_vec(1,counter) * temp;
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    } else {
-        for (size_t i = 0; i < m_kk; i++) {
-            bCalc += moleFractions_[i] * b_vec_Curr_[i];
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                doublereal a_vec_Curr = a_coeff_vec(0,counter);
-                aCalc +=  a_vec_Curr * moleFractions_[i] * moleFractions_[j];
-            }
-        }
+    updateMixingCoeffs();
+    if (!m_critValid) {
+        calcCriticalConditions(m_a0_mix, m_b_mix, m_a0_mix, m_aT_mix,
+                               m_pc_mix, m_tc_mix, m_vc_mix);
+        m_critValid = true;
     }
 }
 
+void RedlichKwongMFTP::calculateAB(doublereal temp, doublereal& aCalc, doublereal& bCalc) const
+{
+    updateMixingCoeffs();
+    bCalc = m_b_mix;
+    aCalc = m_a0_mix + m_aT_mix * temp;
+}
+
 doublereal RedlichKwongMFTP::da_dt() const
 {
-    doublereal dadT = 0.0;
-    if (m_formTempParam == 1) {
-        for (size_t i = 0; i < m_kk; i++) {
-            for (size_t j = 0; j < m_kk; j++) {
-                size_t counter = i * m_kk + j;
-                dadT+=  a_coeff_vec(1,counter) * moleFractions_[i] * moleFractions_[j];
-            }
-        }
-    }
-    return dadT;
+    updateMixingCoeffs();
+    return m_aT_mix;
 }
 
 void RedlichKwongMFTP::calcCriticalConditions(doublereal a, doublereal b, doublereal a0_coeff, doublereal aT_coeff,
@@ -23,6 +23,7 @@
 
 #include "cantera/thermo/PureFluidPhase.h"
 #include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/PengRobinsonMFTP.h"
 
 #include "cantera/thermo/ConstDensityThermo.h"
 #include "cantera/thermo/SurfPhase.h"
@@ -66,7 +67,7 @@ ThermoFactory* ThermoFactory::s_factory = 0;
 mutex_t ThermoFactory::thermo_mutex;
 
 //! Define the number of ThermoPhase types for use in this factory routine
-static int ntypes = 27;
+static int ntypes = 29;
 
 //! Define the string name of the ThermoPhase types that are handled by this factory routine
 static string _types[] = {"IdealGas", "Incompressible",
@@ -77,7 +78,8 @@ static string _types[] = {"IdealGas", "Incompressible",
                           "MineralEQ3", "MetalSHEelectrons", "Margules", "PhaseCombo_Interaction",
                           "IonsFromNeutralMolecule", "FixedChemPot", "MolarityIonicVPSSTP",
                           "MixedSolventElectrolyte", "Redlich-Kister", "RedlichKwong",
-                          "RedlichKwongMFTP", "MaskellSolidSolnPhase"
+                          "RedlichKwongMFTP", "MaskellSolidSolnPhase", "PengRobinson",
+                          "PengRobinsonMFTP"
                          };
 
 //! Define the integer id of the ThermoPhase types that are handled by this factory routine
@@ -89,7 +91,8 @@ static int _itypes[]   = {cIdealGas, cIncompressible,
                           cMineralEQ3, cMetalSHEelectrons,
                           cMargulesVPSSTP,  cPhaseCombo_Interaction, cIonsFromNeutral, cFixedChemPot,
                           cMolarityIonicVPSSTP, cMixedSolventElectrolyte, cRedlichKisterVPSSTP,
-                          cRedlichKwongMFTP, cRedlichKwongMFTP, cMaskellSolidSolnPhase
+                          cRedlichKwongMFTP, cRedlichKwongMFTP, cMaskellSolidSolnPhase,
+                          cPengRobinsonMFTP, cPengRobinsonMFTP
                          };
 
 ThermoPhase* ThermoFactory::newThermoPhase(const std::string& model)
@@ -147,6 +150,8 @@ ThermoPhase* ThermoFactory::newThermoPhase(const std::string& model)
         return new PureFluidPhase;
     case cRedlichKwongMFTP:
         return new RedlichKwongMFTP;
+    case cPengRobinsonMFTP:
+        return new PengRobinsonMFTP;
     case cHMW:
         return new HMWSoln;
     case cDebyeHuckel:
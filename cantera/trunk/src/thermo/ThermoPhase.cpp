@@ -157,6 +157,12 @@ void ThermoPhase::setState_TPX(doublereal t, doublereal p, const std::string& x)
     setState_TP(t,p);
 }
 
+void ThermoPhase::setState_TPX(doublereal t, doublereal p, const SparseComposition& x)
+{
+    setMoleFractions_Sparse(x);
+    setState_TP(t,p);
+}
+
 void ThermoPhase::setState_TPY(doublereal t, doublereal p, const doublereal* y)
 {
     setMassFractions(y);
@@ -175,6 +181,12 @@ void ThermoPhase::setState_TPY(doublereal t, doublereal p, const std::string& y)
     setState_TP(t,p);
 }
 
+void ThermoPhase::setState_TPY(doublereal t, doublereal p, const SparseComposition& y)
+{
+    setMassFractions_Sparse(y);
+    setState_TP(t,p);
+}
+
 void ThermoPhase::setState_TP(doublereal t, doublereal p)
 {
     setTemperature(t);
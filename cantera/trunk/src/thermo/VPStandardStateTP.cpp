@@ -152,6 +152,7 @@ void VPStandardStateTP::modifyOneHf298SS(const size_t k, const doublereal Hf298N
 {
     m_spthermo->modifyOneHf298(k, Hf298New);
     m_Tlast_ss += 0.0001234;
+    invalidateCache();
 }
 
 void VPStandardStateTP::getEntropy_R(doublereal* srt) const
@@ -10,6 +10,7 @@
  * U.S. Government retains certain rights in this software.
  */
 #include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/thermo/WaterPropsIAPWSTable.h"
 #include "cantera/base/ctexceptions.h"
 #include "cantera/base/stringUtils.h"
 
@@ -41,7 +42,8 @@ WaterPropsIAPWS::WaterPropsIAPWS() :
     m_phi(0),
     tau(-1.0),
     delta(-1.0),
-    iState(-30000)
+    iState(-30000),
+    m_table(0)
 {
     m_phi = new WaterPropsIAPWSphi();
 }
@@ -50,7 +52,8 @@ WaterPropsIAPWS::WaterPropsIAPWS(const WaterPropsIAPWS& b) :
     m_phi(0),
     tau(b.tau),
     delta(b.delta),
-    iState(b.iState)
+    iState(b.iState),
+    m_table(b.m_table)
 {
     m_phi = new WaterPropsIAPWSphi();
     m_phi->tdpolycalc(tau, delta);
@@ -64,6 +67,7 @@ WaterPropsIAPWS& WaterPropsIAPWS::operator=(const WaterPropsIAPWS& b)
     tau = b.tau;
     delta = b.delta;
     iState = b.iState;
+    m_table = b.m_table;
     m_phi->tdpolycalc(tau, delta);
     return *this;
 }
@@ -111,6 +115,13 @@ doublereal  WaterPropsIAPWS::pressure() const
 doublereal WaterPropsIAPWS::density(doublereal temperature, doublereal pressure,
                                     int phase, doublereal rhoguess)
 {
+    if (m_table && phase == WATER_LIQUID) {
+        doublereal rho = m_table->liquidDensity(temperature, pressure);
+        if (rho > 0.0) {
+            setState_TR(temperature, rho);
+            return rho;
+        }
+    }
     doublereal deltaGuess = 0.0;
     if (rhoguess == -1.0) {
         if (phase != -1) {
@@ -171,6 +182,12 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
         int phase, doublereal rhoguess) const
 {
     doublereal temperature = T_c / tau;
+    if (m_table && phase == WATER_LIQUID) {
+        doublereal rho = m_table->liquidDensity(temperature, pressure);
+        if (rho > 0.0) {
+            return rho;
+        }
+    }
     doublereal deltaGuess = 0.0;
     doublereal deltaSave = delta;
     if (rhoguess == -1.0) {
@@ -229,6 +246,15 @@ doublereal WaterPropsIAPWS::density_const(doublereal pressure,
     return density_retn;
 }
 
+void WaterPropsIAPWS::useDensityTable(bool flag)
+{
+    if (flag) {
+        m_table = &WaterPropsIAPWSTable::liquidTable();
+    } else {
+        m_table = 0;
+    }
+}
+
 doublereal WaterPropsIAPWS::density() const
 {
     return delta * Rho_c;
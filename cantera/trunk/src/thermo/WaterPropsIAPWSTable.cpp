@@ -0,0 +1,149 @@
+/**
+ * @file WaterPropsIAPWSTable.cpp
+ * Definitions for a table of the density of liquid water computed from the
+ * IAPWS 1995 Formulation (see class
+ * \link Cantera::WaterPropsIAPWSTable WaterPropsIAPWSTable\endlink).
+ */
+#include "cantera/thermo/WaterPropsIAPWSTable.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/base/ctexceptions.h"
+
+namespace Cantera
+{
+
+mutex_t WaterPropsIAPWSTable::table_mutex;
+
+//! Exact liquid density at T and P, and its derivatives with respect to T and
+//! ln(P). Returns false if the liquid density could not be found.
+static bool exactLiquidDensity(WaterPropsIAPWS& water, doublereal T,
+                               doublereal P, doublereal& rho,
+                               doublereal& rho_T, doublereal& rho_lnP)
+{
+    rho = water.density(T, P, WATER_LIQUID);
+    if (rho <= 0.0 || water.phaseState(true) != WATER_LIQUID) {
+        return false;
+    }
+    rho_T = - water.coeffThermExp() * rho;
+    rho_lnP = water.isothermalCompressibility() * rho * P;
+    return true;
+}
+
+WaterPropsIAPWSTable::WaterPropsIAPWSTable(doublereal Tmin, doublereal Tmax,
+        size_t nT, doublereal Pmin, doublereal Pmax, size_t nP) :
+    m_Tmin(Tmin),
+    m_dT(0.0),
+    m_lnPmin(log(Pmin)),
+    m_dlnP(0.0),
+    m_nT(nT),
+    m_nP(nP)
+{
+    WaterPropsIAPWS water;
+    if (nT < 2 || nP < 2 || Tmax <= Tmin || Pmax <= Pmin || Pmin <= 0.0 ||
+            Tmax >= water.Tcrit()) {
+        throw CanteraError("WaterPropsIAPWSTable::WaterPropsIAPWSTable",
+                           "invalid table range");
+    }
+    m_dT = (Tmax - Tmin) / (nT - 1);
+    m_dlnP = (log(Pmax) - m_lnPmin) / (nP - 1);
+    m_rho.assign(nT * nP, 0.0);
+    m_rho_T.assign(nT * nP, 0.0);
+    m_rho_lnP.assign(nT * nP, 0.0);
+    m_rho_TlnP.assign(nT * nP, 0.0);
+    vector_int nodeValid(nT * nP, 0);
+
+    // Temperature step used to compute the mixed derivatives
+    doublereal dTmix = 1.0E-3 * m_dT;
+    doublereal r, r_T, r_lnP, rp_lnP, rm_lnP;
+    for (size_t i = 0; i < nT; i++) {
+        doublereal T = Tmin + i * m_dT;
+        doublereal ps = water.psat(T);
+        for (size_t j = 0; j < nP; j++) {
+            doublereal P = exp(m_lnPmin + j * m_dlnP);
+            // Nodes at or below the saturation pressure are not stored
+            if (P <= ps * (1.0 + 1.0E-6) ||
+                    !exactLiquidDensity(water, T + dTmix, P, r, r_T, rp_lnP) ||
+                    !exactLiquidDensity(water, T - dTmix, P, r, r_T, rm_lnP) ||
+                    !exactLiquidDensity(water, T, P, r, r_T, r_lnP)) {
+                continue;
+            }
+            size_t n = i * nP + j;
+            m_rho[n] = r;
+            m_rho_T[n] = r_T;
+            m_rho_lnP[n] = r_lnP;
+            m_rho_TlnP[n] = (rp_lnP - rm_lnP) / (2.0 * dTmix);
+            nodeValid[n] = 1;
+        }
+    }
+
+    m_valid.assign((nT - 1) * (nP - 1), 0);
+    for (size_t i = 0; i < nT - 1; i++) {
+        for (size_t j = 0; j < nP - 1; j++) {
+            size_t n = i * nP + j;
+            m_valid[i * (nP - 1) + j] = nodeValid[n] && nodeValid[n + 1] &&
+                                        nodeValid[n + nP] && nodeValid[n + nP + 1];
+        }
+    }
+}
+
+const WaterPropsIAPWSTable& WaterPropsIAPWSTable::liquidTable()
+{
+    ScopedLock lock(table_mutex);
+    static WaterPropsIAPWSTable table(273.16, 598.16, 131, 1.0E3, 1.0E8, 101);
+    return table;
+}
+
+doublereal WaterPropsIAPWSTable::liquidDensity(doublereal temperature,
+        doublereal pressure) const
+{
+    doublereal x = (temperature - m_Tmin) / m_dT;
+    doublereal y = (log(pressure) - m_lnPmin) / m_dlnP;
+    // Written so that NaN inputs are also rejected
+    if (!(x >= 0.0 && x < m_nT - 1 && y >= 0.0 && y < m_nP - 1)) {
+        return -1.0;
+    }
+    size_t i = static_cast<size_t>(x);
+    size_t j = static_cast<size_t>(y);
+    if (!m_valid[i * (m_nP - 1) + j]) {
+        return -1.0;
+    }
+    doublereal u = x - i;
+    doublereal v = y - j;
+
+    // Cubic Hermite basis functions for the values at the lower and upper
+    // nodes (a0, a1) and for the derivatives (b0, b1) in each direction,
+    // with the derivative terms scaled by the grid step
+    doublereal a1u = u * u * (3.0 - 2.0 * u);
+    doublereal a0u = 1.0 - a1u;
+    doublereal b0u = u * (1.0 - u) * (1.0 - u) * m_dT;
+    doublereal b1u = u * u * (u - 1.0) * m_dT;
+    doublereal a1v = v * v * (3.0 - 2.0 * v);
+    doublereal a0v = 1.0 - a1v;
+    doublereal b0v = v * (1.0 - v) * (1.0 - v) * m_dlnP;
+    doublereal b1v = v * v * (v - 1.0) * m_dlnP;
+
+    size_t n00 = i * m_nP + j;
+    size_t n01 = n00 + 1;
+    size_t n10 = n00 + m_nP;
+    size_t n11 = n10 + 1;
+    return a0u * (a0v * m_rho[n00] + a1v * m_rho[n01] +
+                  b0v * m_rho_lnP[n00] + b1v * m_rho_lnP[n01])
+           + a1u * (a0v * m_rho[n10] + a1v * m_rho[n11] +
+                    b0v * m_rho_lnP[n10] + b1v * m_rho_lnP[n11])
+           + b0u * (a0v * m_rho_T[n00] + a1v * m_rho_T[n01] +
+                    b0v * m_rho_TlnP[n00] + b1v * m_rho_TlnP[n01])
+           + b1u * (a0v * m_rho_T[n10] + a1v * m_rho_T[n11] +
+                    b0v * m_rho_TlnP[n10] + b1v * m_rho_TlnP[n11]);
+}
+
+size_t WaterPropsIAPWSTable::nValidCells() const
+{
+    size_t n = 0;
+    for (size_t k = 0; k < m_valid.size(); k++) {
+        if (m_valid[k]) {
+            n++;
+        }
+    }
+    return n;
+}
+
+}
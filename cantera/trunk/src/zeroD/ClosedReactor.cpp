@@ -0,0 +1,420 @@
+//! @file ClosedReactor.cpp
+#include "cantera/zeroD/ClosedReactor.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/kinetics/Kinetics.h"
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/ctlapack.h"
+
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+
+//! Compute x^nu, avoiding the call to pow for the common integer orders
+inline doublereal powOrder(doublereal x, doublereal nu)
+{
+    if (nu == 1.0) {
+        return x;
+    } else if (nu == 0.0) {
+        return 1.0;
+    } else if (nu == 2.0) {
+        return x * x;
+    } else {
+        return pow(x, nu);
+    }
+}
+
+//! Derivative with respect to the concentration of the `a`th participant of
+//! the product of the concentrations raised to the stoichiometric
+//! coefficients, multiplied by the rate constant *k*.
+doublereal dRateDConc(doublereal k, size_t a, const vector_fp& conc,
+                      const std::vector<size_t>& index, const vector_fp& nu)
+{
+    doublereal d = k * nu[a] * powOrder(conc[index[a]], nu[a] - 1.0);
+    for (size_t b = 0; b < index.size(); b++) {
+        if (b != a) {
+            d *= powOrder(conc[index[b]], nu[b]);
+        }
+    }
+    return d;
+}
+
+}
+
+ClosedReactor::ClosedReactor(ThermoPhase& thermo, Kinetics& kin,
+                             bool constPressure) :
+    m_thermo(&thermo),
+    m_kin(&kin),
+    m_integ(newIntegrator("CVODE")),
+    m_constPressure(constPressure),
+    m_energy(true),
+    m_init(false),
+    m_integrator_init(false),
+    m_nsp(thermo.nSpecies()),
+    m_nv(thermo.nSpecies() + 1),
+    m_rho(0.0),
+    m_pressure(0.0),
+    m_time(0.0),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_maxstep(-1.0),
+    m_reuseTol(0.0),
+    m_restarted(false),
+    m_jacValid(false),
+    m_fixedJac(0.0),
+    m_njac(0),
+    m_nreuse(0)
+{
+    if (thermo.eosType() != cIdealGas) {
+        delete m_integ;
+        throw CanteraError("ClosedReactor::ClosedReactor",
+                           "Incompatible phase type provided");
+    }
+    if (kin.nPhases() != 1 || &kin.thermo(0) != &thermo) {
+        delete m_integ;
+        throw CanteraError("ClosedReactor::ClosedReactor",
+                           "Kinetics manager is not defined on the phase");
+    }
+
+    // The Jacobian is only approximate, so the linear systems are solved
+    // with GMRES, using the Newton matrix formed from it as the
+    // preconditioner.
+    m_integ->setMethod(BDF_Method);
+    m_integ->setProblemType(GMRES + JAC);
+    m_integ->setIterator(Newton_Iter);
+
+    size_t nr = m_kin->nReactions();
+    m_rkIndex.resize(nr);
+    m_pkIndex.resize(nr);
+    m_netIndex.resize(nr);
+    m_rkStoich.resize(nr);
+    m_pkStoich.resize(nr);
+    m_netStoich.resize(nr);
+    for (size_t i = 0; i < nr; i++) {
+        bool reversible = m_kin->isReversible(i);
+        for (size_t k = 0; k < m_nsp; k++) {
+            doublereal nur = m_kin->reactantStoichCoeff(k, i);
+            doublereal nup = m_kin->productStoichCoeff(k, i);
+            if (nur != 0.0) {
+                m_rkIndex[i].push_back(k);
+                m_rkStoich[i].push_back(nur);
+            }
+            if (nup != 0.0 && reversible) {
+                m_pkIndex[i].push_back(k);
+                m_pkStoich[i].push_back(nup);
+            }
+            if (nup != nur) {
+                m_netIndex[i].push_back(k);
+                m_netStoich[i].push_back(nup - nur);
+            }
+        }
+    }
+
+    m_jac.resize(m_nv, m_nv);
+    m_dwdc.resize(m_nsp, m_nsp);
+    m_precon.resize(m_nv, m_nv);
+    m_pivots.resize(m_nv);
+    m_wdot.resize(m_nsp);
+    m_ek.resize(m_nsp);
+    m_cpk.resize(m_nsp);
+    m_conc.resize(m_nsp);
+    m_kf.resize(nr);
+    m_kr.resize(nr);
+    m_ydot.resize(m_nv);
+    m_yJac.resize(m_nv);
+}
+
+ClosedReactor::~ClosedReactor()
+{
+    delete m_integ;
+}
+
+void ClosedReactor::setEnergy(bool energy)
+{
+    m_energy = energy;
+    m_init = false;
+}
+
+void ClosedReactor::setTolerances(doublereal rtol, doublereal atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    m_init = false;
+}
+
+void ClosedReactor::setMaxTimeStep(doublereal maxstep)
+{
+    m_maxstep = maxstep;
+    m_init = false;
+}
+
+void ClosedReactor::setJacobianReuse(doublereal tol)
+{
+    m_reuseTol = tol;
+}
+
+void ClosedReactor::setInitialTime(doublereal time)
+{
+    m_time = time;
+    m_integrator_init = false;
+}
+
+void ClosedReactor::initialize(doublereal tEnd)
+{
+    m_rho = m_thermo->density();
+    m_pressure = m_thermo->pressure();
+    // Unless a maximum step was set, limit the step to the length of this
+    // integration. This is set again on every restart, so that a later
+    // integration to a different end time uses its own limit.
+    doublereal maxstep = m_maxstep;
+    if (maxstep < 0.0) {
+        maxstep = tEnd - m_time;
+    }
+    m_integ->setMaxStepSize(maxstep);
+    if (!m_init) {
+        m_njac = 0;
+        m_nreuse = 0;
+        m_jacValid = false;
+        m_integ->setTolerances(m_rtol, m_atol);
+        m_integ->initialize(m_time, *this);
+    } else {
+        m_integ->reinitialize(m_time, *this);
+    }
+    m_init = true;
+    m_integrator_init = true;
+    m_restarted = true;
+}
+
+void ClosedReactor::integrateCells(size_t n, doublereal dt, doublereal* T,
+                                   const doublereal* P, doublereal* Y)
+{
+    for (size_t i = 0; i < n; i++) {
+        m_thermo->setState_TPY(T[i], P[i], Y + i * m_nsp);
+        setInitialTime(0.0);
+        advance(dt);
+        T[i] = m_thermo->temperature();
+        m_thermo->getMassFractions(Y + i * m_nsp);
+    }
+}
+
+void ClosedReactor::advance(doublereal time)
+{
+    if (!m_init || !m_integrator_init) {
+        initialize(time);
+    }
+    m_integ->integrate(time);
+    m_time = time;
+    updateState(m_integ->solution());
+}
+
+doublereal ClosedReactor::step(doublereal time)
+{
+    if (!m_init || !m_integrator_init) {
+        initialize(time);
+    }
+    m_time = m_integ->step(time);
+    updateState(m_integ->solution());
+    return m_time;
+}
+
+void ClosedReactor::getInitialConditions(doublereal t0, size_t leny,
+                                         doublereal* y)
+{
+    y[0] = m_thermo->temperature();
+    m_thermo->getMassFractions(y + 1);
+}
+
+void ClosedReactor::updateState(const doublereal* y)
+{
+    m_thermo->setMassFractions_NoNorm(y + 1);
+    if (m_constPressure) {
+        m_thermo->setState_TP(y[0], m_pressure);
+    } else {
+        m_thermo->setState_TR(y[0], m_rho);
+    }
+}
+
+void ClosedReactor::eval(doublereal t, doublereal* y,
+                         doublereal* ydot, doublereal* p)
+{
+    updateState(y);
+    m_kin->getNetProductionRates(&m_wdot[0]);
+    const vector_fp& mw = m_thermo->molecularWeights();
+    doublereal rho = m_thermo->density();
+
+    if (m_energy) {
+        // Species enthalpies (constant pressure) or internal energies
+        // (constant volume) of the ideal gas
+        m_thermo->getEnthalpy_RT(&m_ek[0]);
+        doublereal offset = m_constPressure ? 0.0 : 1.0;
+        doublereal heat = 0.0;
+        for (size_t k = 0; k < m_nsp; k++) {
+            heat += (m_ek[k] - offset) * m_wdot[k];
+        }
+        doublereal c = m_constPressure ? m_thermo->cp_mass()
+                                       : m_thermo->cv_mass();
+        ydot[0] = - heat * m_thermo->_RT() / (rho * c);
+    } else {
+        ydot[0] = 0.0;
+    }
+
+    for (size_t k = 0; k < m_nsp; k++) {
+        ydot[k+1] = m_wdot[k] * mw[k] / rho;
+    }
+}
+
+void ClosedReactor::evalJacobian(doublereal t, doublereal* y,
+                                 const doublereal* ydot)
+{
+    m_njac++;
+    m_jacValid = true;
+    std::copy(y, y + m_nv, m_yJac.begin());
+    m_fixedJac = m_constPressure ? m_pressure : m_rho;
+
+    // Derivatives of the net production rates with respect to the species
+    // concentrations, treating the rate constants as independent of the
+    // composition
+    updateState(y);
+    m_thermo->getConcentrations(&m_conc[0]);
+    m_kin->getFwdRateConstants(&m_kf[0]);
+    m_kin->getRevRateConstants(&m_kr[0]);
+    m_dwdc.zero();
+    for (size_t i = 0; i < m_kf.size(); i++) {
+        const std::vector<size_t>& net = m_netIndex[i];
+        const vector_fp& nunet = m_netStoich[i];
+        for (size_t a = 0; a < m_rkIndex[i].size(); a++) {
+            doublereal d = dRateDConc(m_kf[i], a, m_conc, m_rkIndex[i],
+                                      m_rkStoich[i]);
+            size_t j = m_rkIndex[i][a];
+            for (size_t n = 0; n < net.size(); n++) {
+                m_dwdc(net[n], j) += nunet[n] * d;
+            }
+        }
+        for (size_t a = 0; a < m_pkIndex[i].size(); a++) {
+            doublereal d = dRateDConc(m_kr[i], a, m_conc, m_pkIndex[i],
+                                      m_pkStoich[i]);
+            size_t j = m_pkIndex[i][a];
+            for (size_t n = 0; n < net.size(); n++) {
+                m_dwdc(net[n], j) -= nunet[n] * d;
+            }
+        }
+    }
+
+    const vector_fp& mw = m_thermo->molecularWeights();
+    doublereal rho = m_thermo->density();
+    doublereal RT = m_thermo->_RT();
+    doublereal Wmean = m_thermo->meanMolecularWeight();
+    doublereal c = m_constPressure ? m_thermo->cp_mass()
+                                   : m_thermo->cv_mass();
+    doublereal offset = m_constPressure ? 0.0 : 1.0;
+    m_thermo->getEnthalpy_RT(&m_ek[0]);
+    m_thermo->getCp_R(&m_cpk[0]);
+
+    // At constant pressure, the density depends on the composition. m_ydot
+    // holds the change in the production rates per unit relative change in
+    // density at constant composition.
+    if (m_constPressure) {
+        for (size_t m = 0; m < m_nsp; m++) {
+            m_ydot[m] = 0.0;
+            for (size_t k = 0; k < m_nsp; k++) {
+                m_ydot[m] += m_dwdc(m, k) * m_conc[k];
+            }
+        }
+    }
+
+    // Columns for the mass fractions
+    for (size_t j = 0; j < m_nsp; j++) {
+        // relative change in density with respect to Y_j
+        doublereal drho = m_constPressure ? - Wmean / mw[j] : 0.0;
+        doublereal dheat = 0.0;
+        for (size_t m = 0; m < m_nsp; m++) {
+            doublereal dwdot = m_dwdc(m, j) * rho / mw[j] + m_ydot[m] * drho;
+            m_jac(m+1, j+1) = dwdot * mw[m] / rho - ydot[m+1] * drho;
+            dheat += (m_ek[m] - offset) * dwdot;
+        }
+        if (m_energy) {
+            doublereal dc = (m_cpk[j] - offset) * GasConstant / mw[j];
+            m_jac(0, j+1) = - dheat * RT / (rho * c)
+                            - ydot[0] * (drho + dc / c);
+        } else {
+            m_jac(0, j+1) = 0.0;
+        }
+    }
+
+    // Column for the temperature, using a finite difference
+    doublereal T = y[0];
+    doublereal dT = sqrt(DBL_EPSILON) * T;
+    y[0] = T + dT;
+    eval(t, y, &m_ydot[0], 0);
+    y[0] = T;
+    for (size_t m = 0; m < m_nv; m++) {
+        m_jac(m, 0) = (m_ydot[m] - ydot[m]) / dT;
+    }
+}
+
+bool ClosedReactor::preconditionerSetup(double t, double* y, double* ydot,
+                                        bool reuseJacobian, double gamma)
+{
+    bool evaluated = false;
+    if (!reuseJacobian) {
+        if (m_restarted && similarToJacobianState(y)) {
+            // Use the Jacobian from the previous integration. If the
+            // integrator needs a better approximation, it calls again with
+            // `reuseJacobian = false`.
+            m_nreuse++;
+        } else {
+            evalJacobian(t, y, ydot);
+            evaluated = true;
+        }
+    }
+    m_restarted = false;
+
+    // Form and factor M = I - gamma * J
+    for (size_t j = 0; j < m_nv; j++) {
+        for (size_t i = 0; i < m_nv; i++) {
+            m_precon(i, j) = - gamma * m_jac(i, j);
+        }
+        m_precon(j, j) += 1.0;
+    }
+    int info = 0;
+    ct_dgetrf(m_nv, m_nv, m_precon.ptrColumn(0), m_nv, DATA_PTR(m_pivots),
+              info);
+    if (info != 0) {
+        throw CanteraError("ClosedReactor::preconditionerSetup",
+                           "Preconditioner is singular.");
+    }
+    return evaluated;
+}
+
+bool ClosedReactor::similarToJacobianState(const doublereal* y) const
+{
+    if (!m_jacValid || m_reuseTol <= 0.0) {
+        return false;
+    }
+    doublereal fixed = m_constPressure ? m_pressure : m_rho;
+    if (fabs(fixed - m_fixedJac) > m_reuseTol * m_fixedJac ||
+        fabs(y[0] - m_yJac[0]) > m_reuseTol * m_yJac[0]) {
+        return false;
+    }
+    for (size_t k = 1; k < m_nv; k++) {
+        if (fabs(y[k] - m_yJac[k]) > m_reuseTol) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ClosedReactor::preconditionerSolve(const double* rhs, double* output)
+{
+    std::copy(rhs, rhs + m_nv, output);
+    int info = 0;
+    ct_dgetrs(ctlapack::NoTranspose, m_nv, 1, m_precon.ptrColumn(0), m_nv,
+              DATA_PTR(m_pivots), output, m_nv, info);
+}
+
+}
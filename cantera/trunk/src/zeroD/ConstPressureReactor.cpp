@@ -121,6 +121,15 @@ void ConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void ConstPressureReactor::getProductionRateAdjoint(const doublereal* lambda,
+                                                    doublereal* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+2] * m_vol * mw[k] / m_mass;
+    }
+}
+
 size_t ConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
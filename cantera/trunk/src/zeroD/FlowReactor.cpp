@@ -118,6 +118,12 @@ void FlowReactor::evalEqs(doublereal time, doublereal* y,
     }
 }
 
+void FlowReactor::getProductionRateAdjoint(const doublereal* lambda,
+                                           doublereal* mu)
+{
+    throw NotImplementedError("FlowReactor::getProductionRateAdjoint");
+}
+
 size_t FlowReactor::componentIndex(const string& nm) const
 {
     // check for a gas species name
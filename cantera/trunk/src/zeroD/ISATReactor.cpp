@@ -0,0 +1,446 @@
+//! @file ISATReactor.cpp
+#include "cantera/zeroD/ISATReactor.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/numerics/ctlapack.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+//! Number of most recently used records checked when the record found in the
+//! tree does not contain the query point
+const size_t MRU_SIZE = 10;
+
+//! Upper bound on the principal semi-axes of the initial EOA, in the scaled
+//! query space, for directions in which the mapping is insensitive
+const doublereal MAX_EOA_RADIUS = 1.0;
+}
+
+ISATReactor::ISATReactor(ThermoPhase& thermo, Kinetics& kin,
+                         bool constPressure) :
+    ClosedReactor(thermo, kin, constPressure),
+    m_tol(1.0e-4),
+    m_Tscale(1000.0),
+    m_maxRecords(1000),
+    m_checkInterval(0),
+    m_nx(m_nv + 2),
+    m_fixed(0.0),
+    m_nquery(0),
+    m_nretrieve(0),
+    m_ngrow(0),
+    m_nadd(0),
+    m_ndirect(0),
+    m_ncheck(0),
+    m_maxError(0.0),
+    m_sumError(0.0)
+{
+    m_x.resize(m_nx);
+    m_dx.resize(m_nx);
+    m_r.resize(m_nv);
+    m_rcheck.resize(m_nv);
+    m_z.resize(m_nx);
+    m_f.resize(m_nv);
+    m_f1.resize(m_nv);
+    m_work.resize(m_nv, m_nv);
+}
+
+ISATReactor::~ISATReactor()
+{
+    for (size_t i = 0; i < m_records.size(); i++) {
+        delete m_records[i];
+    }
+}
+
+void ISATReactor::setTolerance(doublereal tol)
+{
+    if (tol <= 0.0) {
+        throw CanteraError("ISATReactor::setTolerance",
+                           "Tolerance must be positive.");
+    }
+    m_tol = tol;
+    clear();
+}
+
+void ISATReactor::setTemperatureScale(doublereal Tscale)
+{
+    if (Tscale <= 0.0) {
+        throw CanteraError("ISATReactor::setTemperatureScale",
+                           "Temperature scale must be positive.");
+    }
+    m_Tscale = Tscale;
+    clear();
+}
+
+void ISATReactor::setMaxRecords(size_t n)
+{
+    m_maxRecords = n;
+}
+
+void ISATReactor::setErrorCheckInterval(size_t n)
+{
+    m_checkInterval = n;
+}
+
+void ISATReactor::clear()
+{
+    for (size_t i = 0; i < m_records.size(); i++) {
+        delete m_records[i];
+    }
+    m_records.clear();
+    m_nodes.clear();
+    m_mru.clear();
+    m_nquery = 0;
+    m_nretrieve = 0;
+    m_ngrow = 0;
+    m_nadd = 0;
+    m_ndirect = 0;
+    m_ncheck = 0;
+    m_maxError = 0.0;
+    m_sumError = 0.0;
+}
+
+void ISATReactor::integrateCells(size_t n, doublereal dt, doublereal* T,
+                                 const doublereal* P, doublereal* Y)
+{
+    for (size_t i = 0; i < n; i++) {
+        m_thermo->setState_TPY(T[i], P[i], Y + i * m_nsp);
+        substep(dt);
+        T[i] = m_thermo->temperature();
+        m_thermo->getMassFractions(Y + i * m_nsp);
+    }
+}
+
+void ISATReactor::substep(doublereal dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("ISATReactor::substep",
+                           "Time step must be positive.");
+    }
+    m_nquery++;
+    getQueryPoint(dt);
+    size_t leaf = findLeaf();
+    size_t irec = (leaf == npos) ? npos : m_nodes[leaf].record;
+
+    // Look for a record whose EOA contains the query point, starting with the
+    // one found in the tree
+    size_t iret = npos;
+    if (irec != npos && inEOA(irec)) {
+        iret = irec;
+    } else {
+        for (size_t n = 0; n < m_mru.size(); n++) {
+            if (m_mru[n] != irec && inEOA(m_mru[n])) {
+                iret = m_mru[n];
+                break;
+            }
+        }
+    }
+
+    if (iret != npos) {
+        // Retrieve
+        m_nretrieve++;
+        touch(iret);
+        linearApprox(iret);
+        if (m_checkInterval && m_nretrieve % m_checkInterval == 0) {
+            // The phase is still in the initial state
+            m_rcheck = m_r;
+            integrate(dt);
+            doublereal err = 0.0;
+            for (size_t k = 0; k < m_nv; k++) {
+                err += (m_r[k] - m_rcheck[k]) * (m_r[k] - m_rcheck[k]);
+            }
+            err = sqrt(err);
+            m_ncheck++;
+            m_sumError += err;
+            m_maxError = std::max(m_maxError, err);
+            // The result does not depend on whether it was checked
+            m_r = m_rcheck;
+        }
+        setStateFromScaled(&m_r[0]);
+        return;
+    }
+
+    integrate(dt);
+    if (irec != npos) {
+        // Error of the linear approximation from the record found in the tree
+        m_rcheck = m_r;
+        for (size_t j = 0; j < m_nx; j++) {
+            m_dx[j] = m_x[j] - m_records[irec]->x[j];
+        }
+        linearApprox(irec);
+        doublereal err = 0.0;
+        for (size_t k = 0; k < m_nv; k++) {
+            err += (m_r[k] - m_rcheck[k]) * (m_r[k] - m_rcheck[k]);
+        }
+        m_r = m_rcheck;
+        if (sqrt(err) <= m_tol) {
+            m_ngrow++;
+            grow(irec);
+            return;
+        }
+    }
+    if (m_records.size() < m_maxRecords) {
+        m_nadd++;
+        add(leaf, dt);
+    } else {
+        m_ndirect++;
+    }
+}
+
+void ISATReactor::getQueryPoint(doublereal dt)
+{
+    m_fixed = m_constPressure ? m_thermo->pressure() : m_thermo->density();
+    m_x[0] = m_thermo->temperature() / m_Tscale;
+    m_thermo->getMassFractions(&m_x[1]);
+    m_x[m_nv] = log(m_fixed);
+    m_x[m_nv+1] = log(dt);
+}
+
+size_t ISATReactor::findLeaf() const
+{
+    if (m_nodes.empty()) {
+        return npos;
+    }
+    size_t n = 0;
+    while (m_nodes[n].record == npos) {
+        const Node& node = m_nodes[n];
+        doublereal s = 0.0;
+        for (size_t j = 0; j < m_nx; j++) {
+            s += node.v[j] * m_x[j];
+        }
+        n = (s > node.a) ? node.right : node.left;
+    }
+    return n;
+}
+
+bool ISATReactor::inEOA(size_t i)
+{
+    const Record& rec = *m_records[i];
+    for (size_t j = 0; j < m_nx; j++) {
+        m_dx[j] = m_x[j] - rec.x[j];
+    }
+    doublereal s = 0.0;
+    for (size_t m = 0; m < m_nx; m++) {
+        doublereal z = 0.0;
+        for (size_t j = 0; j < m_nx; j++) {
+            z += rec.G(m, j) * m_dx[j];
+        }
+        s += z * z;
+        if (s > 1.0) {
+            return false;
+        }
+    }
+    return true;
+}
+
+void ISATReactor::linearApprox(size_t i)
+{
+    const Record& rec = *m_records[i];
+    m_r = rec.r;
+    for (size_t j = 0; j < m_nx; j++) {
+        if (m_dx[j] != 0.0) {
+            const doublereal* Aj = rec.A.ptrColumn(j);
+            for (size_t k = 0; k < m_nv; k++) {
+                m_r[k] += Aj[k] * m_dx[j];
+            }
+        }
+    }
+}
+
+void ISATReactor::integrate(doublereal dt)
+{
+    setInitialTime(0.0);
+    advance(dt);
+    m_r[0] = m_thermo->temperature() / m_Tscale;
+    m_thermo->getMassFractions(&m_r[1]);
+}
+
+void ISATReactor::setStateFromScaled(const doublereal* r)
+{
+    // The linear approximation may give small negative mass fractions
+    m_thermo->setMassFractions(r + 1);
+    if (m_constPressure) {
+        m_thermo->setState_TP(r[0] * m_Tscale, m_fixed);
+    } else {
+        m_thermo->setState_TR(r[0] * m_Tscale, m_fixed);
+    }
+}
+
+void ISATReactor::grow(size_t i)
+{
+    // Rank-one modification of G which maps the query point onto the
+    // boundary of the EOA, and which only shrinks G in the direction of
+    // G (x - x0), so that the grown EOA contains the original one.
+    Record& rec = *m_records[i];
+    doublereal r = 0.0;
+    for (size_t m = 0; m < m_nx; m++) {
+        m_z[m] = 0.0;
+        for (size_t j = 0; j < m_nx; j++) {
+            m_z[m] += rec.G(m, j) * m_dx[j];
+        }
+        r += m_z[m] * m_z[m];
+    }
+    r = sqrt(r);
+    if (r <= 1.0) {
+        return;
+    }
+    for (size_t m = 0; m < m_nx; m++) {
+        m_z[m] /= r;
+    }
+    doublereal c = 1.0 - 1.0 / r;
+    for (size_t j = 0; j < m_nx; j++) {
+        doublereal w = 0.0;
+        for (size_t m = 0; m < m_nx; m++) {
+            w += m_z[m] * rec.G(m, j);
+        }
+        for (size_t m = 0; m < m_nx; m++) {
+            rec.G(m, j) -= c * m_z[m] * w;
+        }
+    }
+}
+
+void ISATReactor::add(size_t leaf, doublereal dt)
+{
+    Record* rec = new Record();
+    rec->x = m_x;
+    rec->r = m_r;
+
+    // Right hand side and Jacobian at the final state, which is the current
+    // state of the phase
+    getInitialConditions(0.0, m_nv, &m_ydot[0]);
+    vector_fp y(m_ydot.begin(), m_ydot.end());
+    eval(0.0, &y[0], &m_f[0], 0);
+    evalJacobian(0.0, &y[0], &m_f[0]);
+
+    // Derivative of the right hand side with respect to ln(P) or ln(rho)
+    doublereal& fixed = m_constPressure ? m_pressure : m_rho;
+    doublereal fixed0 = fixed;
+    doublereal h = sqrt(DBL_EPSILON);
+    fixed = fixed0 * (1.0 + h);
+    eval(0.0, &y[0], &m_f1[0], 0);
+    fixed = fixed0;
+    updateState(&y[0]);
+
+    // Mapping gradient from an implicit Euler step,
+    // (I - dt J) dR = dR0 + dt df/dlnF dlnF, in terms of the unscaled state
+    for (size_t j = 0; j < m_nv; j++) {
+        for (size_t i = 0; i < m_nv; i++) {
+            m_work(i, j) = - dt * m_jac(i, j);
+        }
+        m_work(j, j) += 1.0;
+    }
+    int info = 0;
+    ct_dgetrf(m_nv, m_nv, m_work.ptrColumn(0), m_nv, DATA_PTR(m_pivots),
+              info);
+    if (info != 0) {
+        delete rec;
+        throw CanteraError("ISATReactor::add",
+                           "Singular matrix in mapping gradient.");
+    }
+    Array2D& A = rec->A;
+    A.resize(m_nv, m_nx, 0.0);
+    A(0, 0) = m_Tscale;
+    for (size_t j = 1; j < m_nv; j++) {
+        A(j, j) = 1.0;
+    }
+    for (size_t i = 0; i < m_nv; i++) {
+        A(i, m_nv) = dt * (m_f1[i] - m_f[i]) / h;
+    }
+    ct_dgetrs(ctlapack::NoTranspose, m_nv, m_nv + 1, m_work.ptrColumn(0),
+              m_nv, DATA_PTR(m_pivots), A.ptrColumn(0), m_nv, info);
+
+    // The derivative with respect to ln(dt) is exact
+    for (size_t i = 0; i < m_nv; i++) {
+        A(i, m_nv+1) = dt * m_f[i];
+    }
+    for (size_t j = 0; j < m_nx; j++) {
+        A(0, j) /= m_Tscale;
+    }
+
+    // Initial EOA, where |A (x - x0)| <= tol, bounded in the directions where
+    // the mapping is insensitive: E = A^T A / tol^2 + I / rmax^2 = G^T G
+    Array2D& G = rec->G;
+    G.resize(m_nx, m_nx, 0.0);
+    doublereal s = 1.0 / (m_tol * m_tol);
+    for (size_t j = 0; j < m_nx; j++) {
+        for (size_t i = 0; i <= j; i++) {
+            doublereal e = 0.0;
+            for (size_t k = 0; k < m_nv; k++) {
+                e += A(k, i) * A(k, j);
+            }
+            G(i, j) = s * e;
+        }
+        G(j, j) += 1.0 / (MAX_EOA_RADIUS * MAX_EOA_RADIUS);
+    }
+    ct_dpotrf(ctlapack::UpperTriangular, m_nx, G.ptrColumn(0), m_nx, info);
+    if (info != 0) {
+        delete rec;
+        throw CanteraError("ISATReactor::add",
+                           "Cholesky factorization of EOA failed.");
+    }
+
+    size_t irec = m_records.size();
+    m_records.push_back(rec);
+    touch(irec);
+
+    Node node;
+    node.a = 0.0;
+    node.left = npos;
+    node.right = npos;
+    node.record = irec;
+    if (leaf == npos) {
+        m_nodes.push_back(node);
+        return;
+    }
+
+    // Replace the leaf with a node whose cutting plane is the perpendicular
+    // bisector of the old and new query points
+    size_t iold = m_nodes[leaf].record;
+    const vector_fp& xold = m_records[iold]->x;
+    Node& split = m_nodes[leaf];
+    split.v.resize(m_nx);
+    split.a = 0.0;
+    for (size_t j = 0; j < m_nx; j++) {
+        split.v[j] = m_x[j] - xold[j];
+        split.a += 0.5 * split.v[j] * (m_x[j] + xold[j]);
+    }
+    split.record = npos;
+    split.left = m_nodes.size();
+    split.right = m_nodes.size() + 1;
+    m_nodes.push_back(node);
+    m_nodes.back().record = iold;
+    m_nodes.push_back(node);
+}
+
+void ISATReactor::touch(size_t i)
+{
+    vector<size_t>::iterator iter = find(m_mru.begin(), m_mru.end(), i);
+    if (iter != m_mru.end()) {
+        m_mru.erase(iter);
+    }
+    m_mru.insert(m_mru.begin(), i);
+    if (m_mru.size() > MRU_SIZE) {
+        m_mru.resize(MRU_SIZE);
+    }
+}
+
+size_t ISATReactor::treeDepth() const
+{
+    return m_nodes.empty() ? 0 : depth(0);
+}
+
+size_t ISATReactor::depth(size_t node) const
+{
+    const Node& n = m_nodes[node];
+    if (n.record != npos) {
+        return 1;
+    }
+    return 1 + std::max(depth(n.left), depth(n.right));
+}
+
+}
@@ -133,6 +133,20 @@ void IdealGasConstPressureReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasConstPressureReactor::getProductionRateAdjoint(
+    const doublereal* lambda, doublereal* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double dTdH = 0.0;
+    if (m_energy) {
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        dTdH = lambda[1] / m_thermo->cp_mass();
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k+2] * mw[k] - dTdH * m_hk[k]) * m_vol / m_mass;
+    }
+}
+
 size_t IdealGasConstPressureReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -150,6 +150,20 @@ void IdealGasReactor::evalEqs(doublereal time, doublereal* y,
     resetSensitivity(params);
 }
 
+void IdealGasReactor::getProductionRateAdjoint(const doublereal* lambda,
+                                               doublereal* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    double dTdU = 0.0;
+    if (m_energy) {
+        m_thermo->getPartialMolarIntEnergies(&m_uk[0]);
+        dTdU = lambda[2] / m_thermo->cv_mass();
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = (lambda[k+3] * mw[k] - dTdU * m_uk[k]) * m_vol / m_mass;
+    }
+}
+
 size_t IdealGasReactor::componentIndex(const string& nm) const
 {
     size_t k = speciesIndex(nm);
@@ -0,0 +1,482 @@
+//! @file PlugFlowReactor.cpp
+#include "cantera/zeroD/PlugFlowReactor.h"
+#include "cantera/thermo/ThermoPhase.h"
+#include "cantera/thermo/SurfPhase.h"
+#include "cantera/kinetics/InterfaceKinetics.h"
+#include "cantera/numerics/DAE_Solver.h"
+#include "cantera/numerics/ctlapack.h"
+
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+namespace
+{
+//! Relative and absolute perturbations used for the finite difference
+//! Jacobian, as in MultiJac
+const doublereal JacRelPerturb = 1.0e-5;
+const doublereal JacAbsPerturb = sqrt(DBL_EPSILON);
+}
+
+PlugFlowReactor::PlugFlowReactor(ThermoPhase& thermo, Kinetics& kin) :
+    m_thermo(&thermo),
+    m_kin(&kin),
+    m_solver(0),
+    m_nsp(thermo.nSpecies()),
+    m_area(1.0),
+    m_sv(0.0),
+    m_mdot(0.0),
+    m_energy(true),
+    m_init(false),
+    m_z(0.0),
+    m_rtol(1.0e-9),
+    m_maxstep(-1.0),
+    m_njac(0),
+    m_cp(0.0),
+    m_qsurf(0.0)
+{
+    if (thermo.eosType() != cIdealGas) {
+        throw CanteraError("PlugFlowReactor::PlugFlowReactor",
+                           "Incompatible phase type provided");
+    }
+    if (kin.nPhases() != 1 || &kin.thermo(0) != &thermo) {
+        throw CanteraError("PlugFlowReactor::PlugFlowReactor",
+                           "Kinetics manager is not defined on the phase");
+    }
+    m_atol = 1.0e-15;
+    neq_ = static_cast<int>(m_nsp + 4);
+    m_wdot.resize(m_nsp, 0.0);
+    m_hk.resize(m_nsp, 0.0);
+    m_sdotGas.resize(m_nsp, 0.0);
+}
+
+PlugFlowReactor::~PlugFlowReactor()
+{
+    delete m_solver;
+}
+
+void PlugFlowReactor::addSurface(InterfaceKinetics& kin)
+{
+    size_t n = kin.surfacePhaseIndex();
+    if (n == npos) {
+        throw CanteraError("PlugFlowReactor::addSurface",
+                           "specified surface kinetics manager does not "
+                           "represent a surface reaction mechanism.");
+    }
+    if (&kin.thermo(0) != m_thermo) {
+        throw CanteraError("PlugFlowReactor::addSurface",
+                           "First phase of the surface kinetics manager "
+                           "must be the gas.");
+    }
+    SurfPhase* surf = dynamic_cast<SurfPhase*>(&kin.thermo(n));
+    if (!surf) {
+        throw CanteraError("PlugFlowReactor::addSurface",
+                           "Surface phase is not a SurfPhase");
+    }
+    m_surf.push_back(&kin);
+    m_surfPhase.push_back(surf);
+    m_surfStart.push_back(neq_);
+    m_surfLoc.push_back(kin.kineticsSpeciesIndex(0, n));
+    m_sdot.push_back(vector_fp(kin.nTotalSpecies(), 0.0));
+    m_hs.push_back(vector_fp(kin.nTotalSpecies(), 0.0));
+    neq_ += static_cast<int>(surf->nSpecies());
+    m_init = false;
+}
+
+void PlugFlowReactor::setArea(doublereal area)
+{
+    if (area <= 0.0) {
+        throw CanteraError("PlugFlowReactor::setArea",
+                           "Area must be positive");
+    }
+    m_area = area;
+    m_init = false;
+}
+
+void PlugFlowReactor::setSurfaceAreaToVolumeRatio(doublereal sv)
+{
+    if (sv < 0.0) {
+        throw CanteraError("PlugFlowReactor::setSurfaceAreaToVolumeRatio",
+                           "Surface area to volume ratio must not be "
+                           "negative");
+    }
+    m_sv = sv;
+    m_init = false;
+}
+
+void PlugFlowReactor::setMassFlowRate(doublereal mdot)
+{
+    if (mdot <= 0.0) {
+        throw CanteraError("PlugFlowReactor::setMassFlowRate",
+                           "Mass flow rate must be positive");
+    }
+    m_mdot = mdot;
+    m_init = false;
+}
+
+doublereal PlugFlowReactor::massFlowRate() const
+{
+    if (m_y.empty()) {
+        return m_mdot;
+    }
+    return m_y[0] * m_y[1] * m_area;
+}
+
+void PlugFlowReactor::setEnergy(bool energy)
+{
+    m_energy = energy;
+    m_init = false;
+}
+
+void PlugFlowReactor::setTolerances(doublereal rtol, doublereal atol)
+{
+    if (rtol >= 0.0) {
+        m_rtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_atol = atol;
+    }
+    m_init = false;
+}
+
+void PlugFlowReactor::setMaxStepSize(doublereal dzmax)
+{
+    m_maxstep = dzmax;
+    m_init = false;
+}
+
+doublereal PlugFlowReactor::speed() const
+{
+    if (m_y.empty()) {
+        return m_mdot / (m_thermo->density() * m_area);
+    }
+    return m_y[0];
+}
+
+const doublereal* PlugFlowReactor::solution() const
+{
+    if (m_y.empty()) {
+        throw CanteraError("PlugFlowReactor::solution",
+                           "Reactor is not initialized");
+    }
+    return &m_y[0];
+}
+
+size_t PlugFlowReactor::componentIndex(const std::string& name) const
+{
+    size_t k = m_thermo->speciesIndex(name);
+    if (k != npos) {
+        return k + 4;
+    } else if (name == "velocity") {
+        return 0;
+    } else if (name == "density") {
+        return 1;
+    } else if (name == "pressure") {
+        return 2;
+    } else if (name == "temperature") {
+        return 3;
+    }
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        k = m_surfPhase[i]->speciesIndex(name);
+        if (k != npos) {
+            return m_surfStart[i] + k;
+        }
+    }
+    return npos;
+}
+
+void PlugFlowReactor::initialize(doublereal z0)
+{
+    if (m_mdot <= 0.0) {
+        throw CanteraError("PlugFlowReactor::initialize",
+                           "Mass flow rate has not been set");
+    }
+    m_z = z0;
+    m_njac = 0;
+    m_y.resize(neq_);
+    m_ywork.resize(neq_);
+    m_rwork.resize(neq_);
+    m_icMatrix.resize(m_nsp + 4, m_nsp + 4);
+    m_pivots.resize(m_nsp + 4);
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        for (size_t k = 0; k < m_surfPhase[i]->nSpecies(); k++) {
+            setAlgebraic(static_cast<int>(m_surfStart[i] + k));
+        }
+    }
+
+    delete m_solver;
+    m_solver = 0;
+    m_solver = newDAE_Solver("IDA", *this);
+    m_solver->setTolerances(m_rtol, m_atol);
+    m_solver->setJacobianType(1);
+    if (m_maxstep > 0.0) {
+        m_solver->setMaxStepSize(m_maxstep);
+    }
+    m_solver->init(z0);
+    copy(m_solver->solutionVector(), m_solver->solutionVector() + neq_,
+         m_y.begin());
+    m_init = true;
+}
+
+void PlugFlowReactor::advance(doublereal z)
+{
+    if (!m_init) {
+        initialize(m_z);
+    }
+    m_solver->solve(z);
+    m_z = z;
+    copy(m_solver->solutionVector(), m_solver->solutionVector() + neq_,
+         m_y.begin());
+    updateState(&m_y[0]);
+}
+
+void PlugFlowReactor::updateState(const doublereal* y)
+{
+    m_thermo->setMassFractions_NoNorm(y + 4);
+    m_thermo->setState_TR(y[3], y[1]);
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        m_surfPhase[i]->setTemperature(y[3]);
+        m_surfPhase[i]->setCoveragesNoNorm(y + m_surfStart[i]);
+    }
+}
+
+void PlugFlowReactor::updateRates(bool gas)
+{
+    if (gas) {
+        m_kin->getNetProductionRates(&m_wdot[0]);
+        m_thermo->getPartialMolarEnthalpies(&m_hk[0]);
+        m_cp = m_thermo->cp_mass();
+    }
+
+    fill(m_sdotGas.begin(), m_sdotGas.end(), 0.0);
+    m_qsurf = 0.0;
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        InterfaceKinetics* kin = m_surf[i];
+        vector_fp& sdot = m_sdot[i];
+        vector_fp& hs = m_hs[i];
+        kin->getNetProductionRates(&sdot[0]);
+        for (size_t k = 0; k < m_nsp; k++) {
+            m_sdotGas[k] += sdot[k];
+        }
+        if (m_energy) {
+            std::copy(m_hk.begin(), m_hk.end(), hs.begin());
+            for (size_t n = 1; n < kin->nPhases(); n++) {
+                kin->thermo(n).getPartialMolarEnthalpies(
+                    &hs[kin->kineticsSpeciesIndex(0, n)]);
+            }
+            for (size_t k = 0; k < sdot.size(); k++) {
+                m_qsurf -= sdot[k] * hs[k];
+            }
+        }
+    }
+}
+
+void PlugFlowReactor::evalResid(const doublereal* y, const doublereal* ydot,
+                                doublereal* r) const
+{
+    doublereal u = y[0];
+    doublereal rho = y[1];
+    doublereal P = y[2];
+    doublereal T = y[3];
+    const doublereal* Y = y + 4;
+    const vector_fp& mw = m_thermo->molecularWeights();
+
+    // net mass production rate from the surfaces per unit volume
+    doublereal Sdot = 0.0;
+    doublereal sumYoverW = 0.0;
+    doublereal heat = 0.0;
+    for (size_t k = 0; k < m_nsp; k++) {
+        Sdot += m_sdotGas[k] * mw[k];
+        sumYoverW += Y[k] / mw[k];
+        heat += m_hk[k] * m_wdot[k];
+    }
+    Sdot *= m_sv;
+
+    // continuity
+    r[0] = u * ydot[1] + rho * ydot[0] - Sdot;
+
+    // momentum
+    r[1] = rho * u * ydot[0] + ydot[2] + u * Sdot;
+
+    // equation of state
+    r[2] = P - rho * GasConstant * T * sumYoverW;
+
+    // energy
+    if (m_energy) {
+        r[3] = rho * u * (m_cp * ydot[3] + u * ydot[0])
+               + 0.5 * u * u * Sdot + heat - m_sv * m_qsurf;
+    } else {
+        r[3] = ydot[3];
+    }
+
+    // gas phase species
+    for (size_t k = 0; k < m_nsp; k++) {
+        r[k+4] = rho * u * ydot[k+4] + Y[k] * Sdot
+                 - mw[k] * (m_wdot[k] + m_sv * m_sdotGas[k]);
+    }
+
+    // surface species, scaled to rates of change of the coverages
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        SurfPhase* surf = m_surfPhase[i];
+        const doublereal* sdot = &m_sdot[i][m_surfLoc[i]];
+        const doublereal* theta = y + m_surfStart[i];
+        doublereal* rs = r + m_surfStart[i];
+        doublereal rs0 = 1.0 / surf->siteDensity();
+        doublereal sum = 0.0;
+        for (size_t k = 0; k < surf->nSpecies(); k++) {
+            rs[k] = sdot[k] * rs0 * surf->size(k);
+            sum += theta[k];
+        }
+        rs[0] = sum - 1.0;
+    }
+}
+
+int PlugFlowReactor::evalResidNJ(const doublereal t, const doublereal delta_t,
+                                 const doublereal* const y,
+                                 const doublereal* const ydot,
+                                 doublereal* const resid,
+                                 const ResidEval_Type_Enum evalType,
+                                 const int id_x, const doublereal delta_x)
+{
+    updateState(y);
+    updateRates(true);
+    evalResid(y, ydot, resid);
+    return 1;
+}
+
+int PlugFlowReactor::getInitialConditions(const doublereal t0,
+                                          doublereal* const y,
+                                          doublereal* const ydot)
+{
+    doublereal rho = m_thermo->density();
+    doublereal T = m_thermo->temperature();
+    y[0] = m_mdot / (rho * m_area);
+    y[1] = rho;
+    y[2] = m_thermo->pressure();
+    y[3] = T;
+    m_thermo->getMassFractions(y + 4);
+    for (size_t i = 0; i < m_surf.size(); i++) {
+        m_surfPhase[i]->setTemperature(T);
+        m_surf[i]->solvePseudoSteadyStateProblem();
+        m_surfPhase[i]->getCoverages(y + m_surfStart[i]);
+    }
+
+    // The residual is linear in ydot. With ydot = 0, the negative of the
+    // residual is the right hand side for the derivatives of the
+    // differential equations, and the algebraic equation of state is
+    // replaced by its derivative. The coverages are algebraic, and their
+    // derivatives are set to zero.
+    size_t n = m_nsp + 4;
+    fill(ydot, ydot + neq_, 0.0);
+    updateState(y);
+    updateRates(true);
+    evalResid(y, ydot, &m_rwork[0]);
+
+    doublereal u = y[0];
+    doublereal P = y[2];
+    doublereal cp = m_thermo->cp_mass();
+    const vector_fp& mw = m_thermo->molecularWeights();
+    m_icMatrix.zero();
+    for (size_t i = 0; i < n; i++) {
+        ydot[i] = - m_rwork[i];
+    }
+    m_icMatrix(0, 0) = rho;
+    m_icMatrix(0, 1) = u;
+    m_icMatrix(1, 0) = rho * u;
+    m_icMatrix(1, 2) = 1.0;
+    ydot[2] = 0.0;
+    m_icMatrix(2, 1) = - P / rho;
+    m_icMatrix(2, 2) = 1.0;
+    m_icMatrix(2, 3) = - P / T;
+    for (size_t k = 0; k < m_nsp; k++) {
+        m_icMatrix(2, k+4) = - rho * GasConstant * T / mw[k];
+        m_icMatrix(k+4, k+4) = rho * u;
+    }
+    if (m_energy) {
+        m_icMatrix(3, 0) = rho * u * u;
+        m_icMatrix(3, 3) = rho * u * cp;
+    } else {
+        m_icMatrix(3, 3) = 1.0;
+    }
+
+    int info = 0;
+    ct_dgetrf(n, n, m_icMatrix.ptrColumn(0), n, DATA_PTR(m_pivots), info);
+    if (info == 0) {
+        ct_dgetrs(ctlapack::NoTranspose, n, 1, m_icMatrix.ptrColumn(0), n,
+                  DATA_PTR(m_pivots), ydot, n, info);
+    }
+    if (info != 0) {
+        throw CanteraError("PlugFlowReactor::getInitialConditions",
+                           "Could not compute the initial derivatives");
+    }
+    return 1;
+}
+
+void PlugFlowReactor::jacobianColumn(size_t j, bool gas, const doublereal* y,
+                                     const doublereal* ydot,
+                                     const doublereal* resid,
+                                     doublereal* col)
+{
+    doublereal ysave = m_ywork[j];
+    doublereal dy = JacAbsPerturb + JacRelPerturb * fabs(ysave);
+    m_ywork[j] = ysave + dy;
+    updateState(&m_ywork[0]);
+    updateRates(gas);
+    evalResid(&m_ywork[0], ydot, &m_rwork[0]);
+    for (int i = 0; i < neq_; i++) {
+        col[i] = (m_rwork[i] - resid[i]) / dy;
+    }
+    m_ywork[j] = ysave;
+}
+
+int PlugFlowReactor::evalJacobianDP(const doublereal t,
+                                    const doublereal delta_t, doublereal cj,
+                                    const doublereal* const y,
+                                    const doublereal* const ydot,
+                                    doublereal* const* jacobianColPts,
+                                    doublereal* const resid)
+{
+    m_njac++;
+    updateState(y);
+    updateRates(true);
+    evalResid(y, ydot, resid);
+    copy(y, y + neq_, m_ywork.begin());
+    doublereal u = y[0];
+    doublereal rho = y[1];
+    doublereal cp = m_cp;
+
+    // Columns which do not affect the gas phase rates, using the gas phase
+    // rates and properties of the unperturbed state
+    jacobianColumn(0, false, y, ydot, resid, jacobianColPts[0]);
+    jacobianColumn(2, false, y, ydot, resid, jacobianColPts[2]);
+    for (size_t j = m_nsp + 4; j < (size_t) neq_; j++) {
+        jacobianColumn(j, false, y, ydot, resid, jacobianColPts[j]);
+    }
+
+    // Columns which affect all rates
+    jacobianColumn(1, true, y, ydot, resid, jacobianColPts[1]);
+    for (size_t j = 3; j < m_nsp + 4; j++) {
+        jacobianColumn(j, true, y, ydot, resid, jacobianColPts[j]);
+    }
+
+    // Derivatives with respect to ydot
+    jacobianColPts[0][0] += cj * rho;
+    jacobianColPts[1][0] += cj * u;
+    jacobianColPts[0][1] += cj * rho * u;
+    jacobianColPts[2][1] += cj;
+    if (m_energy) {
+        jacobianColPts[0][3] += cj * rho * u * u;
+        jacobianColPts[3][3] += cj * rho * u * cp;
+    } else {
+        jacobianColPts[3][3] += cj;
+    }
+    for (size_t k = 0; k < m_nsp; k++) {
+        jacobianColPts[k+4][k+4] += cj * rho * u;
+    }
+    return 1;
+}
+
+}
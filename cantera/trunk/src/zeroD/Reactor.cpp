@@ -74,6 +74,8 @@ void Reactor::initialize(doublereal t0)
     m_thermo->restoreState(m_state);
     m_sdot.resize(m_nsp, 0.0);
     m_wdot.resize(m_nsp, 0.0);
+    m_mu_adj.resize(m_nsp, 0.0);
+    m_rop.resize(nReactions(), 0.0);
     m_nv = m_nsp + 3;
     for (size_t w = 0; w < m_wall.size(); w++)
         if (m_wall[w]->surface(m_lr[w])) {
@@ -392,6 +394,34 @@ size_t Reactor::componentIndex(const string& nm) const
     }
 }
 
+void Reactor::evalReactionAdjoint(const doublereal* lambda, doublereal* dfdk)
+{
+    size_t nr = nReactions();
+    if (!m_chem) {
+        std::fill(dfdk, dfdk + nr, 0.0);
+        return;
+    }
+    m_thermo->restoreState(m_state);
+
+    // The rate multiplier of reaction i scales its net rate of progress, so
+    // d(ydot)/dk_i = d(ydot)/d(wdot) * nu_i * q_i
+    getProductionRateAdjoint(lambda, DATA_PTR(m_mu_adj));
+    m_kin->getReactionDelta(DATA_PTR(m_mu_adj), dfdk);
+    m_kin->getNetRatesOfProgress(DATA_PTR(m_rop));
+    for (size_t i = 0; i < nr; i++) {
+        dfdk[i] *= m_rop[i];
+    }
+}
+
+void Reactor::getProductionRateAdjoint(const doublereal* lambda,
+                                       doublereal* mu)
+{
+    const vector_fp& mw = m_thermo->molecularWeights();
+    for (size_t k = 0; k < m_nsp; k++) {
+        mu[k] = lambda[k+3] * m_vol * mw[k] / m_mass;
+    }
+}
+
 void Reactor::applySensitivity(double* params)
 {
     if (!params) {
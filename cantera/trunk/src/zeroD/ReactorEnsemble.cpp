@@ -0,0 +1,239 @@
+//! @file ReactorEnsemble.cpp
+#include "cantera/zeroD/ReactorEnsemble.h"
+#include "cantera/zeroD/ClosedReactor.h"
+#include "cantera/thermo/ThermoFactory.h"
+#include "cantera/kinetics/KineticsFactory.h"
+#include "cantera/base/global.h"
+#include "cantera/base/xml.h"
+
+#include <limits>
+
+#ifdef THREAD_SAFE_CANTERA
+#include <boost/thread/thread.hpp>
+#include <boost/bind.hpp>
+#endif
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorEnsemble::ReactorEnsemble(const std::string& infile,
+                                 const std::string& id, size_t nThreads) :
+    m_nsp(0),
+    m_constPressure(false),
+    m_energy(true),
+    m_rtol(1.0e-9),
+    m_atol(1.0e-15),
+    m_maxstep(-1.0),
+    m_next(0),
+    m_blockSize(1),
+    m_nfail(0)
+{
+#ifdef THREAD_SAFE_CANTERA
+    if (nThreads == 0) {
+        nThreads = std::max(boost::thread::hardware_concurrency(), 1u);
+    }
+#else
+    nThreads = 1;
+#endif
+
+    // All of the objects are created here, in the calling thread, so that the
+    // input file is only read and parsed once.
+    XML_Node* root = get_XML_File(infile);
+    XML_Node* xphase = get_XML_NameID("phase", "#" + id, root);
+    if (!xphase) {
+        throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+                           "Couldn't find phase named \"" + id +
+                           "\" in file " + infile);
+    }
+
+    m_workers.resize(nThreads);
+    try {
+        for (size_t i = 0; i < nThreads; i++) {
+            Worker& w = m_workers[i];
+            w.thermo = newPhase(*xphase);
+            if (w.thermo->eosType() != cIdealGas) {
+                throw CanteraError("ReactorEnsemble::ReactorEnsemble",
+                                   "Phase '" + id + "' is not an ideal gas");
+            }
+            std::vector<ThermoPhase*> phases(1, w.thermo);
+            w.kin = newKineticsMgr(*xphase, phases);
+            setupReactor(w);
+        }
+    } catch (...) {
+        // The destructor is not called if the constructor throws
+        deleteWorkers();
+        throw;
+    }
+    m_nsp = m_workers[0].thermo->nSpecies();
+}
+
+ReactorEnsemble::~ReactorEnsemble()
+{
+    deleteWorkers();
+}
+
+void ReactorEnsemble::deleteWorkers()
+{
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        delete m_workers[i].reactor;
+        delete m_workers[i].kin;
+        delete m_workers[i].thermo;
+    }
+    m_workers.clear();
+}
+
+void ReactorEnsemble::setupReactor(Worker& w)
+{
+    delete w.reactor;
+    w.reactor = new ClosedReactor(*w.thermo, *w.kin, m_constPressure);
+    w.reactor->setEnergy(m_energy);
+    w.reactor->setTolerances(m_rtol, m_atol);
+    if (m_maxstep > 0.0) {
+        w.reactor->setMaxTimeStep(m_maxstep);
+    }
+}
+
+void ReactorEnsemble::setConstantPressure(bool cp)
+{
+    m_constPressure = cp;
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        setupReactor(m_workers[i]);
+    }
+}
+
+void ReactorEnsemble::setEnergy(bool energy)
+{
+    m_energy = energy;
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        m_workers[i].reactor->setEnergy(energy);
+    }
+}
+
+void ReactorEnsemble::setTolerances(doublereal rtol, doublereal atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        m_workers[i].reactor->setTolerances(rtol, atol);
+    }
+}
+
+void ReactorEnsemble::setMaxTimeStep(doublereal maxstep)
+{
+    m_maxstep = maxstep;
+    for (size_t i = 0; i < m_workers.size(); i++) {
+        m_workers[i].reactor->setMaxTimeStep(maxstep);
+    }
+}
+
+void ReactorEnsemble::integrate(size_t n, const doublereal* T,
+                                const doublereal* P, const doublereal* Y,
+                                doublereal tEnd, doublereal* states)
+{
+    integrate(n, T, P, Y, 1, &tEnd, states);
+}
+
+void ReactorEnsemble::integrate(size_t n, const doublereal* T,
+                                const doublereal* P, const doublereal* Y,
+                                size_t nTimes, const doublereal* times,
+                                doublereal* states)
+{
+    if (nTimes == 0 || times[0] <= 0.0) {
+        throw CanteraError("ReactorEnsemble::integrate",
+                           "Output times must be positive");
+    }
+    for (size_t j = 1; j < nTimes; j++) {
+        if (times[j] <= times[j-1]) {
+            throw CanteraError("ReactorEnsemble::integrate",
+                               "Output times must be increasing");
+        }
+    }
+
+    m_task.n = n;
+    m_task.T = T;
+    m_task.P = P;
+    m_task.Y = Y;
+    m_task.nTimes = nTimes;
+    m_task.times = times;
+    m_task.states = states;
+    m_next = 0;
+    m_nfail = 0;
+    m_firstError = "";
+
+    // Claim cases in blocks small enough that the load stays balanced when
+    // some cases take much longer than others, but large enough that the
+    // shared counter is not contended.
+    m_blockSize = std::max<size_t>(n / (16 * m_workers.size()), 1);
+
+#ifdef THREAD_SAFE_CANTERA
+    if (m_workers.size() > 1) {
+        boost::thread_group threads;
+        for (size_t i = 1; i < m_workers.size(); i++) {
+            threads.create_thread(boost::bind(&ReactorEnsemble::run, this, i));
+        }
+        run(0);
+        threads.join_all();
+        return;
+    }
+#endif
+    run(0);
+}
+
+bool ReactorEnsemble::nextBlock(size_t& begin, size_t& end)
+{
+    ScopedLock lock(m_mutex);
+    if (m_next >= m_task.n) {
+        return false;
+    }
+    begin = m_next;
+    end = std::min(m_next + m_blockSize, m_task.n);
+    m_next = end;
+    return true;
+}
+
+void ReactorEnsemble::run(size_t iworker)
+{
+    Worker& w = m_workers[iworker];
+    size_t begin, end;
+    while (nextBlock(begin, end)) {
+        for (size_t i = begin; i < end; i++) {
+            integrateOne(w, i);
+        }
+    }
+#ifdef THREAD_SAFE_CANTERA
+    if (iworker != 0) {
+        thread_complete();
+    }
+#endif
+}
+
+void ReactorEnsemble::integrateOne(Worker& w, size_t i)
+{
+    size_t nState = stateSize();
+    doublereal* out = m_task.states + i * m_task.nTimes * nState;
+    try {
+        w.thermo->setState_TPY(m_task.T[i], m_task.P[i],
+                               m_task.Y + i * m_nsp);
+        w.reactor->setInitialTime(0.0);
+        for (size_t j = 0; j < m_task.nTimes; j++) {
+            w.reactor->advance(m_task.times[j]);
+            doublereal* row = out + j * nState;
+            row[0] = w.thermo->temperature();
+            row[1] = w.thermo->pressure();
+            w.thermo->getMassFractions(row + 2);
+        }
+    } catch (CanteraError& err) {
+        popError();
+        std::fill(out, out + m_task.nTimes * nState,
+                  std::numeric_limits<doublereal>::quiet_NaN());
+        ScopedLock lock(m_mutex);
+        if (m_nfail == 0) {
+            m_firstError = err.what();
+        }
+        m_nfail++;
+    }
+}
+
+}
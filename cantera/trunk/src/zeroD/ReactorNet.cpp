@@ -2,20 +2,77 @@
 #include "cantera/zeroD/ReactorNet.h"
 #include "cantera/zeroD/FlowDevice.h"
 #include "cantera/zeroD/Wall.h"
+#include "cantera/zeroD/flowControllers.h"
+#include "cantera/numerics/ctlapack.h"
 
 #include <cstdio>
+#include <set>
 
 using namespace std;
 
 namespace Cantera
 {
 
+namespace
+{
+
+//! Time interval over which no component of the state changes by more than
+//! the fraction *rel*, used to differentiate quantities along the trajectory.
+//! Components smaller than 1e-6 (e.g. minor species) are not considered.
+doublereal timePerturbation(const doublereal* y, const doublereal* ydot,
+                            size_t n, doublereal rel)
+{
+    doublereal rmax = 0.0;
+    for (size_t i = 0; i < n; i++) {
+        rmax = std::max(rmax, fabs(ydot[i]) / std::max(fabs(y[i]), 1e-6));
+    }
+    return (rmax > 0.0) ? rel / rmax : 0.0;
+}
+
+//! Mark all reactors in *group* which are part of the network as depending
+//! on each other.
+void couple(std::vector<std::set<size_t> >& coupled,
+            const std::map<const ReactorBase*, size_t>& index,
+            const std::vector<const ReactorBase*>& group)
+{
+    for (size_t i = 0; i < group.size(); i++) {
+        std::map<const ReactorBase*, size_t>::const_iterator a =
+            index.find(group[i]);
+        if (a == index.end()) {
+            continue; // e.g. a Reservoir
+        }
+        for (size_t j = 0; j < group.size(); j++) {
+            std::map<const ReactorBase*, size_t>::const_iterator b =
+                index.find(group[j]);
+            if (b != index.end()) {
+                coupled[a->second].insert(b->second);
+            }
+        }
+    }
+}
+
+//! @name Parameters of the steady state solver
+//! @{
+const doublereal SteadyDampFactor = sqrt(2.0);
+const size_t SteadyMaxDamp = 7; //!< Maximum number of step size reductions
+const size_t SteadyMaxIter = 50; //!< Maximum number of Newton iterations
+const size_t SteadyMaxJacAge = 10; //!< Maximum age of the Jacobian
+const size_t SteadyTimeSteps = 10; //!< Pseudo-time steps between Newton tries
+const doublereal SteadyTimeStepGrowth = 2.0;
+//! @}
+
+}
+
 ReactorNet::ReactorNet() :
     m_integ(0), m_time(0.0), m_init(false), m_integrator_init(false),
     m_nv(0), m_rtol(1.0e-9), m_rtolsens(1.0e-4),
     m_atols(1.0e-15), m_atolsens(1.0e-4),
     m_maxstep(-1.0), m_maxErrTestFails(0),
-    m_verbose(false), m_ntotpar(0)
+    m_verbose(false), m_ntotpar(0), m_linearSolverType("dense"),
+    m_gamma(0.0), m_lastEvent(npos), m_tstart(0.0),
+    m_ssRtol(1.0e-9), m_ssAtol(1.0e-15), m_ssTimeStep(1.0e-5),
+    m_ssMaxTimeSteps(500), m_ssIterations(0), m_ssTimeSteps(0),
+    m_ssJacobians(0), m_ssJacAge(npos)
 {
     m_integ = newIntegrator("CVODE");
 
@@ -81,7 +138,21 @@ void ReactorNet::initialize()
         }
     }
 
+    buildJacobianPattern();
+    if (m_verbose) {
+        writelog("Jacobian evaluation requires " + int2str(nJacobianEvals())
+                 + " network evaluations.\n");
+    }
+
     m_ydot.resize(m_nv,0.0);
+    m_yevent.resize(m_nv);
+    m_ydotevent.resize(m_nv);
+    m_yroot.resize(m_nv);
+    m_rootInfo.resize(m_events.size());
+    for (size_t i = 0; i < m_events.size(); i++) {
+        m_events[i].times.clear();
+    }
+    m_tstart = m_time;
     m_atol.resize(neq());
     fill(m_atol.begin(), m_atol.end(), m_atols);
     m_integ->setTolerances(m_rtol, neq(), DATA_PTR(m_atol));
@@ -103,6 +174,10 @@ void ReactorNet::reinitialize()
 {
     if (m_init) {
         writelog("Re-initializing reactor network.\n", m_verbose);
+        for (size_t i = 0; i < m_events.size(); i++) {
+            m_events[i].times.clear();
+        }
+        m_tstart = m_time;
         m_integ->reinitialize(m_time, *this);
         m_integrator_init = true;
     } else {
@@ -120,8 +195,20 @@ void ReactorNet::advance(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
-    m_integ->integrate(time);
-    m_time = time;
+    m_lastEvent = npos;
+    if (m_events.empty()) {
+        m_integ->integrate(time);
+        m_time = time;
+    } else {
+        // Continue past non-terminal events until the end time is reached
+        while (true) {
+            m_integ->integrate(time);
+            m_time = m_integ->time();
+            if (processEvents() || m_time >= time) {
+                break;
+            }
+        }
+    }
     updateState(m_integ->solution());
 }
 
@@ -135,11 +222,255 @@ double ReactorNet::step(doublereal time)
     } else if (!m_integrator_init) {
         reinitialize();
     }
+    m_lastEvent = npos;
     m_time = m_integ->step(time);
+    if (!m_events.empty()) {
+        processEvents();
+    }
     updateState(m_integ->solution());
     return m_time;
 }
 
+size_t ReactorNet::sampleTrajectory(const vector_fp& times, vector_fp& output,
+                                    const std::vector<size_t>& components)
+{
+    if (times.empty()) {
+        output.clear();
+        return 0;
+    }
+    if (times[0] < m_time) {
+        throw CanteraError("ReactorNet::sampleTrajectory",
+                           "Output times must not be before the current time");
+    }
+    for (size_t i = 1; i < times.size(); i++) {
+        if (times[i] <= times[i-1]) {
+            throw CanteraError("ReactorNet::sampleTrajectory",
+                               "Output times must be increasing");
+        }
+    }
+
+    doublereal tEnd = times.back();
+    if (!m_init) {
+        if (m_maxstep < 0.0) {
+            m_maxstep = tEnd - m_time;
+        }
+        initialize();
+    } else if (!m_integrator_init) {
+        reinitialize();
+    }
+    for (size_t j = 0; j < components.size(); j++) {
+        if (components[j] >= m_nv) {
+            throw IndexError("ReactorNet::sampleTrajectory", "components",
+                             components[j], m_nv-1);
+        }
+    }
+
+    size_t nc = components.empty() ? m_nv : components.size();
+    output.resize(times.size() * nc);
+    m_lastEvent = npos;
+    size_t n = 0;
+    while (true) {
+        // Interpolate the solution at all output times within the last step
+        while (n < times.size() && times[n] <= m_time) {
+            if (components.empty()) {
+                m_integ->getDky(times[n], 0, &output[n*nc]);
+            } else {
+                m_integ->getDky(times[n], 0, DATA_PTR(m_yevent));
+                for (size_t j = 0; j < nc; j++) {
+                    output[n*nc + j] = m_yevent[components[j]];
+                }
+            }
+            n++;
+        }
+        if (n == times.size() || m_lastEvent != npos) {
+            break;
+        }
+        m_time = m_integ->step(tEnd);
+        if (!m_events.empty()) {
+            processEvents();
+        }
+    }
+
+    if (m_lastEvent == npos) {
+        // The last internal step may extend past the final output time
+        m_integ->integrate(tEnd);
+        m_time = tEnd;
+    }
+    updateState(m_integ->solution());
+    return n;
+}
+
+size_t ReactorNet::addThresholdEvent(const std::string& component,
+                                     doublereal value, size_t reactor,
+                                     bool terminal)
+{
+    return addEvent(ThresholdEvent, component, value, reactor, terminal);
+}
+
+size_t ReactorNet::addPeakEvent(const std::string& component, size_t reactor,
+                                bool terminal)
+{
+    return addEvent(PeakEvent, component, 0.0, reactor, terminal);
+}
+
+size_t ReactorNet::addMaxRateEvent(const std::string& component,
+                                   size_t reactor, bool terminal)
+{
+    return addEvent(MaxRateEvent, component, 0.0, reactor, terminal);
+}
+
+size_t ReactorNet::addEvent(int type, const std::string& component,
+                            doublereal value, size_t reactor, bool terminal)
+{
+    if (reactor >= m_reactors.size()) {
+        throw IndexError("ReactorNet::addEvent", "m_reactors", reactor,
+                         m_reactors.size()-1);
+    }
+    Event e;
+    e.type = type;
+    e.reactor = reactor;
+    e.value = value;
+    e.terminal = terminal;
+    Reactor& r = *m_reactors[reactor];
+    if (component == "T" || component == "temperature") {
+        e.species = npos;
+        e.component = r.componentIndex("temperature");
+    } else {
+        e.species = r.contents().speciesIndex(component);
+        if (e.species == npos) {
+            throw CanteraError("ReactorNet::addEvent",
+                               "No species or property named '" + component +
+                               "' in reactor '" + r.name() + "'");
+        }
+        e.component = r.componentIndex(component);
+    }
+    m_events.push_back(e);
+    m_init = false;
+    return m_events.size() - 1;
+}
+
+void ReactorNet::clearEvents()
+{
+    m_events.clear();
+    m_lastEvent = npos;
+    m_init = false;
+}
+
+bool ReactorNet::processEvents()
+{
+    if (!m_integ->getRootInfo(DATA_PTR(m_rootInfo))) {
+        return false;
+    }
+    doublereal* y = m_integ->solution();
+    for (size_t i = 0; i < m_events.size(); i++) {
+        Event& e = m_events[i];
+        // Thresholds are crossed in either direction, while maxima occur
+        // where the rate changes from positive to negative.
+        if (m_rootInfo[i] == 0 ||
+                (e.type != ThresholdEvent && m_rootInfo[i] > 0)) {
+            continue;
+        }
+        if (e.type == MaxRateEvent) {
+            // Ignore maxima of negligible rates, which are caused by noise in
+            // the second derivative, e.g. close to equilibrium. The rate is
+            // significant if sustained over the elapsed time it would change
+            // the property by more than 0.01%.
+            eval(m_time, y, DATA_PTR(m_ydot), 0);
+            doublereal rate = eventRate(i, m_time, y, DATA_PTR(m_ydot));
+            if (rate * (m_time - m_tstart) <= 1e-4 * fabs(eventValue(i, y))) {
+                continue;
+            }
+        }
+        e.times.push_back(m_time);
+        if (e.terminal && m_lastEvent == npos) {
+            m_lastEvent = i;
+        }
+    }
+    return m_lastEvent != npos;
+}
+
+doublereal ReactorNet::eventValue(size_t e, doublereal* y)
+{
+    Reactor& r = *m_reactors[m_events[e].reactor];
+    r.updateState(y + m_start[m_events[e].reactor]);
+    if (m_events[e].species == npos) {
+        return r.temperature();
+    } else {
+        return r.massFraction(m_events[e].species);
+    }
+}
+
+doublereal ReactorNet::eventRate(size_t e, doublereal t, doublereal* y,
+                                 doublereal* ydot)
+{
+    const Event& ev = m_events[e];
+    if (ev.component != npos) {
+        return ydot[m_start[ev.reactor] + ev.component];
+    }
+
+    // The property is not part of the state vector (e.g. the temperature of
+    // a Reactor, which uses the internal energy), so differentiate it along
+    // the trajectory.
+    size_t n0 = m_start[ev.reactor];
+    size_t nv = m_start[ev.reactor + 1] - n0;
+    doublereal dt = timePerturbation(y + n0, ydot + n0, nv, 1e-5);
+    if (dt == 0.0) {
+        return 0.0;
+    }
+    for (size_t n = n0; n < n0 + nv; n++) {
+        m_yevent[n] = y[n] + dt * ydot[n];
+    }
+    doublereal v1 = eventValue(e, DATA_PTR(m_yevent));
+    for (size_t n = n0; n < n0 + nv; n++) {
+        m_yevent[n] = y[n] - dt * ydot[n];
+    }
+    doublereal v0 = eventValue(e, DATA_PTR(m_yevent));
+    m_reactors[ev.reactor]->updateState(y + n0);
+    return (v1 - v0) / (2 * dt);
+}
+
+void ReactorNet::evalRootFunctions(double t, double* y, double* gout)
+{
+    bool needRates = false;
+    for (size_t i = 0; i < m_events.size(); i++) {
+        needRates = needRates || (m_events[i].type != ThresholdEvent);
+    }
+    if (needRates) {
+        eval(t, y, DATA_PTR(m_ydot), 0);
+    } else {
+        updateState(y);
+    }
+
+    for (size_t i = 0; i < m_events.size(); i++) {
+        const Event& e = m_events[i];
+        if (e.type == ThresholdEvent) {
+            gout[i] = eventValue(i, y) - e.value;
+        } else if (e.type == PeakEvent) {
+            gout[i] = eventRate(i, t, y, DATA_PTR(m_ydot));
+        } else {
+            // Second derivative from the change in the rate over a short
+            // time along the trajectory
+            size_t n0 = m_start[e.reactor];
+            size_t nv = m_start[e.reactor + 1] - n0;
+            doublereal dt = timePerturbation(y + n0, DATA_PTR(m_ydot) + n0, nv,
+                                             1e-5);
+            if (dt == 0.0) {
+                gout[i] = 0.0;
+                continue;
+            }
+            doublereal r0 = eventRate(i, t, y, DATA_PTR(m_ydot));
+            for (size_t n = 0; n < m_nv; n++) {
+                m_yroot[n] = y[n] + dt * m_ydot[n];
+            }
+            eval(t + dt, DATA_PTR(m_yroot), DATA_PTR(m_ydotevent), 0);
+            doublereal r1 = eventRate(i, t + dt, DATA_PTR(m_yroot),
+                                      DATA_PTR(m_ydotevent));
+            gout[i] = (r1 - r0) / dt;
+            updateState(y);
+        }
+    }
+}
+
 void ReactorNet::addReactor(Reactor* r, bool iown)
 {
     warn_deprecated("ReactorNet::addReactor(Reactor*)",
@@ -180,30 +511,257 @@ void ReactorNet::eval(doublereal t, doublereal* y,
     }
 }
 
+void ReactorNet::buildJacobianPattern()
+{
+    size_t nr = m_reactors.size();
+    std::map<const ReactorBase*, size_t> index;
+    for (size_t n = 0; n < nr; n++) {
+        index[m_reactors[n]] = n;
+    }
+
+    // Reactors connected by a flow device depend on each other through the
+    // mass flow rate, which may be a function of the pressures on both
+    // sides, and through the composition and enthalpy of the inflow. A
+    // PressureController also depends on the reactors connected by its
+    // master flow device. Reactors on both sides of a Wall depend on each
+    // other through the wall velocity and heat flux.
+    std::vector<std::set<size_t> > coupled(nr);
+    for (size_t n = 0; n < nr; n++) {
+        Reactor& r = *m_reactors[n];
+        coupled[n].insert(n);
+        for (size_t i = 0; i < r.nInlets() + r.nOutlets(); i++) {
+            FlowDevice& d = (i < r.nInlets()) ? r.inlet(i)
+                                              : r.outlet(i - r.nInlets());
+            std::vector<const ReactorBase*> group;
+            group.push_back(&d.in());
+            group.push_back(&d.out());
+            if (d.type() == PressureController_Type) {
+                FlowDevice* master =
+                    dynamic_cast<PressureController&>(d).master();
+                if (master) {
+                    group.push_back(&master->in());
+                    group.push_back(&master->out());
+                }
+            }
+            couple(coupled, index, group);
+        }
+        for (size_t i = 0; i < r.nWalls(); i++) {
+            std::vector<const ReactorBase*> group;
+            group.push_back(&r.wall(i).left());
+            group.push_back(&r.wall(i).right());
+            couple(coupled, index, group);
+        }
+    }
+
+    m_connect.resize(nr);
+    m_jacBlocks.resize(nr);
+    m_precon.resize(nr);
+    m_pivots.resize(nr);
+    for (size_t i = 0; i < nr; i++) {
+        m_connect[i].assign(coupled[i].begin(), coupled[i].end());
+        size_t nv = m_start[i+1] - m_start[i];
+        m_jacBlocks[i].resize(m_connect[i].size());
+        for (size_t n = 0; n < m_connect[i].size(); n++) {
+            size_t j = m_connect[i][n];
+            m_jacBlocks[i][n].resize(nv, m_start[j+1] - m_start[j]);
+        }
+        m_precon[i].resize(nv, nv);
+        m_pivots[i].resize(nv);
+    }
+
+    // Greedy coloring: a reactor can join a group if none of the reactors
+    // which depend on it depend on any reactor already in the group.
+    // Perturbing the variables of all reactors in a group together then
+    // affects disjoint sets of equations.
+    m_jacGroups.clear();
+    std::vector<std::vector<bool> > affected;
+    for (size_t j = 0; j < nr; j++) {
+        size_t g = 0;
+        for (; g < m_jacGroups.size(); g++) {
+            bool ok = true;
+            for (size_t n = 0; n < m_connect[j].size(); n++) {
+                if (affected[g][m_connect[j][n]]) {
+                    ok = false;
+                    break;
+                }
+            }
+            if (ok) {
+                break;
+            }
+        }
+        if (g == m_jacGroups.size()) {
+            m_jacGroups.push_back(std::vector<size_t>());
+            affected.push_back(std::vector<bool>(nr, false));
+        }
+        m_jacGroups[g].push_back(j);
+        for (size_t n = 0; n < m_connect[j].size(); n++) {
+            affected[g][m_connect[j][n]] = true;
+        }
+    }
+}
+
+size_t ReactorNet::nJacobianEvals() const
+{
+    size_t nevals = 0;
+    for (size_t g = 0; g < m_jacGroups.size(); g++) {
+        size_t nmax = 0;
+        for (size_t n = 0; n < m_jacGroups[g].size(); n++) {
+            size_t j = m_jacGroups[g][n];
+            nmax = std::max(nmax, m_start[j+1] - m_start[j]);
+        }
+        nevals += nmax;
+    }
+    return nevals;
+}
+
+Array2D& ReactorNet::jacobianBlock(size_t i, size_t j)
+{
+    std::vector<size_t>::const_iterator iter =
+        std::lower_bound(m_connect[i].begin(), m_connect[i].end(), j);
+    return m_jacBlocks[i][iter - m_connect[i].begin()];
+}
+
+void ReactorNet::evalJacobianBlocks(doublereal t, doublereal* y,
+                                    doublereal* ydot, doublereal* p)
+{
+    vector_fp ysave(m_reactors.size()), dy(m_reactors.size());
+    for (size_t g = 0; g < m_jacGroups.size(); g++) {
+        const std::vector<size_t>& group = m_jacGroups[g];
+        size_t nmax = 0;
+        for (size_t n = 0; n < group.size(); n++) {
+            size_t j = group[n];
+            nmax = std::max(nmax, m_start[j+1] - m_start[j]);
+        }
+
+        for (size_t k = 0; k < nmax; k++) {
+            // perturb the k-th variable of each reactor in the group
+            for (size_t n = 0; n < group.size(); n++) {
+                size_t j = group[n];
+                size_t m = m_start[j] + k;
+                if (m < m_start[j+1]) {
+                    ysave[n] = y[m];
+                    y[m] = ysave[n] + m_atol[m] + fabs(ysave[n])*m_rtol;
+                    dy[n] = y[m] - ysave[n];
+                }
+            }
+
+            // calculate perturbed residual
+            eval(t, y, DATA_PTR(m_ydot), p);
+
+            // compute the k-th column of each block affected by the reactors
+            // in the group
+            for (size_t n = 0; n < group.size(); n++) {
+                size_t j = group[n];
+                if (m_start[j] + k >= m_start[j+1]) {
+                    continue;
+                }
+                y[m_start[j] + k] = ysave[n];
+                for (size_t c = 0; c < m_connect[j].size(); c++) {
+                    size_t i = m_connect[j][c];
+                    doublereal* col = jacobianBlock(i, j).ptrColumn(k);
+                    for (size_t m = m_start[i]; m < m_start[i+1]; m++) {
+                        col[m - m_start[i]] = (m_ydot[m] - ydot[m])/dy[n];
+                    }
+                }
+            }
+        }
+    }
+    updateState(y);
+}
+
 void ReactorNet::evalJacobian(doublereal t, doublereal* y,
                               doublereal* ydot, doublereal* p, Array2D* j)
 {
-    doublereal ysave, dy;
     Array2D& jac = *j;
 
     //evaluate the unperturbed ydot
     eval(t, y, ydot, p);
-    for (size_t n = 0; n < m_nv; n++) {
+    evalJacobianBlocks(t, y, ydot, p);
 
-        // perturb x(n)
-        ysave = y[n];
-        dy = m_atol[n] + fabs(ysave)*m_rtol;
-        y[n] = ysave + dy;
-        dy = y[n] - ysave;
+    jac.resize(m_nv, m_nv);
+    jac.zero();
+    for (size_t r = 0; r < m_reactors.size(); r++) {
+        for (size_t c = 0; c < m_connect[r].size(); c++) {
+            size_t s = m_connect[r][c];
+            Array2D& block = m_jacBlocks[r][c];
+            for (size_t n = 0; n < block.nColumns(); n++) {
+                for (size_t m = 0; m < block.nRows(); m++) {
+                    jac(m_start[r] + m, m_start[s] + n) = block(m, n);
+                }
+            }
+        }
+    }
+}
+
+void ReactorNet::setLinearSolverType(const std::string& type)
+{
+    if (type == "dense") {
+        m_integ->setProblemType(DENSE + NOJAC);
+    } else if (type == "gmres") {
+        m_integ->setProblemType(GMRES + JAC);
+    } else {
+        throw CanteraError("ReactorNet::setLinearSolverType",
+                           "Unknown linear solver type: '" + type + "'");
+    }
+    m_linearSolverType = type;
+    m_init = false;
+}
+
+bool ReactorNet::preconditionerSetup(double t, double* y, double* ydot,
+                                     bool reuseJacobian, double gamma)
+{
+    if (!reuseJacobian) {
+        evalJacobianBlocks(t, y, ydot, 0);
+    }
 
-        // calculate perturbed residual
-        eval(t, y, DATA_PTR(m_ydot), p);
+    // Form and factor the diagonal blocks of M = I - gamma*J
+    m_gamma = gamma;
+    for (size_t i = 0; i < m_reactors.size(); i++) {
+        Array2D& P = m_precon[i];
+        const Array2D& J = jacobianBlock(i, i);
+        size_t nv = P.nRows();
+        for (size_t n = 0; n < nv; n++) {
+            for (size_t m = 0; m < nv; m++) {
+                P(m, n) = - gamma * J(m, n);
+            }
+            P(n, n) += 1.0;
+        }
+        int info = 0;
+        if (nv) {
+            ct_dgetrf(nv, nv, P.ptrColumn(0), nv, DATA_PTR(m_pivots[i]), info);
+        }
+        if (info != 0) {
+            throw CanteraError("ReactorNet::preconditionerSetup",
+                               "Preconditioner block for reactor " +
+                               int2str(int(i)) + " is singular.");
+        }
+    }
+    return !reuseJacobian;
+}
 
-        // compute nth column of Jacobian
-        for (size_t m = 0; m < m_nv; m++) {
-            jac(m,n) = (m_ydot[m] - ydot[m])/dy;
+void ReactorNet::preconditionerSolve(const double* rhs, double* output)
+{
+    // Forward substitution using the block lower triangular part of
+    // M = I - gamma*J
+    std::copy(rhs, rhs + m_nv, output);
+    for (size_t i = 0; i < m_reactors.size(); i++) {
+        double* x = output + m_start[i];
+        size_t nv = m_start[i+1] - m_start[i];
+        for (size_t c = 0; c < m_connect[i].size() && m_connect[i][c] < i; c++) {
+            size_t j = m_connect[i][c];
+            const Array2D& J = m_jacBlocks[i][c];
+            for (size_t n = 0; n < J.nColumns(); n++) {
+                doublereal xj = m_gamma * output[m_start[j] + n];
+                for (size_t m = 0; m < nv; m++) {
+                    x[m] += J(m, n) * xj;
+                }
+            }
+        }
+        int info = 0;
+        if (nv) {
+            ct_dgetrs(ctlapack::NoTranspose, nv, 1, m_precon[i].ptrColumn(0),
+                      nv, DATA_PTR(m_pivots[i]), x, nv, info);
         }
-        y[n] = ysave;
     }
 }
 
@@ -245,4 +803,271 @@ void ReactorNet::registerSensitivityReaction(void* reactor,
     m_ntotpar++;
 }
 
+void ReactorNet::setSteadyTolerances(doublereal rtol, doublereal atol)
+{
+    if (rtol >= 0.0) {
+        m_ssRtol = rtol;
+    }
+    if (atol >= 0.0) {
+        m_ssAtol = atol;
+    }
+}
+
+void ReactorNet::setSteadyTimeStep(doublereal dt)
+{
+    if (dt <= 0.0) {
+        throw CanteraError("ReactorNet::setSteadyTimeStep",
+                           "Time step must be positive.");
+    }
+    m_ssTimeStep = dt;
+}
+
+void ReactorNet::setMaxSteadyTimeSteps(size_t n)
+{
+    m_ssMaxTimeSteps = n;
+}
+
+void ReactorNet::solveSteady()
+{
+    if (!m_init) {
+        initialize();
+    }
+
+    // Components which are kept in bounds by the Newton iteration
+    m_ssBounds.assign(m_nv, 0);
+    const char* positive[] = {"mass", "volume", "temperature"};
+    for (size_t n = 0; n < m_reactors.size(); n++) {
+        Reactor& r = *m_reactors[n];
+        if (r.type() == FlowReactorType) {
+            throw CanteraError("ReactorNet::solveSteady",
+                               "Steady state is not defined for FlowReactors.");
+        }
+        for (size_t i = 0; i < 3; i++) {
+            size_t k = r.componentIndex(positive[i]);
+            if (k != npos) {
+                m_ssBounds[m_start[n] + k] = 1;
+            }
+        }
+        ThermoPhase& th = r.contents();
+        for (size_t k = 0; k < th.nSpecies(); k++) {
+            size_t i = r.componentIndex(th.speciesName(k));
+            if (i != npos) {
+                m_ssBounds[m_start[n] + i] = 2;
+            }
+        }
+    }
+
+    vector_fp y(m_nv), yold(m_nv);
+    getInitialConditions(m_time, m_nv, DATA_PTR(y));
+    yold = y;
+    m_ssIterations = 0;
+    m_ssTimeSteps = 0;
+    m_ssJacobians = 0;
+    m_ssJacAge = npos;
+    doublereal dt = m_ssTimeStep;
+    size_t nattempts = 0;
+    while (!steadyNewton(y, yold, 0.0)) {
+        // Take backward Euler steps toward the steady state, then try Newton
+        // iteration again
+        y = yold;
+        writelog("Steady state: Newton iteration failed, taking pseudo-time "
+                 "steps starting with dt = " + fp2str(dt) + "\n", m_verbose);
+        for (size_t n = 0; n < SteadyTimeSteps; n++) {
+            if (nattempts++ >= m_ssMaxTimeSteps) {
+                updateState(DATA_PTR(y));
+                m_integrator_init = false;
+                throw CanteraError("ReactorNet::solveSteady",
+                    "No convergence after " + int2str(m_ssMaxTimeSteps) +
+                    " pseudo-time steps.");
+            }
+            if (steadyNewton(y, yold, 1.0 / dt)) {
+                yold = y;
+                m_ssTimeSteps++;
+                dt *= SteadyTimeStepGrowth;
+            } else {
+                y = yold;
+                dt /= SteadyTimeStepGrowth;
+            }
+        }
+    }
+    if (m_verbose) {
+        writelog("Steady state: converged after " + int2str(m_ssIterations) +
+                 " Newton iterations, " + int2str(m_ssTimeSteps) +
+                 " pseudo-time steps and " + int2str(m_ssJacobians) +
+                 " Jacobian evaluations.\n");
+    }
+    updateState(DATA_PTR(y));
+    m_integrator_init = false;
+}
+
+bool ReactorNet::steadyNewton(vector_fp& y, const vector_fp& yold,
+                              doublereal rdt)
+{
+    if (m_ssJacAge > SteadyMaxJacAge) {
+        if (!steadyJacobian(y, rdt)) {
+            return false;
+        }
+    } else if (!factorSteadyMatrix(rdt)) {
+        return false;
+    }
+
+    vector_fp step0(m_nv), step1(m_nv), y1(m_nv);
+    doublereal s0 = steadyStep(y, yold, rdt, step0);
+    bool moved = false;
+    for (size_t iter = 0; iter < SteadyMaxIter; iter++) {
+        if (s0 < 1.0) {
+            return true;
+        } else if (!(s0 < BigNumber)) {
+            break;
+        }
+
+        m_ssIterations++;
+
+        // Damp the step until the norm of the next step decreases
+        doublereal fbound = boundSteadyStep(y, step0);
+        doublereal s1 = BigNumber;
+        bool accepted = false;
+        doublereal damp = 1.0;
+        for (size_t m = 0; m < SteadyMaxDamp && fbound > 1.0e-10; m++) {
+            for (size_t i = 0; i < m_nv; i++) {
+                y1[i] = y[i] + fbound * damp * step0[i];
+            }
+            s1 = steadyStep(y1, yold, rdt, step1);
+            if (s1 < 1.0 || s1 < s0) {
+                accepted = true;
+                break;
+            }
+            damp /= SteadyDampFactor;
+        }
+
+        if (accepted) {
+            y.swap(y1);
+            step0.swap(step1);
+            moved = true;
+            s0 = s1;
+            if (++m_ssJacAge > SteadyMaxJacAge && s0 >= 1.0) {
+                if (!steadyJacobian(y, rdt)) {
+                    break;
+                }
+                s0 = steadyStep(y, yold, rdt, step0);
+            }
+        } else if (m_ssJacAge != 0) {
+            // Retry with a Jacobian evaluated at the current point
+            if (!steadyJacobian(y, rdt)) {
+                break;
+            }
+            s0 = steadyStep(y, yold, rdt, step0);
+        } else {
+            break;
+        }
+    }
+    if (moved && m_ssJacAge == 0) {
+        // The caller discards the current point, so the Jacobian is not
+        // evaluated at the point where the next iteration starts.
+        m_ssJacAge = 1;
+    }
+    return false;
+}
+
+bool ReactorNet::steadyJacobian(vector_fp& y, doublereal rdt)
+{
+    m_ssJacobians++;
+    m_ssJacAge = 0;
+    vector_fp ydot(m_nv);
+    try {
+        evalJacobian(m_time, DATA_PTR(y), DATA_PTR(ydot), 0, &m_ssJac);
+    } catch (CanteraError&) {
+        popError();
+        m_ssJacAge = npos;
+        return false;
+    }
+    return factorSteadyMatrix(rdt);
+}
+
+bool ReactorNet::factorSteadyMatrix(doublereal rdt)
+{
+    m_ssMatrix.resize(m_nv, m_nv);
+    for (size_t j = 0; j < m_nv; j++) {
+        for (size_t i = 0; i < m_nv; i++) {
+            m_ssMatrix(i, j) = - m_ssJac(i, j);
+        }
+        m_ssMatrix(j, j) += rdt;
+    }
+    if (rdt == 0.0) {
+        // Variables whose rate of change does not depend on the state, e.g.
+        // the volume of a reactor without walls, are held constant. Their
+        // rates of change are zero if a steady state exists.
+        for (size_t i = 0; i < m_nv; i++) {
+            bool zero = true;
+            for (size_t j = 0; j < m_nv && zero; j++) {
+                zero = (m_ssJac(i, j) == 0.0);
+            }
+            if (zero) {
+                m_ssMatrix(i, i) = 1.0;
+            }
+        }
+    }
+    m_ssPivots.resize(m_nv);
+    int info = 0;
+    ct_dgetrf(m_nv, m_nv, m_ssMatrix.ptrColumn(0), m_nv,
+              DATA_PTR(m_ssPivots), info);
+    return (info == 0);
+}
+
+doublereal ReactorNet::steadyStep(vector_fp& y, const vector_fp& yold,
+                                  doublereal rdt, vector_fp& step)
+{
+    try {
+        eval(m_time, DATA_PTR(y), DATA_PTR(step), 0);
+    } catch (CanteraError&) {
+        // e.g. no temperature corresponds to the internal energy
+        popError();
+        return BigNumber;
+    }
+    if (rdt != 0.0) {
+        for (size_t i = 0; i < m_nv; i++) {
+            step[i] -= rdt * (y[i] - yold[i]);
+        }
+    }
+    int info = 0;
+    ct_dgetrs(ctlapack::NoTranspose, m_nv, 1, m_ssMatrix.ptrColumn(0), m_nv,
+              DATA_PTR(m_ssPivots), DATA_PTR(step), m_nv, info);
+    return steadyNorm(y, step);
+}
+
+doublereal ReactorNet::steadyNorm(const vector_fp& y,
+                                  const vector_fp& step) const
+{
+    doublereal sum = 0.0;
+    for (size_t i = 0; i < m_nv; i++) {
+        doublereal e = step[i] / (m_ssRtol * fabs(y[i]) + m_ssAtol);
+        sum += e * e;
+    }
+    return sqrt(sum / m_nv);
+}
+
+doublereal ReactorNet::boundSteadyStep(const vector_fp& y,
+                                       const vector_fp& step) const
+{
+    doublereal fbound = 1.0;
+    for (size_t i = 0; i < m_nv; i++) {
+        doublereal lower;
+        if (m_ssBounds[i] == 1) {
+            // positive quantities may decrease by at most half in one step
+            lower = 0.5 * y[i];
+        } else if (m_ssBounds[i] == 2) {
+            lower = -1.0e-7;
+            if (y[i] <= lower + 1.0e-12) {
+                continue;
+            }
+        } else {
+            continue;
+        }
+        if (y[i] + step[i] < lower) {
+            fbound = std::min(fbound, (lower - y[i]) / step[i]);
+        }
+    }
+    return std::max(fbound, 0.0);
+}
+
 }
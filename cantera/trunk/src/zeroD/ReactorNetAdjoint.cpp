@@ -0,0 +1,342 @@
+//! @file ReactorNetAdjoint.cpp
+#include "cantera/zeroD/ReactorNetAdjoint.h"
+#include "cantera/zeroD/ReactorNet.h"
+#include "cantera/numerics/Integrator.h"
+#include "cantera/numerics/ctlapack.h"
+
+#include <algorithm>
+#include <cfloat>
+
+using namespace std;
+
+namespace Cantera
+{
+
+ReactorNetAdjoint::ReactorNetAdjoint(ReactorNet& net) :
+    m_net(net),
+    m_integ(newIntegrator("CVODE")),
+    m_nv(0),
+    m_rtol(1.0e-6),
+    m_atol(1.0e-8),
+    m_tjac(-1.0),
+    m_nevals(0)
+{
+    m_integ->setMethod(BDF_Method);
+    m_integ->setIterator(Newton_Iter);
+    // The Jacobian of the adjoint system is available, so the linear systems
+    // are solved using GMRES preconditioned with the exact Newton matrix.
+    m_integ->setProblemType(GMRES + JAC);
+}
+
+ReactorNetAdjoint::~ReactorNetAdjoint()
+{
+    delete m_integ;
+}
+
+void ReactorNetAdjoint::setTolerances(doublereal rtol, doublereal atol)
+{
+    m_rtol = rtol;
+    m_atol = atol;
+}
+
+void ReactorNetAdjoint::advance(doublereal time)
+{
+    // Restart the integrator so that the interpolant of the first step
+    // covers the initial time
+    doublereal t0 = m_net.time();
+    m_net.setInitialTime(t0);
+    m_times.clear();
+    m_ycp.clear();
+    m_ydotcp.clear();
+
+    Integrator& integ = m_net.integrator();
+    bool stopped = false;
+    while (!stopped) {
+        doublereal t = m_net.step(time);
+        if (m_times.empty()) {
+            m_nv = m_net.neq();
+            m_y.resize(m_nv);
+            m_ydot.resize(m_nv);
+            m_ydot1.resize(m_nv);
+            m_lambda.resize(m_nv);
+            m_start.assign(1, 0);
+            for (size_t n = 0; n < m_net.nReactors(); n++) {
+                m_start.push_back(m_start.back() + m_net.reactor(n).neq());
+            }
+            addCheckpoint(t0);
+        }
+        if (t >= time) {
+            // The last internal step may extend past the final time
+            t = time;
+            stopped = true;
+        } else if (m_net.lastEvent() != npos) {
+            stopped = true;
+        }
+        addCheckpoint(t);
+    }
+
+    if (m_net.lastEvent() == npos) {
+        m_net.advance(time);
+    } else {
+        m_net.updateState(integ.solution());
+    }
+}
+
+void ReactorNetAdjoint::addCheckpoint(doublereal t)
+{
+    if (!m_times.empty() && t <= m_times.back()) {
+        return;
+    }
+    m_times.push_back(t);
+    m_ycp.push_back(vector_fp(m_nv));
+    m_ydotcp.push_back(vector_fp(m_nv));
+    m_net.integrator().getDky(t, 0, DATA_PTR(m_ycp.back()));
+    m_net.eval(t, DATA_PTR(m_ycp.back()), DATA_PTR(m_ydotcp.back()), 0);
+}
+
+void ReactorNetAdjoint::solve(const std::string& component, size_t reactor)
+{
+    integrateAdjoint(componentIndex(component, reactor), 1.0);
+}
+
+void ReactorNetAdjoint::solveCrossingTime(const std::string& component,
+                                          size_t reactor)
+{
+    // At the crossing time tau, y_k(tau; k_i) = const, so
+    // dtau/dk_i = -(dy_k/dk_i) / (dy_k/dt)
+    size_t k = componentIndex(component, reactor);
+    if (m_times.empty() || m_ydotcp.back()[k] == 0.0) {
+        throw CanteraError("ReactorNetAdjoint::solveCrossingTime",
+                           "Component '" + component + "' is not changing "
+                           "at the final time.");
+    }
+    integrateAdjoint(k, -1.0 / m_ydotcp.back()[k]);
+}
+
+const vector_fp& ReactorNetAdjoint::sensitivities(size_t reactor) const
+{
+    if (reactor >= m_sens.size()) {
+        throw IndexError("ReactorNetAdjoint::sensitivities", "m_sens",
+                         reactor, m_sens.size()-1);
+    }
+    return m_sens[reactor];
+}
+
+size_t ReactorNetAdjoint::componentIndex(const std::string& component,
+                                         size_t reactor)
+{
+    if (reactor >= m_net.nReactors()) {
+        throw IndexError("ReactorNetAdjoint::componentIndex", "reactors",
+                         reactor, m_net.nReactors()-1);
+    }
+    size_t k = m_net.reactor(reactor).componentIndex(component);
+    if (k == npos) {
+        throw CanteraError("ReactorNetAdjoint::componentIndex",
+                           "'" + component + "' is not a state variable of "
+                           "reactor '" + m_net.reactor(reactor).name() + "'");
+    }
+    return m_start.empty() ? k : m_start[reactor] + k;
+}
+
+void ReactorNetAdjoint::integrateAdjoint(size_t k, doublereal scale)
+{
+    if (m_times.size() < 2) {
+        throw CanteraError("ReactorNetAdjoint::integrateAdjoint",
+                           "advance() must be called before solving the "
+                           "adjoint system.");
+    }
+    m_lambda0.assign(m_nv, 0.0);
+    m_lambda0[k] = 1.0;
+    m_sens.resize(m_net.nReactors());
+    for (size_t n = 0; n < m_sens.size(); n++) {
+        m_sens[n].assign(m_net.reactor(n).nReactions(), 0.0);
+    }
+    m_jac.resize(m_nv, m_nv);
+    m_precon.resize(m_nv, m_nv);
+    m_pivots.resize(m_nv);
+    m_tjac = -1.0;
+    m_jacCache.clear();
+    m_nevals = 0;
+
+    // Integrate in the backward time s = t_f - t
+    doublereal sEnd = m_times.back() - m_times[0];
+    m_integ->setTolerances(m_rtol, m_atol);
+    m_integ->initialize(0.0, *this);
+    doublereal s = 0.0;
+    while (s < sEnd) {
+        doublereal s1 = std::min(m_integ->step(sEnd), sEnd);
+        integrateSensitivities(s, s1);
+        s = s1;
+    }
+
+    for (size_t n = 0; n < m_sens.size(); n++) {
+        for (size_t i = 0; i < m_sens[n].size(); i++) {
+            m_sens[n][i] *= scale;
+        }
+    }
+    m_net.updateState(DATA_PTR(m_ycp.back()));
+}
+
+void ReactorNetAdjoint::interpolate(doublereal t)
+{
+    // Cubic Hermite interpolation between the checkpoints bracketing t.
+    // Outside the recorded interval, the first or last interval is used.
+    size_t j = std::upper_bound(m_times.begin(), m_times.end(), t)
+               - m_times.begin();
+    j = std::max<size_t>(1, std::min(j, m_times.size() - 1));
+    doublereal h = m_times[j] - m_times[j-1];
+    doublereal x = (t - m_times[j-1]) / h;
+    doublereal h00 = (1 + 2*x) * (1 - x) * (1 - x);
+    doublereal h10 = x * (1 - x) * (1 - x);
+    doublereal h01 = x * x * (3 - 2*x);
+    doublereal h11 = x * x * (x - 1);
+    const vector_fp& y0 = m_ycp[j-1];
+    const vector_fp& y1 = m_ycp[j];
+    const vector_fp& f0 = m_ydotcp[j-1];
+    const vector_fp& f1 = m_ydotcp[j];
+    for (size_t n = 0; n < m_nv; n++) {
+        m_y[n] = h00 * y0[n] + h * h10 * f0[n] + h01 * y1[n] + h * h11 * f1[n];
+    }
+}
+
+const Array2D& ReactorNetAdjoint::checkpointJacobian(size_t j)
+{
+    std::map<size_t, Array2D>::iterator iter = m_jacCache.find(j);
+    if (iter != m_jacCache.end()) {
+        return iter->second;
+    }
+    Array2D& J = m_jacCache[j];
+    J.resize(m_nv, m_nv);
+    m_y = m_ycp[j];
+    doublereal t = m_times[j];
+    m_net.eval(t, DATA_PTR(m_y), DATA_PTR(m_ydot), 0);
+    for (size_t n = 0; n < m_nv; n++) {
+        doublereal ysave = m_y[n];
+        m_y[n] = ysave + sqrt(DBL_EPSILON) * std::max(fabs(ysave), 1e-6);
+        doublereal dy = m_y[n] - ysave;
+        m_net.eval(t, DATA_PTR(m_y), DATA_PTR(m_ydot1), 0);
+        for (size_t i = 0; i < m_nv; i++) {
+            J(i, n) = (m_ydot1[i] - m_ydot[i]) / dy;
+        }
+        m_y[n] = ysave;
+    }
+    m_nevals += m_nv + 1;
+    return J;
+}
+
+void ReactorNetAdjoint::evalJacobian(doublereal t)
+{
+    if (t == m_tjac) {
+        return;
+    }
+    // Interpolate linearly between the Jacobians at the checkpoints. The
+    // Jacobians are evaluated by finite differences, and evaluating them at
+    // fixed points keeps the right hand side of the adjoint system smooth.
+    size_t j = std::upper_bound(m_times.begin(), m_times.end(), t)
+               - m_times.begin();
+    j = std::max<size_t>(1, std::min(j, m_times.size() - 1));
+    doublereal x = (t - m_times[j-1]) / (m_times[j] - m_times[j-1]);
+
+    // The backward integration proceeds toward earlier checkpoints, so the
+    // Jacobians at later checkpoints are no longer needed, except when
+    // the integrator retries a step.
+    m_jacCache.erase(m_jacCache.upper_bound(j+1), m_jacCache.end());
+    const Array2D& J1 = checkpointJacobian(j);
+    const Array2D& J0 = checkpointJacobian(j-1);
+    for (size_t n = 0; n < m_nv; n++) {
+        for (size_t i = 0; i < m_nv; i++) {
+            m_jac(i, n) = (1 - x) * J0(i, n) + x * J1(i, n);
+        }
+    }
+    m_tjac = t;
+}
+
+void ReactorNetAdjoint::integrateSensitivities(doublereal s0, doublereal s1)
+{
+    // Three-point Gauss-Legendre quadrature on each interval between
+    // checkpoints, where the interpolated forward solution is smooth
+    static const doublereal xg[3] = {-0.774596669241483377, 0.0,
+                                      0.774596669241483377};
+    static const doublereal wg[3] = {5.0/9.0, 8.0/9.0, 5.0/9.0};
+
+    doublereal tf = m_times.back();
+    doublereal tlo = tf - s1;
+    doublereal thi = tf - s0;
+    size_t j = std::upper_bound(m_times.begin(), m_times.end(), tlo)
+               - m_times.begin();
+    doublereal ta = tlo;
+    while (ta < thi) {
+        doublereal tb = (j < m_times.size()) ? std::min(m_times[j], thi) : thi;
+        for (size_t g = 0; g < 3 && tb > ta; g++) {
+            doublereal t = 0.5 * (ta + tb) + 0.5 * (tb - ta) * xg[g];
+            doublereal w = 0.5 * (tb - ta) * wg[g];
+            m_integ->getDky(tf - t, 0, DATA_PTR(m_lambda));
+            interpolate(t);
+            m_net.updateState(DATA_PTR(m_y));
+            for (size_t n = 0; n < m_sens.size(); n++) {
+                m_work.resize(m_sens[n].size());
+                m_net.reactor(n).evalReactionAdjoint(&m_lambda[m_start[n]],
+                                                     DATA_PTR(m_work));
+                for (size_t i = 0; i < m_work.size(); i++) {
+                    m_sens[n][i] += w * m_work[i];
+                }
+            }
+        }
+        ta = tb;
+        j++;
+    }
+}
+
+void ReactorNetAdjoint::eval(doublereal s, doublereal* lambda,
+                             doublereal* lambdadot, doublereal* p)
+{
+    // d(lambda)/ds = J^T lambda
+    evalJacobian(m_times.back() - s);
+    for (size_t j = 0; j < m_nv; j++) {
+        doublereal sum = 0.0;
+        for (size_t i = 0; i < m_nv; i++) {
+            sum += m_jac(i, j) * lambda[i];
+        }
+        lambdadot[j] = sum;
+    }
+}
+
+void ReactorNetAdjoint::getInitialConditions(doublereal s0, size_t leny,
+                                             doublereal* lambda)
+{
+    std::copy(m_lambda0.begin(), m_lambda0.end(), lambda);
+}
+
+bool ReactorNetAdjoint::preconditionerSetup(double s, double* lambda,
+                                            double* lambdadot,
+                                            bool reuseJacobian, double gamma)
+{
+    if (!reuseJacobian) {
+        evalJacobian(m_times.back() - s);
+    }
+    // Form and factor M = I - gamma * J^T
+    for (size_t j = 0; j < m_nv; j++) {
+        for (size_t i = 0; i < m_nv; i++) {
+            m_precon(i, j) = - gamma * m_jac(j, i);
+        }
+        m_precon(j, j) += 1.0;
+    }
+    int info = 0;
+    ct_dgetrf(m_nv, m_nv, m_precon.ptrColumn(0), m_nv, DATA_PTR(m_pivots),
+              info);
+    if (info != 0) {
+        throw CanteraError("ReactorNetAdjoint::preconditionerSetup",
+                           "Preconditioner is singular.");
+    }
+    return !reuseJacobian;
+}
+
+void ReactorNetAdjoint::preconditionerSolve(const double* rhs, double* output)
+{
+    std::copy(rhs, rhs + m_nv, output);
+    int info = 0;
+    ct_dgetrs(ctlapack::NoTranspose, m_nv, 1, m_precon.ptrColumn(0), m_nv,
+              DATA_PTR(m_pivots), output, m_nv, info);
+}
+
+}
@@ -0,0 +1,114 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/HMWSoln.h"
+
+namespace Cantera
+{
+
+// A mixed electrolyte with a neutral solute, for which the psi and zeta
+// ternary interaction terms of the Pitzer model are nonzero.
+class HMWSoln_Test : public testing::Test
+{
+public:
+    void makePhase(const std::string& id) {
+        test_phase.reset(new HMWSoln("../data/HMW_NaCl_zeta.xml", id));
+        test_phase->setState_TP(323.15, 5 * OneAtm);
+        test_phase->setMolalitiesByName("Na+:2.0, Cl-:1.5, H+:0.1, OH-:0.6, "
+                                        "NaCl(aq):0.5");
+        kk = test_phase->nSpecies();
+    }
+
+    //! Logarithms of the molality-based activity coefficients
+    vector_fp lnActCoeff(double T, double P) {
+        test_phase->setState_TP(T, P);
+        vector_fp lnac(kk);
+        test_phase->getMolalityActivityCoefficients(&lnac[0]);
+        for (size_t k = 0; k < kk; k++) {
+            lnac[k] = log(lnac[k]);
+        }
+        return lnac;
+    }
+
+    //! d(ln gamma)/dT, from the excess partial molar enthalpies
+    vector_fp dlnActCoeffdT(double T, double P) {
+        test_phase->setState_TP(T, P);
+        vector_fp hbar(kk), h0(kk), dlnac(kk);
+        test_phase->getPartialMolarEnthalpies(&hbar[0]);
+        test_phase->getEnthalpy_RT(&h0[0]);
+        for (size_t k = 0; k < kk; k++) {
+            dlnac[k] = - (hbar[k] / (GasConstant * T) - h0[k]) / T;
+        }
+        return dlnac;
+    }
+
+    std::auto_ptr<HMWSoln> test_phase;
+    size_t kk;
+};
+
+TEST_F(HMWSoln_Test, lnActCoeff)
+{
+    // Reference values computed with the implementation that summed over all
+    // pairs and triples of species
+    const double lnac_ref[] = {-0.00298839688614898, -0.436975041282762,
+                               -0.148458661373454, -0.359571536994717,
+                               -0.592627297004394, 0.07038};
+    makePhase("NaCl_electrolyte");
+    vector_fp lnac = lnActCoeff(323.15, 5 * OneAtm);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_NEAR(lnac_ref[k], lnac[k], 1e-12);
+    }
+}
+
+TEST_F(HMWSoln_Test, dlnActCoeffdT)
+{
+    makePhase("NaCl_electrolyte");
+    double T = 323.15, P = 5 * OneAtm, dT = 1e-3;
+    vector_fp lnac1 = lnActCoeff(T + dT, P);
+    vector_fp lnac2 = lnActCoeff(T - dT, P);
+    vector_fp dlnac = dlnActCoeffdT(T, P);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_NEAR((lnac1[k] - lnac2[k]) / (2 * dT), dlnac[k], 1e-8)
+            << test_phase->speciesName(k);
+    }
+}
+
+TEST_F(HMWSoln_Test, d2lnActCoeffdT2)
+{
+    // The second derivative of the Debye-Huckel parameter for water is only
+    // approximate, so a constant value is used here
+    makePhase("NaCl_electrolyte_constA");
+    double T = 323.15, P = 5 * OneAtm, dT = 1e-3;
+    vector_fp dlnac1 = dlnActCoeffdT(T + dT, P);
+    vector_fp dlnac2 = dlnActCoeffdT(T - dT, P);
+    vector_fp dlnac = dlnActCoeffdT(T, P);
+    vector_fp cpbar(kk), cp0(kk);
+    test_phase->getPartialMolarCp(&cpbar[0]);
+    test_phase->getCp_R(&cp0[0]);
+    for (size_t k = 0; k < kk; k++) {
+        double d2lnac = - (cpbar[k] / GasConstant - cp0[k]) / (T * T)
+                        - 2.0 * dlnac[k] / T;
+        EXPECT_NEAR((dlnac1[k] - dlnac2[k]) / (2 * dT), d2lnac, 1e-8)
+            << test_phase->speciesName(k);
+    }
+}
+
+TEST_F(HMWSoln_Test, dlnActCoeffdP)
+{
+    makePhase("NaCl_electrolyte");
+    double T = 323.15, P = 5 * OneAtm, dP = 1e3;
+    vector_fp lnac1 = lnActCoeff(T, P + dP);
+    vector_fp lnac2 = lnActCoeff(T, P - dP);
+    test_phase->setState_TP(T, P);
+    vector_fp vbar(kk), v0(kk);
+    test_phase->getPartialMolarVolumes(&vbar[0]);
+    test_phase->getStandardVolumes(&v0[0]);
+    for (size_t k = 0; k < kk; k++) {
+        double dlnac = (vbar[k] - v0[k]) / (GasConstant * T);
+        EXPECT_NEAR((lnac1[k] - lnac2[k]) / (2 * dP), dlnac, 1e-14)
+            << test_phase->speciesName(k);
+        if (test_phase->charge(k) != 0.0) {
+            EXPECT_NE(0.0, dlnac);
+        }
+    }
+}
+
+} // namespace Cantera
@@ -0,0 +1,152 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/PengRobinsonMFTP.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class PengRobinsonMFTP_Test : public testing::Test
+{
+public:
+    PengRobinsonMFTP_Test() {
+        test_phase.reset(newPhase("../data/co2_PR_mix.xml", "pr_mix"));
+    }
+
+    std::auto_ptr<ThermoPhase> test_phase;
+};
+
+TEST_F(PengRobinsonMFTP_Test, construct_from_xml)
+{
+    PengRobinsonMFTP* pr_phase = dynamic_cast<PengRobinsonMFTP*>(test_phase.get());
+    EXPECT_TRUE(pr_phase != NULL);
+    EXPECT_EQ((size_t) 5, test_phase->nSpecies());
+    EXPECT_EQ((size_t) 1, pr_phase->nBinaryInteractions());
+}
+
+TEST_F(PengRobinsonMFTP_Test, pureCriticalPoint)
+{
+    test_phase->setState_TPX(300.0, 1.0E5, "CO2:1.0");
+    EXPECT_NEAR(304.13, test_phase->critTemperature(), 1e-8);
+    EXPECT_NEAR(7.3773E6, test_phase->critPressure(), 1e-4);
+
+    // The critical point is an inflection point of the critical isotherm
+    test_phase->setState_TP(test_phase->critTemperature(), test_phase->critPressure());
+    EXPECT_NEAR(test_phase->critDensity(), test_phase->density(),
+                1e-3 * test_phase->critDensity());
+}
+
+TEST_F(PengRobinsonMFTP_Test, partialMolarProperties)
+{
+    size_t kk = test_phase->nSpecies();
+    vector_fp x(kk), vbar(kk), hbar(kk), mu(kk), sbar(kk);
+    const double states[3][2] = {{350.0, 8.0E6}, {500.0, 3.0E7}, {900.0, 1.0E6}};
+    for (int n = 0; n < 3; n++) {
+        test_phase->setState_TPX(states[n][0], states[n][1],
+                                 "CO2:0.6, H2O:0.2, CH4:0.1, N2:0.05, O2:0.05");
+        test_phase->getMoleFractions(&x[0]);
+        test_phase->getPartialMolarVolumes(&vbar[0]);
+        test_phase->getPartialMolarEnthalpies(&hbar[0]);
+        test_phase->getChemPotentials(&mu[0]);
+        test_phase->getPartialMolarEntropies(&sbar[0]);
+        double vsum = 0.0, hsum = 0.0, gsum = 0.0, ssum = 0.0;
+        for (size_t k = 0; k < kk; k++) {
+            vsum += x[k] * vbar[k];
+            hsum += x[k] * hbar[k];
+            gsum += x[k] * mu[k];
+            ssum += x[k] * sbar[k];
+        }
+        double h = test_phase->enthalpy_mole();
+        double s = test_phase->entropy_mole();
+        EXPECT_NEAR(test_phase->molarVolume(), vsum, 1e-10 * vsum) << n;
+        EXPECT_NEAR(h, hsum, 1e-9 * fabs(h)) << n;
+        EXPECT_NEAR(h - states[n][0] * s, gsum, 1e-9 * fabs(gsum)) << n;
+        EXPECT_NEAR(s, ssum, 1e-9 * fabs(s)) << n;
+    }
+}
+
+TEST_F(PengRobinsonMFTP_Test, cpFiniteDifference)
+{
+    double T = 420.0, P = 1.2E7, dT = 1.0E-3;
+    test_phase->setState_TPX(T + dT, P, "CO2:0.6, H2O:0.2, CH4:0.1, N2:0.05, O2:0.05");
+    double h2 = test_phase->enthalpy_mole();
+    double s2 = test_phase->entropy_mole();
+    test_phase->setState_TP(T - dT, P);
+    double h1 = test_phase->enthalpy_mole();
+    double s1 = test_phase->entropy_mole();
+    test_phase->setState_TP(T, P);
+    double cp = test_phase->cp_mole();
+    EXPECT_NEAR((h2 - h1) / (2 * dT), cp, 1e-6 * cp);
+    EXPECT_NEAR(T * (s2 - s1) / (2 * dT), cp, 1e-6 * cp);
+}
+
+TEST_F(PengRobinsonMFTP_Test, binaryInteraction)
+{
+    PengRobinsonMFTP& pr = dynamic_cast<PengRobinsonMFTP&>(*test_phase);
+    test_phase->setState_TPX(500.0, 1.0E7, "CO2:0.5, H2O:0.5");
+    double rho1 = pr.density();
+    double h1 = pr.enthalpy_mass();
+
+    // Removing the only interaction parameter changes the state
+    pr.setBinaryInteraction(1, 0, 0.0);
+    EXPECT_EQ((size_t) 0, pr.nBinaryInteractions());
+    pr.setState_TP(500.0, 1.0E7);
+    EXPECT_GT(fabs(pr.density() - rho1), 1e-3 * rho1);
+
+    // Parameters for pairs that are absent from the mixture have no effect
+    pr.setBinaryInteraction(2, 3, 0.1);
+    EXPECT_EQ((size_t) 1, pr.nBinaryInteractions());
+    double rho0 = pr.density();
+    pr.setState_TP(500.0, 1.0E7);
+    EXPECT_DOUBLE_EQ(rho0, pr.density());
+
+    pr.setBinaryInteraction(0, 1, 0.19);
+    EXPECT_EQ((size_t) 2, pr.nBinaryInteractions());
+    pr.setState_TP(500.0, 1.0E7);
+    EXPECT_NEAR(rho1, pr.density(), 1e-12 * rho1);
+    EXPECT_NEAR(h1, pr.enthalpy_mass(), 1e-12 * fabs(h1));
+
+    EXPECT_THROW(pr.setBinaryInteraction(1, 1, 0.1), CanteraError);
+    EXPECT_THROW(pr.setBinaryInteraction(0, 5, 0.1), CanteraError);
+}
+
+TEST_F(PengRobinsonMFTP_Test, massPropertiesMany)
+{
+    PengRobinsonMFTP& pr = dynamic_cast<PengRobinsonMFTP&>(*test_phase);
+    size_t kk = pr.nSpecies();
+    const size_t n = 100;
+    vector_fp T(n), P(n), Y(n*kk), rho(n), cp(n), h(n), s(n);
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 400.0 + 5.0 * i;
+        P[i] = 1.0E5 + 2.0E5 * i;
+        Y[i*kk] = 0.5 + 0.004 * i; // CO2
+        Y[i*kk+1] = 0.1; // H2O
+        Y[i*kk+2] = 0.2 - 0.002 * i; // CH4
+        Y[i*kk+3] = 0.1 - 0.001 * i; // N2
+        Y[i*kk+4] = 0.1 - 0.001 * i; // O2
+    }
+
+    pr.setState_TPY(300.0, 1.0E6, &Y[0]);
+    double rho0 = pr.density();
+    pr.getMassProperties(n, &T[0], &P[0], &Y[0], &rho[0], &cp[0], &h[0], &s[0]);
+    EXPECT_DOUBLE_EQ(rho0, pr.density());
+    EXPECT_DOUBLE_EQ(300.0, pr.temperature());
+    for (size_t i = 0; i < n; i++) {
+        pr.setState_TPY(T[i], P[i], &Y[i*kk]);
+        EXPECT_NEAR(pr.density(), rho[i], 1e-10 * rho[i]) << i;
+        EXPECT_NEAR(pr.cp_mass(), cp[i], 1e-9 * cp[i]) << i;
+        EXPECT_NEAR(pr.enthalpy_mass(), h[i], 1e-9 * fabs(h[i])) << i;
+        EXPECT_NEAR(pr.entropy_mass(), s[i], 1e-9 * s[i]) << i;
+    }
+
+    // Below its critical temperature, pure CO2 is a gas at low pressure and
+    // a liquid at high pressure
+    test_phase->setState_TPX(300.0, 1.0E5, "CO2:1.0");
+    double rhoCrit = pr.critDensity();
+    double T2[2] = {280.0, 280.0};
+    double P2[2] = {1.0E6, 1.0E7};
+    pr.getMassProperties(2, T2, P2, 0, &rho[0], &cp[0], &h[0]);
+    EXPECT_LT(rho[0], 0.2 * rhoCrit);
+    EXPECT_GT(rho[1], 1.5 * rhoCrit);
+}
+
+}
@@ -0,0 +1,153 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/RedlichKwongMFTP.h"
+#include "cantera/thermo/ThermoFactory.h"
+
+namespace Cantera
+{
+
+class RedlichKwongMFTP_Test : public testing::Test
+{
+public:
+    RedlichKwongMFTP_Test() {
+        test_phase.reset(newPhase("../data/co2_RK_mix.xml", "rk_mix"));
+    }
+
+    std::auto_ptr<ThermoPhase> test_phase;
+};
+
+TEST_F(RedlichKwongMFTP_Test, construct_from_xml)
+{
+    RedlichKwongMFTP* rk_phase = dynamic_cast<RedlichKwongMFTP*>(test_phase.get());
+    EXPECT_TRUE(rk_phase != NULL);
+    EXPECT_EQ((size_t) 5, test_phase->nSpecies());
+}
+
+TEST_F(RedlichKwongMFTP_Test, mixingTermsFollowState)
+{
+    // The mixing terms are cached by composition and temperature; check that
+    // they are updated when either changes, and reused when they return.
+    test_phase->setState_TPX(600.0, 5.0E6, "CO2:0.7, H2O:0.3");
+    double rho1 = test_phase->density();
+    double h1 = test_phase->enthalpy_mass();
+    double cp1 = test_phase->cp_mass();
+    double tc1 = test_phase->critTemperature();
+
+    test_phase->setState_TPX(450.0, 2.0E7, "CH4:0.6, N2:0.4");
+    double rho2 = test_phase->density();
+    double h2 = test_phase->enthalpy_mass();
+    double tc2 = test_phase->critTemperature();
+    EXPECT_GT(fabs(tc1 - tc2), 1.0);
+
+    test_phase->setState_TPX(600.0, 5.0E6, "CO2:0.7, H2O:0.3");
+    EXPECT_DOUBLE_EQ(rho1, test_phase->density());
+    EXPECT_DOUBLE_EQ(h1, test_phase->enthalpy_mass());
+    EXPECT_DOUBLE_EQ(cp1, test_phase->cp_mass());
+    EXPECT_DOUBLE_EQ(tc1, test_phase->critTemperature());
+
+    // Compare with a phase that has only seen the second state
+    std::auto_ptr<ThermoPhase> fresh(newPhase("../data/co2_RK_mix.xml", "rk_mix"));
+    fresh->setState_TPX(450.0, 2.0E7, "CH4:0.6, N2:0.4");
+    EXPECT_NEAR(rho2, fresh->density(), 1e-12 * rho2);
+    EXPECT_NEAR(h2, fresh->enthalpy_mass(), 1e-12 * fabs(h2));
+    EXPECT_NEAR(tc2, fresh->critTemperature(), 1e-12 * tc2);
+
+    // A change of temperature alone
+    test_phase->setState_TP(650.0, 5.0E6);
+    fresh->setState_TPX(650.0, 5.0E6, "CO2:0.7, H2O:0.3");
+    EXPECT_NEAR(fresh->density(), test_phase->density(),
+                1e-12 * test_phase->density());
+    EXPECT_NEAR(fresh->cp_mass(), test_phase->cp_mass(),
+                1e-12 * test_phase->cp_mass());
+}
+
+TEST_F(RedlichKwongMFTP_Test, temperatureDependentMixtureA)
+{
+    // Compare the mixture 'a' with the sum over species pairs of
+    // (a0_ij + a1_ij*T)*x_i*x_j, using the parameters from co2_RK_mix.xml.
+    // Unspecified cross coefficients are the geometric means of the pure
+    // species coefficients.
+    RedlichKwongMFTP& rk = dynamic_cast<RedlichKwongMFTP&>(*test_phase);
+    size_t kk = rk.nSpecies();
+    double a0[5] = {7.54E6, 1.7458E7, 3.22E6, 1.556E6, 1.741E6};
+    double a1[5] = {-4.13E3, -8.0E3, 0.0, 0.0, 0.0};
+    double b[5] = {0.0278, 0.01818, 0.02985, 0.02675, 0.02208};
+    double x[5] = {0.45, 0.3, 0.1, 0.1, 0.05};
+    double T[3] = {300.0, 550.0, 1200.0};
+    for (size_t n = 0; n < 3; n++) {
+        rk.setState_TPX(T[n], 5.0E6, x);
+        double aExpected = 0.0;
+        double bExpected = 0.0;
+        for (size_t i = 0; i < kk; i++) {
+            bExpected += x[i] * b[i];
+            for (size_t j = 0; j < kk; j++) {
+                double aij = sqrt(a0[i] * a0[j]) + sqrt(a1[i] * a1[j]) * T[n];
+                if (i == j) {
+                    aij = a0[i] + a1[i] * T[n];
+                } else if (i + j == 1) {
+                    aij = 7.897E6; // crossFluidParameters for CO2-H2O
+                }
+                aExpected += aij * x[i] * x[j];
+            }
+        }
+        double aCalc, bCalc;
+        rk.calculateAB(T[n], aCalc, bCalc);
+        EXPECT_NEAR(aExpected, aCalc, 1e-12 * aExpected);
+        EXPECT_NEAR(bExpected, bCalc, 1e-14 * bExpected);
+    }
+}
+
+TEST_F(RedlichKwongMFTP_Test, massPropertiesMany)
+{
+    RedlichKwongMFTP& rk = dynamic_cast<RedlichKwongMFTP&>(*test_phase);
+    size_t kk = rk.nSpecies();
+    const size_t n = 100;
+    vector_fp T(n), P(n), Y(n*kk), rho(n), cp(n), h(n), s(n);
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 400.0 + 5.0 * i;
+        P[i] = 1.0E5 + 2.0E5 * i;
+        Y[i*kk] = 0.5 + 0.004 * i; // CO2
+        Y[i*kk+1] = 0.1; // H2O
+        Y[i*kk+2] = 0.2 - 0.002 * i; // CH4
+        Y[i*kk+3] = 0.1 - 0.001 * i; // N2
+        Y[i*kk+4] = 0.1 - 0.001 * i; // O2
+    }
+
+    rk.setState_TPY(300.0, 1.0E6, &Y[0]);
+    double rho0 = rk.density();
+    rk.getMassProperties(n, &T[0], &P[0], &Y[0], &rho[0], &cp[0], &h[0], &s[0]);
+    EXPECT_DOUBLE_EQ(rho0, rk.density());
+    EXPECT_DOUBLE_EQ(300.0, rk.temperature());
+    for (size_t i = 0; i < n; i++) {
+        rk.setState_TPY(T[i], P[i], &Y[i*kk]);
+        EXPECT_NEAR(rk.density(), rho[i], 1e-10 * rho[i]) << i;
+        EXPECT_NEAR(rk.cp_mass(), cp[i], 1e-9 * cp[i]) << i;
+        EXPECT_NEAR(rk.enthalpy_mass(), h[i], 1e-9 * fabs(h[i])) << i;
+        EXPECT_NEAR(rk.entropy_mass(), s[i], 1e-9 * s[i]) << i;
+    }
+
+    // Current composition and pressure
+    rk.getMassProperties(n, &T[0], 0, 0, &rho[0], &cp[0], &h[0]);
+    double Pnow = rk.pressure();
+    for (size_t i = 0; i < n; i += 9) {
+        rk.setState_TP(T[i], Pnow);
+        EXPECT_NEAR(rk.density(), rho[i], 1e-10 * rho[i]) << i;
+        EXPECT_NEAR(rk.enthalpy_mass(), h[i], 1e-9 * fabs(h[i])) << i;
+    }
+}
+
+TEST_F(RedlichKwongMFTP_Test, massPropertiesStableRoot)
+{
+    // Below its critical temperature, pure CO2 is a gas at low pressure and
+    // a liquid at high pressure, independent of the current state
+    RedlichKwongMFTP& rk = dynamic_cast<RedlichKwongMFTP&>(*test_phase);
+    test_phase->setState_TPX(300.0, 1.0E5, "CO2:1.0");
+    double rhoCrit = rk.critDensity();
+    double T[2] = {280.0, 280.0};
+    double P[2] = {1.0E6, 1.0E7};
+    double rho[2], cp[2], h[2];
+    rk.getMassProperties(2, T, P, 0, rho, cp, h);
+    EXPECT_LT(rho[0], 0.2 * rhoCrit);
+    EXPECT_GT(rho[1], 1.5 * rhoCrit);
+}
+
+}
@@ -1,7 +1,9 @@
 #include "gtest/gtest.h"
 #include "cantera/thermo/ThermoPhase.h"
 #include "cantera/thermo/ThermoFactory.h"
+#include "cantera/thermo/IdealGasPhase.h"
 #include <vector>
+#include <numeric>
 
 namespace Cantera
 {
@@ -91,4 +93,205 @@ TEST_F(TestThermoMethods, getMassFractionsByName)
     EXPECT_EQ(Y.size(), (size_t) 3);
 }
 
+TEST_F(TestThermoMethods, setSparseComposition)
+{
+    size_t kk = thermo->nSpecies();
+    vector_fp X1(kk), X2(kk);
+    SparseComposition comp = thermo->compileComposition("OH:1e-9, O2:0.2, H2:0.3, AR:0.5");
+    EXPECT_EQ((size_t) 4, comp.index.size());
+
+    thermo->setMoleFractionsByName("OH:1e-9, O2:0.2, H2:0.3, AR:0.5");
+    thermo->getMoleFractions(&X1[0]);
+    thermo->setMoleFractionsByName("H2O:1.0");
+    thermo->setMoleFractions_Sparse(comp);
+    thermo->getMoleFractions(&X2[0]);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(X1[k], X2[k]);
+    }
+
+    // Unlisted species are set to zero, and the work array is cleared
+    size_t index[2] = {thermo->speciesIndex("H2O"), thermo->speciesIndex("H2")};
+    double x[2] = {3.0, 1.0};
+    thermo->setMoleFractions_Sparse(2, index, x);
+    EXPECT_DOUBLE_EQ(0.75, thermo->moleFraction("H2O"));
+    EXPECT_DOUBLE_EQ(0.25, thermo->moleFraction("H2"));
+    EXPECT_DOUBLE_EQ(0.0, thermo->moleFraction("O2"));
+    thermo->setMoleFractions_Sparse(comp);
+    thermo->getMoleFractions(&X2[0]);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(X1[k], X2[k]);
+    }
+
+    compositionMap ymap;
+    ymap["O2"] = 0.2;
+    ymap["H2"] = 0.3;
+    ymap["AR"] = 0.5;
+    ymap["CO2"] = 0.1; // Not in the phase
+    thermo->setState_TPY(500.0, 2.0 * OneAtm, thermo->compileComposition(ymap));
+    EXPECT_DOUBLE_EQ(500.0, thermo->temperature());
+    EXPECT_NEAR(2.0 * OneAtm, thermo->pressure(), 1e-8);
+    EXPECT_DOUBLE_EQ(0.2, thermo->massFraction("O2"));
+    EXPECT_DOUBLE_EQ(0.5, thermo->massFraction("AR"));
+
+    index[0] = kk;
+    EXPECT_THROW(thermo->setMoleFractions_Sparse(2, index, x), IndexError);
+    EXPECT_THROW(thermo->compileComposition("CO2:1.0"), CanteraError);
+
+    // A failed call leaves no values behind in the work array
+    thermo->setMoleFractions_Sparse(1, index + 1, x + 1);
+    EXPECT_DOUBLE_EQ(1.0, thermo->moleFraction("H2"));
+}
+
+TEST_F(TestThermoMethods, setSparseCompositionWrongPhase)
+{
+    SparseComposition comp = thermo->compileComposition("O2:0.2, H2:0.8");
+    comp.nSpecies = thermo->nSpecies() + 1;
+    EXPECT_THROW(thermo->setMoleFractions_Sparse(comp), CanteraError);
+    EXPECT_THROW(thermo->setMassFractions_Sparse(comp), CanteraError);
+    EXPECT_THROW(thermo->setState_TPX(300.0, OneAtm, comp), CanteraError);
+    EXPECT_THROW(thermo->compileComposition("O2:0.2, XX:0.8"), CanteraError);
+}
+
+//! A phase whose composition setters fail on request, used to check that
+//! the sparse setters clean up after an exception.
+class FailingPhase : public IdealGasPhase
+{
+public:
+    FailingPhase() : IdealGasPhase("h2o2.xml", "ohmech"), fail(false) {}
+
+    virtual void setMoleFractions(const doublereal* const x) {
+        if (fail) {
+            throw CanteraError("FailingPhase::setMoleFractions", "failed");
+        }
+        IdealGasPhase::setMoleFractions(x);
+    }
+
+    virtual void setMassFractions(const doublereal* const y) {
+        if (fail) {
+            throw CanteraError("FailingPhase::setMassFractions", "failed");
+        }
+        IdealGasPhase::setMassFractions(y);
+    }
+
+    bool fail;
+};
+
+TEST(SparseComposition, ExceptionInSetter)
+{
+    FailingPhase p;
+    size_t iO2 = p.speciesIndex("O2");
+    size_t iH2 = p.speciesIndex("H2");
+    size_t iAR = p.speciesIndex("AR");
+    double x = 1.0;
+
+    p.fail = true;
+    EXPECT_THROW(p.setMoleFractions_Sparse(1, &iO2, &x), CanteraError);
+    EXPECT_THROW(p.setMassFractions_Sparse(1, &iH2, &x), CanteraError);
+
+    // Values from the failed calls must not appear in later compositions
+    p.fail = false;
+    p.setMoleFractions_Sparse(1, &iAR, &x);
+    EXPECT_DOUBLE_EQ(1.0, p.moleFraction(iAR));
+    EXPECT_DOUBLE_EQ(0.0, p.moleFraction(iO2));
+    EXPECT_DOUBLE_EQ(0.0, p.moleFraction(iH2));
+    p.setMassFractions_Sparse(1, &iAR, &x);
+    EXPECT_DOUBLE_EQ(1.0, p.massFraction(iAR));
+    EXPECT_DOUBLE_EQ(0.0, p.massFraction(iO2));
+    EXPECT_DOUBLE_EQ(0.0, p.massFraction(iH2));
+}
+
+TEST_F(TestThermoMethods, setState_TPY_combined)
+{
+    size_t kk = thermo->nSpecies();
+    vector_fp y(kk, 0.0), y2(kk), x(kk), x2(kk);
+    for (size_t k = 0; k < kk; k++) {
+        y[k] = 0.5 + k;
+    }
+    y[1] = -0.1; // negative values are ignored
+    thermo->setState_TPY(1200.0, 3.0 * OneAtm, &y[0]);
+    EXPECT_DOUBLE_EQ(1200.0, thermo->temperature());
+    EXPECT_NEAR(3.0 * OneAtm, thermo->pressure(), 1e-9 * OneAtm);
+    thermo->getMassFractions(&y2[0]);
+    EXPECT_DOUBLE_EQ(0.0, y2[1]);
+    EXPECT_DOUBLE_EQ(1.0, std::accumulate(y2.begin(), y2.end(), 0.0));
+
+    // Converting back and forth between mole and mass fractions
+    thermo->getMoleFractions(&x[0]);
+    thermo->setState_TPX(800.0, OneAtm, &x[0]);
+    EXPECT_NEAR(OneAtm, thermo->pressure(), 1e-9 * OneAtm);
+    thermo->getMassFractions(&y[0]);
+    thermo->getMoleFractions(&x2[0]);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_NEAR(y2[k], y[k], 1e-15);
+        EXPECT_NEAR(x[k], x2[k], 1e-15);
+    }
+}
+
+TEST(PropertyCache, GibbsExcessActivityCoeffs)
+{
+    ThermoPhase* p = newPhase("../data/LiKCl_liquid.xml");
+    size_t kk = p->nSpecies();
+    vector_fp x(kk, 1.0);
+    x[0] = 3.0;
+    p->setState_TPX(800.0, OneAtm, &x[0]);
+
+    vector_fp ac1(kk), ac2(kk);
+    p->getActivityCoefficients(&ac1[0]);
+    size_t misses = p->propertyCache().misses();
+    size_t hits = p->propertyCache().hits();
+
+    // Repeated calls at the same state use the cached values
+    p->getActivityCoefficients(&ac2[0]);
+    EXPECT_EQ(misses, p->propertyCache().misses());
+    EXPECT_GT(p->propertyCache().hits(), hits);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(ac1[k], ac2[k]);
+    }
+
+    // Changing the composition invalidates them
+    x[0] = 1.0;
+    p->setMoleFractions(&x[0]);
+    p->getActivityCoefficients(&ac2[0]);
+    EXPECT_GT(p->propertyCache().misses(), misses);
+    EXPECT_NE(ac1[0], ac2[0]);
+
+    // Returning to the original state reproduces the original values
+    x[0] = 3.0;
+    p->setMoleFractions(&x[0]);
+    p->getActivityCoefficients(&ac2[0]);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(ac1[k], ac2[k]);
+    }
+
+    misses = p->propertyCache().misses();
+    p->invalidateCache();
+    EXPECT_EQ((size_t) 0, p->propertyCache().misses());
+    p->getActivityCoefficients(&ac2[0]);
+    EXPECT_GT(p->propertyCache().misses(), (size_t) 0);
+    delete p;
+}
+
+TEST(PropertyCache, ModifiedParameters)
+{
+    ThermoPhase* p = newPhase("../data/LiKCl_liquid.xml");
+    size_t kk = p->nSpecies();
+    vector_fp x(kk, 1.0);
+    x[0] = 3.0;
+    p->setState_TPX(800.0, OneAtm, &x[0]);
+
+    vector_fp ac1(kk), ac2(kk);
+    p->getActivityCoefficients(&ac1[0]);
+
+    // Changing a species parameter discards the cached values, which are
+    // recomputed at the same state
+    p->modifyOneHf298SS(0, p->Hf298SS(0) + 1.0e6);
+    EXPECT_EQ((size_t) 0, p->propertyCache().misses());
+    p->getActivityCoefficients(&ac2[0]);
+    EXPECT_GT(p->propertyCache().misses(), (size_t) 0);
+    for (size_t k = 0; k < kk; k++) {
+        EXPECT_DOUBLE_EQ(ac1[k], ac2[k]);
+    }
+    delete p;
+}
+
 }
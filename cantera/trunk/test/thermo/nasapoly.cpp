@@ -139,6 +139,182 @@ TEST(Nasa9Test, Nasa9Thermo) {
     }
 }
 
+// Compare the evaluation of all species together with the evaluation of each
+// species by its own parameterization, including at the region boundaries.
+static void checkPackedNasa(ThermoPhase& g, const double* T, size_t nT)
+{
+    size_t nsp = g.nSpecies();
+    SpeciesThermo& sp = g.speciesThermo();
+    vector_fp cp_R(nsp), h_RT(nsp), s_R(nsp);
+    vector_fp cp_R1(nsp), h_RT1(nsp), s_R1(nsp);
+    for (size_t i = 0; i < nT; i++) {
+        sp.update(T[i], &cp_R[0], &h_RT[0], &s_R[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            sp.update_one(k, T[i], &cp_R1[0], &h_RT1[0], &s_R1[0]);
+            EXPECT_DOUBLE_EQ(cp_R1[k], cp_R[k]) << T[i] << " " << k;
+            EXPECT_DOUBLE_EQ(h_RT1[k], h_RT[k]) << T[i] << " " << k;
+            EXPECT_DOUBLE_EQ(s_R1[k], s_R[k]) << T[i] << " " << k;
+        }
+    }
+
+    // All temperatures at once, with padding between the states
+    size_t ld = nsp + 3;
+    vector_fp cp_Rn(nT*ld), h_RTn(nT*ld), s_Rn(nT*ld);
+    sp.updateMany(nT, T, ld, &cp_Rn[0], &h_RTn[0], &s_Rn[0]);
+    for (size_t i = 0; i < nT; i++) {
+        sp.update(T[i], &cp_R[0], &h_RT[0], &s_R[0]);
+        for (size_t k = 0; k < nsp; k++) {
+            EXPECT_DOUBLE_EQ(cp_R[k], cp_Rn[i*ld + k]) << T[i] << " " << k;
+            EXPECT_DOUBLE_EQ(h_RT[k], h_RTn[i*ld + k]) << T[i] << " " << k;
+            EXPECT_DOUBLE_EQ(s_R[k], s_Rn[i*ld + k]) << T[i] << " " << k;
+        }
+    }
+}
+
+TEST(PackedNasaTest, MixedRegions) {
+    IdealGasMix g("../data/gasNASA9.xml", "nasa9");
+    double T[] = {250.0, 500.0, 500.0001, 999.9999, 1000.0, 1500.0, 2000.0,
+                  3000.0};
+    checkPackedNasa(g, T, 8);
+}
+
+TEST(PackedNasaTest, Nasa7) {
+    IdealGasMix g("gri30.xml", "gri30");
+    double T[] = {300.0, 999.9999, 1000.0, 1000.0001, 1380.0, 2500.0};
+    checkPackedNasa(g, T, 6);
+}
+
+TEST(PackedNasaTest, ModifyHf298) {
+    IdealGasMix g("gri30.xml", "gri30");
+    size_t k = g.speciesIndex("CH4");
+    vector_fp cp_R(g.nSpecies()), h_RT(g.nSpecies()), s_R(g.nSpecies());
+    g.speciesThermo().update(1500.0, &cp_R[0], &h_RT[0], &s_R[0]);
+    double h0 = h_RT[k];
+    double dh = 1.0e6;
+    g.modifyOneHf298SS(k, g.Hf298SS(k) + dh);
+    g.speciesThermo().update(1500.0, &cp_R[0], &h_RT[0], &s_R[0]);
+    EXPECT_NEAR(h0 + dh / (GasConstant * 1500.0), h_RT[k], 1e-10);
+}
+
+TEST(PackedNasaTest, MassPropertiesMany) {
+    IdealGasMix g("gri30.xml", "gri30");
+    size_t nsp = g.nSpecies();
+    const size_t n = 100;
+    vector_fp T(n), P(n), Y(n*nsp);
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 300.0 + 25.0 * i;
+        P[i] = OneAtm * (0.5 + 0.1 * i);
+        for (size_t k = 0; k < nsp; k++) {
+            Y[i*nsp + k] = 1.0 + ((i + k) % 5);
+        }
+        g.setMassFractions(&Y[i*nsp]);
+        g.getMassFractions(&Y[i*nsp]);
+    }
+    g.setState_TPX(800.0, 2*OneAtm, "H2:1, O2:1");
+    vector_fp cp(n), h(n), s(n), gibbs(n);
+    g.getMassProperties(n, &T[0], &P[0], &Y[0], &cp[0], &h[0], &s[0],
+                        &gibbs[0]);
+    EXPECT_DOUBLE_EQ(800.0, g.temperature());
+    for (size_t i = 0; i < n; i++) {
+        g.setState_TPY(T[i], P[i], &Y[i*nsp]);
+        EXPECT_NEAR(g.cp_mass(), cp[i], 1e-12 * g.cp_mass());
+        EXPECT_NEAR(g.enthalpy_mass(), h[i], 1e-12 * g.cp_mass() * T[i]);
+        EXPECT_NEAR(g.entropy_mass(), s[i], 1e-12 * std::abs(g.entropy_mass()));
+        EXPECT_NEAR(g.gibbs_mass(), gibbs[i], 1e-12 * g.cp_mass() * T[i]);
+    }
+
+    // Current pressure and composition
+    g.setState_TPX(800.0, 2*OneAtm, "H2:1, O2:1");
+    g.getMassProperties(n, &T[0], 0, 0, &cp[0], &h[0]);
+    for (size_t i = 0; i < n; i++) {
+        g.setTemperature(T[i]);
+        EXPECT_NEAR(g.cp_mass(), cp[i], 1e-12 * g.cp_mass());
+        EXPECT_NEAR(g.enthalpy_mass(), h[i], 1e-12 * g.cp_mass() * T[i]);
+    }
+}
+
+TEST(PackedNasaTest, SetStateHP) {
+    IdealGasMix g("gri30.xml", "gri30");
+    // The polynomials are not exactly continuous at 1000 K, so enthalpies
+    // in a small interval near this point are not reached
+    double T[] = {250.0, 300.0, 999.9999, 1000.0, 1000.0001, 1200.0, 2500.0,
+                  3400.0};
+    double rtol[] = {1e-9, 1e-9, 1e-6, 1e-6, 1e-6, 1e-9, 1e-9, 1e-9};
+    for (size_t i = 0; i < 8; i++) {
+        g.setState_TPX(T[i], 2*OneAtm, "CH4:1, O2:2, N2:7.52, H2O:0.1");
+        double h = g.enthalpy_mass();
+        double u = g.intEnergy_mass();
+        double v = 1.0 / g.density();
+        g.setState_TPX(1500.0, OneAtm, "CH4:1, O2:2, N2:7.52, H2O:0.1");
+        g.setState_HP(h, 2*OneAtm);
+        EXPECT_NEAR(T[i], g.temperature(), rtol[i] * T[i]);
+        EXPECT_NEAR(2*OneAtm, g.pressure(), 1e-9 * OneAtm);
+        g.setState_TPX(500.0, OneAtm, "CH4:1, O2:2, N2:7.52, H2O:0.1");
+        g.setState_UV(u, v);
+        EXPECT_NEAR(T[i], g.temperature(), rtol[i] * T[i]);
+        EXPECT_NEAR(1.0 / v, g.density(), 1e-9 / v);
+    }
+}
+
+TEST(PackedNasaTest, SetStateHPModifiedSpecies) {
+    IdealGasMix g("h2o2.xml", "ohmech");
+    g.setState_TPX(1000.0, OneAtm, "H2:1, O2:1, AR:2");
+    // Evaluate the mixture coefficients before the species data changes
+    g.setState_HP(g.enthalpy_mass(), OneAtm);
+
+    size_t k = g.speciesIndex("H2");
+    g.modifyOneHf298SS(k, g.Hf298SS(k) + 1.0e7);
+    g.setState_TP(1200.0, OneAtm);
+    double h = g.enthalpy_mass();
+    double u = g.intEnergy_mass();
+    double v = 1.0 / g.density();
+    g.setState_TP(1500.0, OneAtm);
+    g.setState_HP(h, OneAtm);
+    EXPECT_NEAR(1200.0, g.temperature(), 1e-9 * 1200.0);
+    g.setState_TP(500.0, OneAtm);
+    g.setState_UV(u, v);
+    EXPECT_NEAR(1200.0, g.temperature(), 1e-9 * 1200.0);
+}
+
+TEST(PackedNasaTest, TemperaturesFromEnergy) {
+    IdealGasMix g("../data/gasNASA9.xml", "nasa9");
+    size_t nsp = g.nSpecies();
+    const size_t n = 40;
+    vector_fp T(n), Y(n*nsp), h(n), u(n);
+    for (size_t i = 0; i < n; i++) {
+        T[i] = 220.0 + 100.0 * i;
+        for (size_t k = 0; k < nsp; k++) {
+            Y[i*nsp + k] = 1.0 + ((i + k) % 3);
+        }
+        g.setMassFractions(&Y[i*nsp]);
+        g.getMassFractions(&Y[i*nsp]);
+        g.setState_TP(T[i], OneAtm);
+        h[i] = g.enthalpy_mass();
+        u[i] = g.intEnergy_mass();
+    }
+    vector_fp Th(n, 300.0), Tu(n, 4000.0);
+    g.setState_TP(900.0, OneAtm);
+    g.getTemperatures_HY(n, &h[0], &Y[0], &Th[0]);
+    g.getTemperatures_UY(n, &u[0], &Y[0], &Tu[0]);
+    EXPECT_DOUBLE_EQ(900.0, g.temperature());
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(T[i], Th[i], 1e-9 * T[i]);
+        EXPECT_NEAR(T[i], Tu[i], 1e-9 * T[i]);
+    }
+
+    // Current composition
+    g.setMassFractions(&Y[0]);
+    vector_fp h0(n);
+    for (size_t i = 0; i < n; i++) {
+        g.setState_TP(T[i], OneAtm);
+        h0[i] = g.enthalpy_mass();
+    }
+    Th.assign(n, 1000.0);
+    g.getTemperatures_HY(n, &h0[0], 0, &Th[0]);
+    for (size_t i = 0; i < n; i++) {
+        EXPECT_NEAR(T[i], Th[i], 1e-9 * T[i]);
+    }
+}
 
 } // namespace Cantera
 
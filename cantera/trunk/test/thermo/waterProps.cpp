@@ -0,0 +1,71 @@
+#include "gtest/gtest.h"
+#include "cantera/thermo/WaterPropsIAPWS.h"
+#include "cantera/thermo/WaterPropsIAPWSTable.h"
+#include <cmath>
+
+namespace Cantera
+{
+
+TEST(WaterPropsIAPWSTable, LiquidDensity)
+{
+    const WaterPropsIAPWSTable& table = WaterPropsIAPWSTable::liquidTable();
+    EXPECT_GT(table.nValidCells(), (size_t) 0);
+    WaterPropsIAPWS water;
+    int nInterpolated = 0;
+    // Points between the nodes of the table
+    for (double T = 274.0; T < 598.0; T += 7.3) {
+        double psat = water.psat_est(T);
+        for (double lnP = log(1.1E3); lnP < log(1.0E8); lnP += 0.37) {
+            double P = exp(lnP);
+            double rho = table.liquidDensity(T, P);
+            if (P < psat) {
+                EXPECT_EQ(-1.0, rho) << T << " " << P;
+            }
+            if (rho < 0.0) {
+                continue;
+            }
+            nInterpolated++;
+            double rhoExact = water.density(T, P, WATER_LIQUID);
+            EXPECT_NEAR(rhoExact, rho, 5.0E-8 * rhoExact) << T << " " << P;
+        }
+    }
+    EXPECT_GT(nInterpolated, 500);
+
+    // Outside of the table
+    EXPECT_EQ(-1.0, table.liquidDensity(273.0, OneAtm));
+    EXPECT_EQ(-1.0, table.liquidDensity(600.0, 5.0E7));
+    EXPECT_EQ(-1.0, table.liquidDensity(300.0, 2.0E8));
+}
+
+TEST(WaterPropsIAPWSTable, UseInWaterProps)
+{
+    WaterPropsIAPWS exact;
+    WaterPropsIAPWS tabulated;
+    EXPECT_FALSE(tabulated.usingDensityTable());
+    tabulated.useDensityTable();
+    EXPECT_TRUE(tabulated.usingDensityTable());
+
+    double rhoExact = exact.density(350.0, 3.0E6, WATER_LIQUID);
+    double rho = tabulated.density(350.0, 3.0E6, WATER_LIQUID);
+    EXPECT_NEAR(rhoExact, rho, 5.0E-8 * rhoExact);
+    EXPECT_DOUBLE_EQ(rho, tabulated.density());
+    EXPECT_NEAR(3.0E6, tabulated.pressure(), 10.0);
+    EXPECT_NEAR(exact.enthalpy(), tabulated.enthalpy(),
+                1.0E-7 * fabs(exact.enthalpy()));
+    EXPECT_NEAR(exact.cp(), tabulated.cp(), 1.0E-7 * exact.cp());
+    EXPECT_NEAR(rho, tabulated.density_const(3.0E6, WATER_LIQUID), 1.0E-12 * rho);
+
+    // The table is not used for other phases, or outside of its range
+    EXPECT_DOUBLE_EQ(exact.density(350.0, 1.0E4, WATER_GAS),
+                     tabulated.density(350.0, 1.0E4, WATER_GAS));
+    EXPECT_DOUBLE_EQ(exact.density(620.0, 3.0E7, WATER_LIQUID),
+                     tabulated.density(620.0, 3.0E7, WATER_LIQUID));
+
+    WaterPropsIAPWS copy(tabulated);
+    EXPECT_TRUE(copy.usingDensityTable());
+    copy.useDensityTable(false);
+    EXPECT_FALSE(copy.usingDensityTable());
+    EXPECT_DOUBLE_EQ(rhoExact, copy.density(350.0, 3.0E6, WATER_LIQUID));
+}
+
+}